@@ -26,9 +26,37 @@
 #include <EGL/eglext.h>
 
 #include "crglContext.hpp"
+#include "crglResourceJob.hpp"
+
+typedef struct eglWorkerPool_t  eglWorkerPool_t;
 
 namespace egl
 {
+    /// @brief a device exposed by EGL_EXT_device_enumeration
+    typedef struct device_t
+    {
+        EGLDeviceEXT    handle = EGL_NO_DEVICE_EXT;
+        const char*     name = nullptr;         // EGL_RENDERER_EXT, null whitout EGL_EXT_device_query_name
+        const char*     vendor = nullptr;       // EGL_VENDOR, null whitout EGL_EXT_device_query_name
+        const char*     drmDevice = nullptr;    // DRM primary node path, null for non DRM devices
+        const char*     renderNode = nullptr;   // DRM render node path, null if the device have none
+        const char*     extensions = nullptr;   // device extensions string
+        bool            software = false;       // EGL_MESA_device_software, a CPU rasterizer
+    } device_t;
+
+    /// @brief what a device display can do, filled by Context::QueryDevice
+    typedef struct deviceCaps_t
+    {
+        EGLint          major = 0;              // EGL version of the device display
+        EGLint          minor = 0;
+        const char*     vendor = nullptr;       // display EGL_VENDOR
+        bool            openGL = false;         // desktop OpenGL in EGL_CLIENT_APIS
+        bool            createContext = false;  // EGL_KHR_create_context, core profiles and versions
+        bool            surfaceless = false;    // EGL_KHR_surfaceless_context
+        bool            pbuffer = false;        // have a OpenGL config whit pbuffer support
+        bool            noConfig = false;       // EGL_KHR_no_config_context
+    } deviceCaps_t;
+
     class Context : public gl::Context
     {
     public:
@@ -43,9 +71,10 @@ namespace egl
             uint8_t                 stencil = 8;
             int                     verMin = 4;
             int                     verMaj = 5;
-            EGLenum                 platform;   // display platform ( EGL_PLATFORM_ANGLE_ANGLE / EGL_PLATFORM_WAYLAND_KHR / EGL_PLATFORM_X11_KHR / EGL_PLATFORM_SURFACELESS_MESA)
+            EGLenum                 platform = EGL_PLATFORM_SURFACELESS_MESA;   // display platform ( EGL_PLATFORM_ANGLE_ANGLE / EGL_PLATFORM_WAYLAND_KHR / EGL_PLATFORM_X11_KHR / EGL_PLATFORM_SURFACELESS_MESA)
             EGLNativeWindowType     nativeWindow = 0;
             EGLNativeDisplayType    nativeDisplay = 0;    
+            EGLDeviceEXT            device = EGL_NO_DEVICE_EXT;             // explicit device from EnumerateDevices, use EGL_PLATFORM_DEVICE_EXT and override platform
         };
 
         Context( void );
@@ -58,11 +87,55 @@ namespace egl
         virtual bool    SwapBuffers( void ) override;
         virtual void*   GetFunctionPointer( const char* in_name ) const override;
         virtual void    DebugOuput( const char* in_message ) const override;
+
+        /// @brief spawn shared worker contexts, each one current on its own thread
+        /// call after Init, whit this context current
+        /// @param in_count number of worker threads
+        /// @param in_surfaceless use EGL_KHR_surfaceless_context when available, else a 1x1 pbuffer
+        /// @return true if at least one worker started, the workers that fail to start are dropped and reported
+        bool    CreateWorkers( const GLuint in_count, const bool in_surfaceless = true );
+
+        /// @brief finish the queued jobs, complete them and destroy the worker contexts
+        /// call whit this context current
+        void    DestroyWorkers( void );
+
+        /// @brief queue a job to the workers, safe to call from any thread
+        /// @return false if there is no worker to run it
+        bool    Submit( gl::ResourceJob* in_job );
+
+        /// @brief make this context wait ( on the GPU ) for the finished jobs and call they Complete
+        /// call whit this context current, usually once per frame
+        /// @return number of completed jobs
+        GLuint  ProcessCompletedJobs( void );
+
+        /// @brief jobs submitted and not completed yet
+        GLuint  PendingJobs( void ) const;
+
+        /// @brief number of running workers
+        GLuint  NumWorkers( void ) const;
+
+        /// @brief list the EGL devices, need EGL_EXT_device_enumeration
+        /// on a machine whitout GPU the list hold only the software device
+        /// @param in_devices output array, can be null to only count the devices
+        /// @param in_count output array size
+        /// @return number of devices available
+        static GLuint   EnumerateDevices( device_t* in_devices, const GLuint in_count );
+
+        /// @brief query a device capabilities, initialize the device display ( EGL_PLATFORM_DEVICE_EXT )
+        /// the display is kept initialized, it is shared whit the contexts created on the device
+        /// @return false if the device display can't be initialized
+        static bool     QueryDevice( const EGLDeviceEXT in_device, deviceCaps_t* in_caps );
  
     private:
-        EGLDisplay m_display;
-        EGLContext m_context;
-        EGLSurface m_surface;
+        EGLDisplay          m_display;
+        EGLContext          m_context;
+        EGLSurface          m_surface;
+        EGLConfig           m_config;
+        createInfo_t        m_createInfo;
+        eglWorkerPool_t*    m_workers;
+
+        bool    CreateShared( const Context* in_parent, const bool in_surfaceless );
+        void    WorkerLoop( eglWorkerPool_t* in_pool, const Context* in_parent );
     };
 };
 
@@ -0,0 +1,126 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+
+#ifndef __CRGL_BLOCK_ENCODER_HPP__
+#define __CRGL_BLOCK_ENCODER_HPP__
+
+typedef struct glCoreBlockEncoder_t glCoreBlockEncoder_t;
+
+namespace gl
+{
+    class MipGenerator;
+
+    /// @brief encoder speed / quality trade off
+    enum blockQuality_t
+    {
+        BLOCK_QUALITY_FAST = 0,     // principal axis endpoints, no refinement, BC7 mode 6 only
+        BLOCK_QUALITY_NORMAL,       // least squares refinement, BC7 mode 6 and the 2 most promising 2 subsets partitions
+        BLOCK_QUALITY_HIGH          // more refinement passes, BC4 endpoints search, BC7 tries the 8 best partitions
+    };
+
+    typedef struct blockEncoderStats_t
+    {
+        uint64_t    images = 0;         // Encode calls
+        uint64_t    blocks = 0;         // 4x4 blocks encoded
+        uint64_t    pixels = 0;         // source pixels
+        uint64_t    microseconds = 0;   // time spent in Encode
+        mipSimd_t   simd = MIP_SIMD_NONE;   // kernels in use
+    } blockEncoderStats_t;
+
+    /// @brief result of BlockEncoder::Benchmark
+    typedef struct blockBenchmark_t
+    {
+        double      seconds = 0.0;      // encode time
+        double      megapixels = 0.0;   // throughput, MPix/s
+        double      bitsPerPixel = 0.0;
+        double      rmse = 0.0;         // root mean square error of the stored channels, 0 - 255 scale
+        double      psnr = 0.0;         // peak signal to noise ratio, dB, infinity for exact images
+    } blockBenchmark_t;
+
+    /// @brief Compress images to the BCn formats on the CPU, whitout a context, from any thread.
+    /// The source is always 8 bits RGBA ( GL_RGBA / GL_UNSIGNED_BYTE ), BC4 use the red channel and BC5 red and green,
+    /// sRGB formats are encoded as stored. Each 4x4 block is fitted along the colors principal axis,
+    /// the palette indices are chosen by SIMD kernels and the block rows are spread over the encoder threads.
+    /// Supported formats: BC1 ( DXT1, RGB and punch-through alpha ), BC2 ( DXT3 ), BC3 ( DXT5 ),
+    /// BC4 and BC5 ( unsigned RGTC ) and BC7 ( BPTC unorm, encoded whit the modes 1 and 6 ).
+    class BlockEncoder
+    {
+    public:
+        struct createInfo_t
+        {
+            blockQuality_t  quality = BLOCK_QUALITY_NORMAL;
+
+            /// @brief worker threads, the calling thread work too, 0 for one per core
+            GLuint          threads = 0;
+
+            /// @brief kernels instruction set, the requested one must be supported
+            mipSimd_t       simd = MIP_SIMD_AUTO;
+
+            /// @brief weight the color error by the luminance contribution of each channel
+            bool            perceptual = true;
+        };
+
+        BlockEncoder( void );
+        ~BlockEncoder( void );
+
+        /// @brief start the worker threads
+        bool    Create( const createInfo_t* in_createInfo );
+        void    Destroy( void );
+
+        /// @brief compress a image
+        /// @param in_pixels 8 bits RGBA source
+        /// @param in_blocks destine, at least CompressedSize bytes, blocks in rows from the first image row
+        /// @param in_stride source row size in bytes, 0 for tightly packed rows
+        /// @return false for unsupported formats or a too small destine
+        bool    Encode( const Format in_format, const GLuint in_width, const GLuint in_height, const void* in_pixels, void* in_blocks, const GLsizeiptr in_size, const GLsizeiptr in_stride = 0 );
+
+        /// @brief compress a region and upload it whit Texture::CompressedSubImage, the context must be current
+        /// @param in_subImage texture region, offsets must be multiple of 4
+        /// @param in_pixels 8 bits RGBA source of the region, tightly packed
+        bool    CompressedSubImage( Texture* in_texture, const Texture::subImage_t* in_subImage, const void* in_pixels );
+
+        /// @brief compress and upload the levels of a generated 8 bits RGBA chain, base level included
+        /// @param in_layer array layer or cube face
+        bool    Upload( Texture* in_texture, const MipGenerator* in_generator, const GLsizei in_layer = 0 );
+
+        /// @brief encode a image, decode it back and measure the throughput and the error
+        bool    Benchmark( const Format in_format, const GLuint in_width, const GLuint in_height, const void* in_pixels, blockBenchmark_t* in_result );
+
+        blockEncoderStats_t Stats( void ) const;
+
+        /// @brief true if the format can be encoded
+        static bool Supported( const Format in_format );
+
+        /// @brief size in bytes of a compressed image
+        static GLsizeiptr   CompressedSize( const Format in_format, const GLuint in_width, const GLuint in_height );
+
+        /// @brief decompress a image to 8 bits RGBA, missing channels are 0 and alpha 255
+        /// BC7 blocks using the 3 subsets modes ( 0 and 2 ) are not decoded and come out transparent black,
+        /// hardware decoders may round the BC1 - BC5 interpolated entries one unit away
+        static bool Decode( const Format in_format, const GLuint in_width, const GLuint in_height, const void* in_blocks, void* in_pixels );
+
+    private:
+        glCoreBlockEncoder_t*   m_encoder;
+    };
+};
+
+#endif //!__CRGL_BLOCK_ENCODER_HPP__
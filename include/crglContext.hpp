@@ -22,6 +22,8 @@
 #ifndef __CRGL_CONTEXT_HPP__
 #define __CRGL_CONTEXT_HPP__
 
+typedef struct glCoreResourceListeners_t glCoreResourceListeners_t;
+
 namespace gl
 {
     // current suported features
@@ -107,8 +109,8 @@ namespace gl
     {
         boolean         testing = FALSE;
         GLint           clear = 0xFF;
-        GLuint          maskFront = 0x00;
-        GLuint          maskBack = 0x00;
+        GLuint          maskFront = 0xFFFFFFFF;     // write masks, all bits writen by default as the driver
+        GLuint          maskBack = 0xFFFFFFFF;
         stencilFunc_t   funcFront;
         stencilFunc_t   funcBack;      
         stencilOp_t     opFront;
@@ -119,7 +121,7 @@ namespace gl
     {
         boolean     testing = FALSE;
         boolean     clamp   = FALSE;
-        GLboolean   mask    = FALSE;
+        GLboolean   mask    = TRUE;     // depth write, enabled by default as the driver
         compare_t   func    = LESS;
         GLdouble    clear   = 0.0;
         GLfloat     factor  = 0.0f;
@@ -144,7 +146,7 @@ namespace gl
 
         bool operator!=( const blendEquation_t& other ) const 
         {
-            return ( modeRGB == other.modeRGB ) && ( modeAlpha == other.modeAlpha );
+            return ( modeRGB != other.modeRGB ) || ( modeAlpha != other.modeAlpha );
         }
     
     } blendEquation_t;
@@ -175,14 +177,33 @@ namespace gl
         blendFunction_t         function;
     } blendingState_t;
 
+    typedef struct colorMask_t
+    {
+        GLboolean   red     = TRUE;
+        GLboolean   green   = TRUE;
+        GLboolean   blue    = TRUE;
+        GLboolean   alpha   = TRUE;
+
+        bool operator!=( const colorMask_t& other ) const 
+        {
+            return ( red != other.red ) || ( green != other.green ) || ( blue != other.blue ) || ( alpha != other.alpha );
+        }
+    } colorMask_t;
+
     typedef struct drawbuffer_t
     {
         blendingState_t     blending;
+        colorMask_t         colorMask;
     } drawbuffer_t;
 
+    /// @brief scissor test and box, the box is shared by all viewports ( glScissor )
     typedef struct scissorState_t
     {
-        GLboolean scissor;
+        boolean     testing = FALSE;
+        GLint       x = 0;
+        GLint       y = 0;
+        GLsizei     width = 0;
+        GLsizei     height = 0;
     } scissorState_t;
 
     // represent a viewport space
@@ -209,6 +230,7 @@ namespace gl
         faceCull_t          cullingState;
         stencilState_t      stencilState;
         depthState_t        depthState;
+        scissorState_t      scissorState;
         drawbuffer_t*       drawBuffers;
         viewport_t*         viewports;
     } coreState_t;
@@ -221,11 +243,52 @@ namespace gl
         GLsizei height = 0;
     } rect_t;
 
+    /// @brief per frame counters, cheap to keep, take a snapshot with Context::EndFrame
+    typedef struct frameStats_t
+    {
+        uint64_t    frame = 0;                  // frame index
+        uint64_t    drawCalls = 0;              // draw commands submitted
+        uint64_t    indices = 0;                // indices, or vertices for non indexed draws, submitted
+        uint64_t    instances = 0;              // instances submitted
+        uint64_t    stateChanges = 0;           // state changes sent to the driver
+        uint64_t    stateFiltered = 0;          // redundant state changes filtered by the state cache
+        uint64_t    bufferBytesUploaded = 0;    // bytes sent by gl::Buffer::Upload
+        uint64_t    textureBytesUploaded = 0;   // bytes sent by gl::Texture::SubImage / CompressedSubImage
+        uint64_t    programBinds = 0;           // programs and pipelines bound
+        uint64_t    fenceWaits = 0;             // gl::Fence::ClientWait calls
+        uint64_t    fenceWaitTime = 0;          // nanoseconds blocked on gl::Fence::ClientWait
+    } frameStats_t;
+
+    /// @brief Init cost break down, times in nanoseconds
+    typedef struct startupStats_t
+    {
+        uint64_t    loadTime = 0;               // resolving the function pointers
+        uint64_t    extensionTime = 0;          // parsing GL_EXTENSIONS
+        uint64_t    queryTime = 0;              // context limits queries and state arrays allocation
+        uint64_t    totalTime = 0;              // whole Init call
+        GLuint      functionsMissing = 0;       // entry points the driver don't expose
+        GLuint      extensions = 0;             // extensions reported by the driver
+    } startupStats_t;
+
+    /// @brief max ResourceListener registered on a context
+    static constexpr GLuint k_MAX_RESOURCE_LISTENERS = 8;
+
+    /// @brief notified when a object wrapper delete its OpenGL object, so caches can drop
+    /// references to the name before the driver reuse it.
+    /// Called from the thread destroying the object, that can be a shared context one,
+    /// whit the listeners lock held: don't add or remove listeners from ResourceDestroyed
+    class ResourceListener
+    {
+    public:
+        virtual ~ResourceListener( void ) {}
+        virtual void    ResourceDestroyed( const memoryResource_t in_resource, const GLuint in_name ) = 0;
+    };
+
     class Context
     {
     public:
         Context( void );
-        ~Context( void );
+        virtual ~Context( void );
 
         virtual bool    Create( const void* in_windowHandle) = 0;
         virtual void    Destroy( void );
@@ -233,10 +296,14 @@ namespace gl
         virtual bool    Release( void ) = 0;
         virtual bool    SwapBuffers( void ) = 0;
         virtual void*   GetFunctionPointer( const char* in_name ) const;
+        /// @brief receive the formated debug messages,
+        /// on DEBUG_ASYNC mode this is called from the logger thread
         virtual void    DebugOuput( const char* in_message ) const = 0;
 
-        // init OpenGL debugOuput, load functions
-        bool    Init( void );
+        /// @brief Load functions, init OpenGL debug output and query the context features
+        /// @param in_debug debug output configuration, nullptr use the defaults ( DEBUG_ASYNC )
+        /// @return true on sucess
+        bool    Init( const debugConfig_t* in_debug = nullptr );
         void    Finalize( void );
 
         /// @brief Clear context state, unbind buffers, textures, states to defalt
@@ -259,12 +326,20 @@ namespace gl
         /// @return the old state in use
         blendingState_t SetBlendState( const GLuint in_drawBuffer, const blendingState_t in_state );
 
+        /// @brief Update a draw buffer color write mask
+        /// @return the old mask in use
+        colorMask_t SetColorMask( const GLuint in_drawBuffer, const colorMask_t in_mask );
+
         stencilState_t SetStencilState( const stencilState_t in_steate );
 
         depthState_t SetDepthState( const depthState_t in_state );
 
         viewport_t  SetViewportState( const GLuint in_viewport, const viewport_t in_stae );
 
+        /// @brief Update the scissor test and box
+        /// @return the old state
+        scissorState_t  SetScissorState( const scissorState_t in_state );
+
         /// @brief 
         /// @param in_enable 
         /// @return 
@@ -299,23 +374,136 @@ namespace gl
         GLuint  BindTextures( const GLuint* in_textures, const GLuint* in_samplers, const GLuint in_first, const GLuint in_count );
         
         void    BlitToCurrentFrameBuffer( const GLuint in_source, const rect_t in_srcRect, const rect_t in_dstRect, const GLbitfield in_mask, const GLenum in_filter );
+
+        /// @brief draw non indexed primitives from the current vertex array
+        /// @param in_mode primitive type
+        /// @param in_first first vertex
+        /// @param in_count number of vertices
+        /// @param in_instances number of instances, 1 for a non instanced draw
+        /// @param in_baseInstance base instance for instanced vertex attributes
+        void    DrawArrays( const GLenum in_mode, const GLint in_first, const GLsizei in_count, const GLsizei in_instances = 1, const GLuint in_baseInstance = 0 );
+
+        /// @brief draw indexed primitives from the current vertex array element buffer
+        /// @param in_mode primitive type
+        /// @param in_count number of indices
+        /// @param in_type index type GL_UNSIGNED_BYTE / GL_UNSIGNED_SHORT / GL_UNSIGNED_INT
+        /// @param in_offset byte offset in the element buffer
+        /// @param in_instances number of instances, 1 for a non instanced draw
+        /// @param in_baseVertex constant added to each index
+        /// @param in_baseInstance base instance for instanced vertex attributes
+        void    DrawElements( const GLenum in_mode, const GLsizei in_count, const GLenum in_type, const GLintptr in_offset, const GLsizei in_instances = 1, const GLint in_baseVertex = 0, const GLuint in_baseInstance = 0 );
+
+        /// @brief draw a sequence of commands from the current indirect buffer
+        /// the indices and instances are on the GPU, only the draw calls are counted
+        void    DrawElementsIndirect( const GLenum in_mode, const GLenum in_type, const GLintptr in_offset, const GLsizei in_drawCount, const GLsizei in_stride );
+
+        /// @brief close the current frame counters
+        /// @return the finished frame counters
+        frameStats_t    EndFrame( void );
+
+        /// @brief counters of the frame in progress
+        const frameStats_t& FrameStats( void ) const { return m_stats; }
+
+        /// @brief counters of the last closed frame
+        const frameStats_t& LastFrameStats( void ) const { return m_lastFrameStats; }
+
+        /// @brief counters recording, called by the object wrappers on the current context
+        void    RecordBufferUpload( const uint64_t in_bytes ) { m_stats.bufferBytesUploaded += in_bytes; }
+        void    RecordTextureUpload( const uint64_t in_bytes ) { m_stats.textureBytesUploaded += in_bytes; }
+        void    RecordFenceWait( const uint64_t in_nanoseconds ) { m_stats.fenceWaits++; m_stats.fenceWaitTime += in_nanoseconds; }
+
+        /// @brief the context current on the calling thread
+        static Context*  Current( void );
         
         const   coreFeatures_t  Features( void ) const { return m_features; };
 
+        /// @brief check if the driver expose a extension, parsed once at Init
+        bool    HasExtension( const extension_t in_extension ) const { return m_extensions.Test( in_extension ); }
+        const extensionSet_t&   Extensions( void ) const { return m_extensions; }
+
+        /// @brief check if a entry point was resolved at Init
+        bool    IsFunctionLoaded( const function_t in_function ) const { return !m_missingFunctions.Test( in_function ); }
+        const functionSet_t&    MissingFunctions( void ) const { return m_missingFunctions; }
+
+        /// @brief the context entry points, the gl* calls go through the current context one
+        /// the pointers can be replaced after Init to instrument the calls
+        dispatch_t&             Dispatch( void ) { return m_dispatch; }
+        const dispatch_t&       Dispatch( void ) const { return m_dispatch; }
+
+        /// @brief Init timings
+        const startupStats_t&   StartupStats( void ) const { return m_startupStats; }
+
+        /// @brief return the debug output configuration in use
+        const   debugConfig_t   DebugConfig( void ) const { return m_debugConfig; }
+
+        /// @brief number of debug messages lost because the async queue was full
+        uint64_t    DebugMessagesDropped( void ) const { return m_debugLogger.Dropped(); }
+
+        /// @brief GPU memory used by the objects created while this context was current
+        MemoryTracker&          Memory( void ) { return *m_memoryTracker; }
+        const MemoryTracker&    Memory( void ) const { return *m_memoryTracker; }
+
+        /// @brief register a listener for the objects destroyed while this context, or a shared one, is current
+        /// thread safe, once RemoveResourceListener return the listener is no longer called
+        /// @return false if there are already k_MAX_RESOURCE_LISTENERS listeners
+        bool    AddResourceListener( ResourceListener* in_listener );
+        void    RemoveResourceListener( ResourceListener* in_listener );
+
+        /// @brief called by the object wrappers before deleting the OpenGL object,
+        /// drop the name from the binding cache, the driver unbind it from this context
+        void    NotifyResourceDestroyed( const memoryResource_t in_resource, const GLuint in_name );
+
         /// @brief return the stencil set status
         const stencilState_t  CurrentStencilStatus( void ) const { return m_state.stencilState; }
 
         /// @brief return the depth set status
         const depthState_t    CurrentDepthStatus( void ) const { return m_state.depthState; }
 
+        /// @brief return the scissor set status
+        const scissorState_t  CurrentScissorStatus( void ) const { return m_state.scissorState; }
+
         /// @brief return the gobal context status
         const   coreState_t     CurrentState( void ) const { return m_state; }
 
+    protected:
+        /// @brief implementations call it from MakeCurrent / Release to track the thread current context
+        static void     SetCurrent( Context* in_context );
+
+        /// @brief Init a context that share objects whit in_parent, called whit the context current
+        /// reuse the parent entry points, limits and memory tracker instead of querying the driver again
+        bool            InitShared( const Context* in_parent );
+
     private:
+        dispatch_t        m_dispatch;
         coreFeatures_t    m_features;
         coreState_t       m_state;
+        debugConfig_t     m_debugConfig;
+        DebugLogger       m_debugLogger;
+        frameStats_t      m_stats;
+        frameStats_t      m_lastFrameStats;
+        MemoryTracker     m_memory;
+        MemoryTracker*    m_memoryTracker;      // m_memory, or the parent one for shared contexts
+        glCoreResourceListeners_t*  m_listeners;
+        glCoreResourceListeners_t*  m_resourceListeners;    // m_listeners, or the parent ones for shared contexts
+        extensionSet_t    m_extensions;
+        functionSet_t     m_missingFunctions;
+        startupStats_t    m_startupStats;
+        void*             m_stateArrays;        // single allocation backing the m_state binding arrays
 
         void    LoadFunctions( void );
+        void    LoadExtensions( void );
+        void    AllocateStateArrays( void );
+        void    InitDebugOutput( void );
+
+        /// @brief count a cached state update, return in_changed
+        bool    CountState( const bool in_changed )
+        {
+            if ( in_changed )
+                m_stats.stateChanges++;
+            else
+                m_stats.stateFiltered++;
+            return in_changed;
+        }
         static void APIENTRY DebugOutputCall( GLenum source,GLenum type,GLuint id,GLenum severity,GLsizei length,const GLchar *message,const void *userParam );
     };
 
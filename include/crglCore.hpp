@@ -23,298 +23,7 @@
 
 #include <GL/glcorearb.h>
 
-// state cofiguration
-extern PFNGLGETINTEGERVPROC                             glGetIntegerv;
-extern PFNGLGETINTEGER64VPROC                           glGetInteger64v;
-extern PFNGLISENABLEDPROC                               glIsEnabled;
-extern PFNGLDISABLEPROC                                 glDisable;
-extern PFNGLENABLEPROC                                  glEnable;
-extern PFNGLENABLEIPROC                                 glEnablei;
-extern PFNGLDISABLEIPROC                                glDisablei;
-extern PFNGLFINISHPROC                                  glFinish;
-extern PFNGLFLUSHPROC                                   glFlush;
-
-extern PFNGLGETERRORPROC                                glGetError;
-extern PFNGLGETSTRINGPROC                               glGetString;
-extern PFNGLGETBOOLEANVPROC                             glGetBooleanv;
-extern PFNGLHINTPROC                                    glHint;
-
-extern PFNGLVIEWPORTPROC                                glViewport;
-extern PFNGLSCISSORPROC                                 glScissor;
-
-
-// color buffer 
-extern PFNGLCLEARCOLORPROC                              glClearColor;
-extern PFNGLCOLORMASKPROC                               glColorMask;
-extern PFNGLCLEARPROC                                   glClear;
-extern PFNGLBLENDFUNCSEPARATEPROC                       glBlendFuncSeparate;
-extern PFNGLLOGICOPPROC                                 glLogicOp;
-
-// GL_ARB_draw_buffers_blend
-extern PFNGLBLENDEQUATIONSEPARATEIPROC                  glBlendEquationSeparatei;
-extern PFNGLBLENDFUNCSEPARATEIPROC                      glBlendFuncSeparatei;
-
-// depth buffer
-extern PFNGLDEPTHRANGEPROC                              glDepthRange;
-extern PFNGLCLEARDEPTHPROC                              glClearDepth;
-extern PFNGLDEPTHMASKPROC                               glDepthMask;
-extern PFNGLDEPTHFUNCPROC                               glDepthFunc;
-extern PFNGLPOLYGONOFFSETPROC                           glPolygonOffset;
-
-// stencil buffer
-extern PFNGLCLEARSTENCILPROC                            glClearStencil;
-extern PFNGLSTENCILMASKPROC                             glStencilMask;
-extern PFNGLSTENCILFUNCPROC                             glStencilFunc;
-extern PFNGLSTENCILOPPROC                               glStencilOp;
-
-extern PFNGLSTENCILFUNCSEPARATEPROC                     glStencilFuncSeparate;
-extern PFNGLSTENCILOPSEPARATEPROC                       glStencilOpSeparate;
-extern PFNGLSTENCILMASKSEPARATEPROC                     glStencilMaskSeparate;
-
-// polygon 
-extern PFNGLLINEWIDTHPROC                               glLineWidth;
-extern PFNGLPOINTSIZEPROC                               glPointSize;
-extern PFNGLPOLYGONMODEPROC                             glPolygonMode;
-extern PFNGLCULLFACEPROC                                glCullFace;
-
-// draw
-extern PFNGLDRAWARRAYSPROC                              glDrawArrays;
-extern PFNGLDRAWELEMENTSPROC                            glDrawElements;
-extern PFNGLMULTIDRAWARRAYSPROC                         glMultiDrawArrays;
-extern PFNGLMULTIDRAWELEMENTSPROC                       glMultiDrawElements;
-extern PFNGLDRAWELEMENTSBASEVERTEXPROC                  glDrawElementsBaseVertex;
-extern PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC             glDrawRangeElementsBaseVertex;
-extern PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC             glMultiDrawElementsBaseVertex;
-
-// GL_ARB_draw_instanced
-extern PFNGLDRAWARRAYSINSTANCEDPROC                     glDrawArraysInstanced;
-extern PFNGLDRAWELEMENTSINSTANCEDPROC                   glDrawElementsInstanced;
-extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC         glDrawElementsInstancedBaseVertex;
-extern PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC         glDrawArraysInstancedBaseInstance;
-extern PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC       glDrawElementsInstancedBaseInstance;
-extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC    glDrawElementsInstancedBaseVertexBaseInstance;
-
-// GL_ARB_draw_indirect
-extern PFNGLDRAWARRAYSINDIRECTPROC                      glDrawArraysIndirect;
-extern PFNGLDRAWELEMENTSINDIRECTPROC                    glDrawElementsIndirect;
-
-// GL_ARB_multi_draw_indirect
-extern PFNGLMULTIDRAWARRAYSINDIRECTPROC                 glMultiDrawArraysIndirect;
-extern PFNGLMULTIDRAWELEMENTSINDIRECTPROC               glMultiDrawElementsIndirect;
-extern PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC            glMultiDrawArraysIndirectCount;
-extern PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC          glMultiDrawElementsIndirectCount;
-
-// GL_ARB_transform_feedback2
-extern PFNGLDRAWTRANSFORMFEEDBACKPROC                   glDrawTransformFeedback;
-extern PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC             glDrawTransformFeedbackStream;
-extern PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC          glDrawTransformFeedbackInstanced;
-extern PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC    glDrawTransformFeedbackStreamInstanced;
-
-// GL_KHR_debug
-extern PFNGLDEBUGMESSAGECONTROLPROC                     glDebugMessageControl;
-extern PFNGLDEBUGMESSAGECALLBACKPROC                    glDebugMessageCallback;
-extern PFNGLGETDEBUGMESSAGELOGPROC                      glGetDebugMessageLog;
-extern PFNGLDEBUGMESSAGEINSERTPROC                      glDebugMessageInsert;
-extern PFNGLOBJECTLABELPROC                             glObjectLabel;
-extern PFNGLGETOBJECTLABELPROC                          glGetObjectLabel;
-extern PFNGLOBJECTPTRLABELPROC                          glObjectPtrLabel;
-extern PFNGLGETOBJECTPTRLABELPROC                       glGetObjectPtrLabel;
-
-// vertex array 
-extern PFNGLISVERTEXARRAYPROC                           glIsVertexArray;
-extern PFNGLCREATEVERTEXARRAYSPROC                      glCreateVertexArrays;
-extern PFNGLDELETEVERTEXARRAYSPROC                      glDeleteVertexArrays;
-extern PFNGLBINDVERTEXARRAYPROC                         glBindVertexArray;             
-extern PFNGLENABLEVERTEXARRAYATTRIBPROC                 glEnableVertexArrayAttrib;
-extern PFNGLDISABLEVERTEXARRAYATTRIBPROC                glDisableVertexArrayAttrib;
-extern PFNGLVERTEXARRAYATTRIBBINDINGPROC                glVertexArrayAttribBinding;
-extern PFNGLVERTEXARRAYATTRIBFORMATPROC                 glVertexArrayAttribFormat;
-extern PFNGLVERTEXARRAYELEMENTBUFFERPROC                glVertexArrayElementBuffer;
-extern PFNGLVERTEXARRAYVERTEXBUFFERPROC                 glVertexArrayVertexBuffer; 
-
-// GL_ARB_multi_bind
-extern PFNGLVERTEXARRAYVERTEXBUFFERSPROC                glVertexArrayVertexBuffers; 
-
-// shader 
-extern PFNGLISSHADERPROC                                glIsShader;
-extern PFNGLCREATESHADERPROC                            glCreateShader;
-extern PFNGLDELETESHADERPROC                            glDeleteShader;
-extern PFNGLSHADERSOURCEPROC                            glShaderSource;
-extern PFNGLSHADERBINARYPROC                            glShaderBinary;
-extern PFNGLCOMPILESHADERPROC                           glCompileShader;
-extern PFNGLSPECIALIZESHADERPROC                        glSpecializeShader;
-extern PFNGLGETSHADERINFOLOGPROC                        glGetShaderInfoLog;
-extern PFNGLGETSHADERIVPROC                             glGetShaderiv;
-
-// program
-extern PFNGLCREATEPROGRAMPROC                           glCreateProgram;
-extern PFNGLDELETEPROGRAMPROC                           glDeleteProgram;
-extern PFNGLISPROGRAMPROC                               glIsProgram;
-extern PFNGLPROGRAMPARAMETERIPROC                       glProgramParameteri;
-extern PFNGLATTACHSHADERPROC                            glAttachShader;
-extern PFNGLDETACHSHADERPROC                            glDetachShader;
-extern PFNGLLINKPROGRAMPROC                             glLinkProgram;
-extern PFNGLVALIDATEPROGRAMPROC                         glValidateProgram;
-extern PFNGLGETPROGRAMIVPROC                            glGetProgramiv;
-extern PFNGLGETPROGRAMINFOLOGPROC                       glGetProgramInfoLog;
-extern PFNGLUSEPROGRAMPROC                              glUseProgram;
-extern PFNGLUNIFORM1IPROC                               glUniform1i;
-extern PFNGLUNIFORM1IVPROC                              glUniform1iv;
-extern PFNGLUNIFORM1UIVPROC                             glUniform1uiv;
-
-// pipelines
-extern PFNGLBINDPROGRAMPIPELINEPROC                     glBindProgramPipeline;
-extern PFNGLCREATEPROGRAMPIPELINESPROC                  glCreateProgramPipelines;
-extern PFNGLDELETEPROGRAMPIPELINESPROC                  glDeleteProgramPipelines;
-extern PFNGLVALIDATEPROGRAMPIPELINEPROC                 glValidateProgramPipeline;
-extern PFNGLGETPROGRAMPIPELINEIVPROC                    glGetProgramPipelineiv;
-extern PFNGLGETPROGRAMPIPELINEINFOLOGPROC               glGetProgramPipelineInfoLog;
-extern PFNGLUSEPROGRAMSTAGESPROC                        glUseProgramStages;
-extern PFNGLACTIVESHADERPROGRAMPROC                     glActiveShaderProgram;
-extern PFNGLPROGRAMUNIFORM1IPROC                        glProgramUniform1i;
-extern PFNGLPROGRAMUNIFORM1IVPROC                       glProgramUniform1iv;
-extern PFNGLPROGRAMUNIFORM1UIVPROC                      glProgramUniform1uiv;
-
-// buffer
-extern PFNGLISBUFFERPROC                                glIsBuffer;
-extern PFNGLBINDBUFFERPROC                              glBindBuffer;
-extern PFNGLBINDBUFFERBASEPROC                          glBindBufferBase;
-extern PFNGLBINDBUFFERRANGEPROC                         glBindBufferRange;
-extern PFNGLCREATEBUFFERSPROC                           glCreateBuffers;
-extern PFNGLDELETEBUFFERSPROC                           glDeleteBuffers;
-extern PFNGLNAMEDBUFFERSTORAGEPROC                      glNamedBufferStorage;
-extern PFNGLMAPNAMEDBUFFERRANGEPROC                     glMapNamedBufferRange;
-extern PFNGLUNMAPNAMEDBUFFERPROC                        glUnmapNamedBuffer;
-extern PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC             glFlushMappedNamedBufferRange;
-extern PFNGLNAMEDBUFFERSUBDATAPROC                      glNamedBufferSubData;
-extern PFNGLGETNAMEDBUFFERSUBDATAPROC                   glGetNamedBufferSubData;
-extern PFNGLCOPYNAMEDBUFFERSUBDATAPROC                  glCopyNamedBufferSubData;
-
-// GL_ARB_multi_bind
-extern PFNGLBINDBUFFERSRANGEPROC                        glBindBuffersRange;
-extern PFNGLBINDBUFFERSBASEPROC                         glBindBuffersBase;
-
-// Image
-extern PFNGLBINDTEXTUREPROC						        glBindTexture;
-extern PFNGLBINDTEXTUREUNITPROC                         glBindTextureUnit;
-extern PFNGLBINDTEXTURESPROC					        glBindTextures;
-extern PFNGLCREATETEXTURESPROC					        glCreateTextures;
-extern PFNGLDELETETEXTURESPROC					        glDeleteTextures;
-extern PFNGLISTEXTUREPROC                               glIsTexture;
-extern PFNGLTEXTURESTORAGE1DPROC				        glTextureStorage1D;
-extern PFNGLTEXTURESTORAGE2DPROC				        glTextureStorage2D;
-extern PFNGLTEXTURESTORAGE3DPROC				        glTextureStorage3D;
-extern PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC		        glTextureStorage2DMultisample;
-extern PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC		        glTextureStorage3DMultisample;
-extern PFNGLTEXTURESUBIMAGE1DPROC				        glTextureSubImage1D;
-extern PFNGLTEXTURESUBIMAGE2DPROC				        glTextureSubImage2D;
-extern PFNGLTEXTURESUBIMAGE3DPROC				        glTextureSubImage3D;
-extern PFNGLCOPYTEXTURESUBIMAGE1DPROC                   glCopyTextureSubImage1D;
-extern PFNGLCOPYTEXTURESUBIMAGE2DPROC                   glCopyTextureSubImage2D;
-extern PFNGLCOPYTEXTURESUBIMAGE3DPROC                   glCopyTextureSubImage3D;
-extern PFNGLTEXTUREPARAMETERIVPROC				        glTextureParameteriv;
-extern PFNGLTEXTUREPARAMETERFVPROC				        glTextureParameterfv;
-extern PFNGLGETTEXTUREPARAMETERIVPROC                   glGetTextureParameteriv;
-extern PFNGLGETTEXTUREPARAMETERFVPROC                   glGetTextureParameterfv;
-extern PFNGLGETTEXTUREIMAGEPROC					        glGetTextureImage;
-extern PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC               glGetCompressedTextureImage;
-extern PFNGLINVALIDATETEXIMAGEPROC                      glInvalidateTexImage;
-
-// GL_ARB_compressed_texture_pixel_storage
-extern PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC             glCompressedTextureSubImage1D;
-extern PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC             glCompressedTextureSubImage2D;
-extern PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC             glCompressedTextureSubImage3D;
-
-// GL_ARB_invalidate_subdata
-extern PFNGLINVALIDATETEXSUBIMAGEPROC                   glInvalidateTexSubImage;
-
-// GL_ARB_clear_texture
-extern PFNGLCLEARTEXIMAGEPROC                           glClearTexImage;
-extern PFNGLCLEARTEXSUBIMAGEPROC                        glClearTexSubImage;
-
-// GL_ARB_get_texture_sub_image
-extern PFNGLGETTEXTURESUBIMAGEPROC                      glGetTextureSubImage;
-extern PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC            glGetCompressedTextureSubImage;
-
-// GL_ARB_copy_image
-extern PFNGLCOPYIMAGESUBDATAPROC                        glCopyImageSubData;
-
-// GL_ARB_texture_view
-extern PFNGLTEXTUREVIEWPROC                             glTextureView;
-
-// sampler
-extern PFNGLCREATESAMPLERSPROC                          glCreateSamplers;
-extern PFNGLDELETESAMPLERSPROC                          glDeleteSamplers;
-extern PFNGLBINDSAMPLERPROC                             glBindSampler;
-extern PFNGLBINDSAMPLERSPROC                            glBindSamplers;
-extern PFNGLISSAMPLERPROC                               glIsSampler;
-extern PFNGLSAMPLERPARAMETERIPROC                       glSamplerParameteri;
-extern PFNGLSAMPLERPARAMETERIVPROC                      glSamplerParameteriv;
-extern PFNGLSAMPLERPARAMETERFPROC                       glSamplerParameterf;
-extern PFNGLSAMPLERPARAMETERFVPROC                      glSamplerParameterfv;
-extern PFNGLSAMPLERPARAMETERIIVPROC                     glSamplerParameterIiv;
-extern PFNGLSAMPLERPARAMETERIUIVPROC                    glSamplerParameterIuiv;
-extern PFNGLGETSAMPLERPARAMETERIVPROC                   glGetSamplerParameteriv;
-extern PFNGLGETSAMPLERPARAMETERIIVPROC                  glGetSamplerParameterIiv;
-extern PFNGLGETSAMPLERPARAMETERFVPROC                   glGetSamplerParameterfv;
-extern PFNGLGETSAMPLERPARAMETERIUIVPROC                 glGetSamplerParameterIuiv;
-
-// texture handler
-extern PFNGLGETTEXTUREHANDLEARBPROC				        glGetTextureHandleARB;
-extern PFNGLGETTEXTURESAMPLERHANDLEARBPROC		        glGetTextureSamplerHandleARB;
-extern PFNGLMAKETEXTUREHANDLERESIDENTARBPROC	        glMakeTextureHandleResidentARB;
-extern PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC	        glMakeTextureHandleNonResidentARB;
-extern PFNGLMAKEIMAGEHANDLERESIDENTARBPROC 		        glMakeImageHandleResidentARB;
-extern PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC 	        glMakeImageHandleNonResidentARB;
-extern PFNGLUNIFORMHANDLEUI64ARBPROC 			        glUniformHandleui64ARB;
-extern PFNGLUNIFORMHANDLEUI64VARBPROC 			        glUniformHandleui64vARB;
-extern PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC 	        glProgramUniformHandleui64ARB;
-extern PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC 	        glProgramUniformHandleui64vARB;
-extern PFNGLISTEXTUREHANDLERESIDENTARBPROC		        glIsTextureHandleResidentARB;
-extern PFNGLISIMAGEHANDLERESIDENTARBPROC		        glIsImageHandleResidentARB;
-
-// GL_ARB_framebuffer_object
-extern PFNGLBINDFRAMEBUFFERPROC					        glBindFramebuffer;
-extern PFNGLDELETEFRAMEBUFFERSPROC				        glDeleteFramebuffers;
-extern PFNGLISFRAMEBUFFERPROC                           glIsFramebuffer;
-extern PFNGLCREATEFRAMEBUFFERSPROC				        glCreateFramebuffers;
-extern PFNGLNAMEDFRAMEBUFFERTEXTUREPROC			        glNamedFramebufferTexture;
-extern PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC            glNamedFramebufferTextureLayer;
-extern PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC	        glNamedFramebufferRenderbuffer;
-extern PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC		        glNamedFramebufferDrawBuffer;
-extern PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC		        glNamedFramebufferDrawBuffers;
-extern PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC		        glNamedFramebufferReadBuffer;
-extern PFNGLFRAMEBUFFERRENDERBUFFERPROC			        glFramebufferRenderbuffer;
-extern PFNGLFRAMEBUFFERTEXTURE1DPROC			        glFramebufferTexture1D;
-extern PFNGLFRAMEBUFFERTEXTURE2DPROC			        glFramebufferTexture2D;
-extern PFNGLFRAMEBUFFERTEXTURE3DPROC			        glFramebufferTexture3D;
-extern PFNGLFRAMEBUFFERTEXTURELAYERPROC			        glFramebufferTextureLayer;
-extern PFNGLFRAMEBUFFERTEXTUREPROC				        glFramebufferTexture;
-extern PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC		        glCheckNamedFramebufferStatus;
-extern PFNGLBLITNAMEDFRAMEBUFFERPROC                    glBlitNamedFramebuffer;
-
-// renderbuffers 
-extern PFNGLISRENDERBUFFERPROC                          glIsRenderbuffer;
-extern PFNGLCREATERENDERBUFFERSPROC                     glCreateRenderbuffers;
-extern PFNGLDELETERENDERBUFFERSPROC                     glDeleteRenderbuffers;
-extern PFNGLNAMEDRENDERBUFFERSTORAGEPROC                glNamedRenderbufferStorage;
-extern PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC     glNamedRenderbufferStorageMultisample;
-extern PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC         glGetNamedRenderbufferParameteriv;
-
-// GL_ARB_sync
-extern PFNGLISSYNCPROC                                  glIsSync;
-extern PFNGLFENCESYNCPROC                               glFenceSync;
-extern PFNGLCLIENTWAITSYNCPROC                          glClientWaitSync;
-extern PFNGLDELETESYNCPROC                              glDeleteSync;
-extern PFNGLWAITSYNCPROC                                glWaitSync;
-extern PFNGLGETSYNCIVPROC                               glGetSynciv;
-
-// GL_ARB_viewport_array
-extern PFNGLVIEWPORTARRAYVPROC                          glViewportArrayv;
-extern PFNGLSCISSORARRAYVPROC                           glScissorArrayv;
-extern PFNGLVIEWPORTINDEXEDFPROC                        glViewportIndexedf;
-extern PFNGLDEPTHRANGEARRAYVPROC                        glDepthRangeArrayv;
-extern PFNGLDEPTHRANGEINDEXEDPROC                       glDepthRangeIndexed;
+#include "crglFunctions.hpp"
 
 typedef struct glCoreBuffer_t                           glCoreBuffer_t;
 typedef struct glCoreShader_t                           glCoreShader_t;
@@ -335,9 +44,27 @@ typedef struct glCoreRenderbuffer_t                     glCoreRenderbuffer_t;
 #include "crglFormat.hpp"
 #include "crglSampler.hpp"
 #include "crglTexture.hpp"
+#include "crglTextureAtlas.hpp"
+#include "crglTextureUploader.hpp"
+#include "crglMipGenerator.hpp"
+#include "crglBlockEncoder.hpp"
+#include "crglMipStreamer.hpp"
+#include "crglVirtualTexture.hpp"
 #include "crglImageHandler.hpp"
 #include "crglFrameBuffer.hpp"
+#include "crglRenderTargetPool.hpp"
+#include "crglRenderGraph.hpp"
+#include "crglFrameReader.hpp"
+#include "crglYuvConverter.hpp"
+#include "crglVideoTexture.hpp"
+#include "crglDebugLogger.hpp"
+#include "crglMemoryTracker.hpp"
 #include "crglContext.hpp"
+#include "crglFrameBufferCache.hpp"
+#include "crglMsaaTarget.hpp"
+#include "crglRenderPass.hpp"
+#include "crglRenderFarm.hpp"
+#include "crglTiledRenderer.hpp"
 
 #ifdef USE_EGL_CONTEXT
 #include "creglContext.hpp"
@@ -0,0 +1,91 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#ifndef __CRGL_DEBUG_LOGGER_HPP__
+#define __CRGL_DEBUG_LOGGER_HPP__
+
+typedef struct glCoreDebugLogger_t  glCoreDebugLogger_t;
+
+namespace gl
+{
+    class Context;
+
+    /// @brief how the context handle the driver debug output
+    enum debugMode_t
+    {
+        DEBUG_OFF = 0,          // GL_DEBUG_OUTPUT disabled, no callback installed
+        DEBUG_ASYNC,            // raw messages are queued and formated on a logger thread
+        DEBUG_SYNCHRONOUS       // messages are formated inline, on the offending call ( GL_DEBUG_OUTPUT_SYNCHRONOUS )
+    };
+
+    typedef struct debugConfig_t
+    {
+        /// @brief debug output operation mode
+        debugMode_t     mode = DEBUG_ASYNC;
+
+        /// @brief messages less severe than this are discarded before any formating
+        /// GL_DEBUG_SEVERITY_NOTIFICATION / GL_DEBUG_SEVERITY_LOW / GL_DEBUG_SEVERITY_MEDIUM / GL_DEBUG_SEVERITY_HIGH
+        GLenum          minSeverity = GL_DEBUG_SEVERITY_NOTIFICATION;
+
+        /// @brief async message ring capacity, rounded up to a power of two
+        GLuint          queueSize = 1024;
+
+        /// @brief minimum interval, in milliseconds, between two "repeated" reports of the same message
+        GLuint          repeatInterval = 1000;
+    } debugConfig_t;
+
+    /// @brief Drain the driver debug messages out of the driver thread.
+    /// The driver callback push the raw message in a lock-free ring and wake the logger thread if it sleep,
+    /// the logger thread deduplicate ( by id and text ), format and forward it to Context::DebugOuput
+    class DebugLogger
+    {
+    public:
+        DebugLogger( void );
+        ~DebugLogger( void );
+
+        /// @brief allocate the message ring and start the logger thread
+        /// @param in_context the context that will receive the formated messages
+        /// @param in_config debug configuration
+        /// @return true on sucess
+        bool    Start( const Context* in_context, const debugConfig_t* in_config );
+
+        /// @brief flush the pending messages and join the logger thread
+        void    Stop( void );
+
+        /// @brief queue a raw driver message, safe to call from any thread
+        /// @return false if the ring is full, the message are counted as dropped
+        bool    Push( const GLenum in_source, const GLenum in_type, const GLuint in_id, const GLenum in_severity, const GLsizei in_length, const GLchar* in_message ) const;
+
+        /// @brief number of messages lost because the ring was full
+        uint64_t    Dropped( void ) const;
+
+        /// @brief check if a message severity pass the severity filter
+        static bool Accept( const GLenum in_severity, const GLenum in_minSeverity );
+
+        /// @brief build the human readable message
+        static void Format( const GLenum in_source, const GLenum in_type, const GLuint in_id, const GLenum in_severity, const GLchar* in_message, char* in_buffer, const GLsizei in_size );
+
+    private:
+        glCoreDebugLogger_t*    m_logger;
+    };
+};
+
+#endif //!__CRGL_DEBUG_LOGGER_HPP__
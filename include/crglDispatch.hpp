@@ -0,0 +1,279 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#ifndef __CRGL_DISPATCH_HPP__
+#define __CRGL_DISPATCH_HPP__
+
+#include "crglCore.hpp"
+
+/// free function style, the gl* names call through the dispatch table of the thread current context.
+/// Opt-in: the library sources use it, include it only where the gl* names aren't declared by 
+/// other means ( GL_GLEXT_PROTOTYPES, a loader ), the macros would replace them.
+/// Whit no context current the calls go to gl::k_NO_CONTEXT_DISPATCH
+
+#define glGetIntegerv                                    gl::CurrentDispatch()->GetIntegerv
+#define glGetInteger64v                                  gl::CurrentDispatch()->GetInteger64v
+#define glIsEnabled                                      gl::CurrentDispatch()->IsEnabled
+#define glDisable                                        gl::CurrentDispatch()->Disable
+#define glEnable                                         gl::CurrentDispatch()->Enable
+#define glEnablei                                        gl::CurrentDispatch()->Enablei
+#define glDisablei                                       gl::CurrentDispatch()->Disablei
+#define glFinish                                         gl::CurrentDispatch()->Finish
+#define glFlush                                          gl::CurrentDispatch()->Flush
+#define glGetError                                       gl::CurrentDispatch()->GetError
+#define glGetString                                      gl::CurrentDispatch()->GetString
+#define glGetStringi                                     gl::CurrentDispatch()->GetStringi
+#define glGetBooleanv                                    gl::CurrentDispatch()->GetBooleanv
+#define glGetBooleani_v                                  gl::CurrentDispatch()->GetBooleani_v
+#define glHint                                           gl::CurrentDispatch()->Hint
+#define glViewport                                       gl::CurrentDispatch()->Viewport
+#define glScissor                                        gl::CurrentDispatch()->Scissor
+#define glReadPixels                                     gl::CurrentDispatch()->ReadPixels
+#define glPixelStorei                                    gl::CurrentDispatch()->PixelStorei
+#define glClear                                          gl::CurrentDispatch()->Clear
+#define glClearColor                                     gl::CurrentDispatch()->ClearColor
+#define glColorMask                                      gl::CurrentDispatch()->ColorMask
+#define glColorMaski                                     gl::CurrentDispatch()->ColorMaski
+#define glBlendFunc                                      gl::CurrentDispatch()->BlendFunc
+#define glBlendFuncSeparate                              gl::CurrentDispatch()->BlendFuncSeparate
+#define glLogicOp                                        gl::CurrentDispatch()->LogicOp
+#define glBlendEquationSeparatei                         gl::CurrentDispatch()->BlendEquationSeparatei
+#define glBlendFuncSeparatei                             gl::CurrentDispatch()->BlendFuncSeparatei
+#define glDepthRange                                     gl::CurrentDispatch()->DepthRange
+#define glClearDepth                                     gl::CurrentDispatch()->ClearDepth
+#define glDepthMask                                      gl::CurrentDispatch()->DepthMask
+#define glDepthFunc                                      gl::CurrentDispatch()->DepthFunc
+#define glPolygonOffset                                  gl::CurrentDispatch()->PolygonOffset
+#define glClearStencil                                   gl::CurrentDispatch()->ClearStencil
+#define glStencilMask                                    gl::CurrentDispatch()->StencilMask
+#define glStencilFunc                                    gl::CurrentDispatch()->StencilFunc
+#define glStencilOp                                      gl::CurrentDispatch()->StencilOp
+#define glStencilFuncSeparate                            gl::CurrentDispatch()->StencilFuncSeparate
+#define glStencilOpSeparate                              gl::CurrentDispatch()->StencilOpSeparate
+#define glStencilMaskSeparate                            gl::CurrentDispatch()->StencilMaskSeparate
+#define glLineWidth                                      gl::CurrentDispatch()->LineWidth
+#define glPointSize                                      gl::CurrentDispatch()->PointSize
+#define glPolygonMode                                    gl::CurrentDispatch()->PolygonMode
+#define glCullFace                                       gl::CurrentDispatch()->CullFace
+#define glDrawArrays                                     gl::CurrentDispatch()->DrawArrays
+#define glDrawElements                                   gl::CurrentDispatch()->DrawElements
+#define glMultiDrawArrays                                gl::CurrentDispatch()->MultiDrawArrays
+#define glMultiDrawElements                              gl::CurrentDispatch()->MultiDrawElements
+#define glDrawElementsBaseVertex                         gl::CurrentDispatch()->DrawElementsBaseVertex
+#define glDrawRangeElementsBaseVertex                    gl::CurrentDispatch()->DrawRangeElementsBaseVertex
+#define glMultiDrawElementsBaseVertex                    gl::CurrentDispatch()->MultiDrawElementsBaseVertex
+#define glDrawArraysInstanced                            gl::CurrentDispatch()->DrawArraysInstanced
+#define glDrawElementsInstanced                          gl::CurrentDispatch()->DrawElementsInstanced
+#define glDrawElementsInstancedBaseVertex                gl::CurrentDispatch()->DrawElementsInstancedBaseVertex
+#define glDrawArraysInstancedBaseInstance                gl::CurrentDispatch()->DrawArraysInstancedBaseInstance
+#define glDrawElementsInstancedBaseInstance              gl::CurrentDispatch()->DrawElementsInstancedBaseInstance
+#define glDrawElementsInstancedBaseVertexBaseInstance    gl::CurrentDispatch()->DrawElementsInstancedBaseVertexBaseInstance
+#define glDrawArraysIndirect                             gl::CurrentDispatch()->DrawArraysIndirect
+#define glDrawElementsIndirect                           gl::CurrentDispatch()->DrawElementsIndirect
+#define glMultiDrawArraysIndirect                        gl::CurrentDispatch()->MultiDrawArraysIndirect
+#define glMultiDrawElementsIndirect                      gl::CurrentDispatch()->MultiDrawElementsIndirect
+#define glMultiDrawArraysIndirectCount                   gl::CurrentDispatch()->MultiDrawArraysIndirectCount
+#define glMultiDrawElementsIndirectCount                 gl::CurrentDispatch()->MultiDrawElementsIndirectCount
+#define glDrawTransformFeedback                          gl::CurrentDispatch()->DrawTransformFeedback
+#define glDrawTransformFeedbackStream                    gl::CurrentDispatch()->DrawTransformFeedbackStream
+#define glDrawTransformFeedbackInstanced                 gl::CurrentDispatch()->DrawTransformFeedbackInstanced
+#define glDrawTransformFeedbackStreamInstanced           gl::CurrentDispatch()->DrawTransformFeedbackStreamInstanced
+#define glDebugMessageControl                            gl::CurrentDispatch()->DebugMessageControl
+#define glDebugMessageCallback                           gl::CurrentDispatch()->DebugMessageCallback
+#define glGetDebugMessageLog                             gl::CurrentDispatch()->GetDebugMessageLog
+#define glDebugMessageInsert                             gl::CurrentDispatch()->DebugMessageInsert
+#define glObjectLabel                                    gl::CurrentDispatch()->ObjectLabel
+#define glGetObjectLabel                                 gl::CurrentDispatch()->GetObjectLabel
+#define glObjectPtrLabel                                 gl::CurrentDispatch()->ObjectPtrLabel
+#define glGetObjectPtrLabel                              gl::CurrentDispatch()->GetObjectPtrLabel
+#define glIsVertexArray                                  gl::CurrentDispatch()->IsVertexArray
+#define glCreateVertexArrays                             gl::CurrentDispatch()->CreateVertexArrays
+#define glDeleteVertexArrays                             gl::CurrentDispatch()->DeleteVertexArrays
+#define glBindVertexArray                                gl::CurrentDispatch()->BindVertexArray
+#define glEnableVertexArrayAttrib                        gl::CurrentDispatch()->EnableVertexArrayAttrib
+#define glDisableVertexArrayAttrib                       gl::CurrentDispatch()->DisableVertexArrayAttrib
+#define glVertexArrayAttribBinding                       gl::CurrentDispatch()->VertexArrayAttribBinding
+#define glVertexArrayAttribFormat                        gl::CurrentDispatch()->VertexArrayAttribFormat
+#define glVertexArrayElementBuffer                       gl::CurrentDispatch()->VertexArrayElementBuffer
+#define glVertexArrayVertexBuffer                        gl::CurrentDispatch()->VertexArrayVertexBuffer
+#define glVertexArrayVertexBuffers                       gl::CurrentDispatch()->VertexArrayVertexBuffers
+#define glIsShader                                       gl::CurrentDispatch()->IsShader
+#define glCreateShader                                   gl::CurrentDispatch()->CreateShader
+#define glDeleteShader                                   gl::CurrentDispatch()->DeleteShader
+#define glShaderSource                                   gl::CurrentDispatch()->ShaderSource
+#define glShaderBinary                                   gl::CurrentDispatch()->ShaderBinary
+#define glCompileShader                                  gl::CurrentDispatch()->CompileShader
+#define glSpecializeShader                               gl::CurrentDispatch()->SpecializeShader
+#define glGetShaderInfoLog                               gl::CurrentDispatch()->GetShaderInfoLog
+#define glGetShaderiv                                    gl::CurrentDispatch()->GetShaderiv
+#define glCreateProgram                                  gl::CurrentDispatch()->CreateProgram
+#define glDeleteProgram                                  gl::CurrentDispatch()->DeleteProgram
+#define glIsProgram                                      gl::CurrentDispatch()->IsProgram
+#define glProgramParameteri                              gl::CurrentDispatch()->ProgramParameteri
+#define glAttachShader                                   gl::CurrentDispatch()->AttachShader
+#define glDetachShader                                   gl::CurrentDispatch()->DetachShader
+#define glLinkProgram                                    gl::CurrentDispatch()->LinkProgram
+#define glValidateProgram                                gl::CurrentDispatch()->ValidateProgram
+#define glGetProgramiv                                   gl::CurrentDispatch()->GetProgramiv
+#define glGetProgramInfoLog                              gl::CurrentDispatch()->GetProgramInfoLog
+#define glUseProgram                                     gl::CurrentDispatch()->UseProgram
+#define glUniform1i                                      gl::CurrentDispatch()->Uniform1i
+#define glUniform1iv                                     gl::CurrentDispatch()->Uniform1iv
+#define glUniform1uiv                                    gl::CurrentDispatch()->Uniform1uiv
+#define glBindProgramPipeline                            gl::CurrentDispatch()->BindProgramPipeline
+#define glCreateProgramPipelines                         gl::CurrentDispatch()->CreateProgramPipelines
+#define glDeleteProgramPipelines                         gl::CurrentDispatch()->DeleteProgramPipelines
+#define glValidateProgramPipeline                        gl::CurrentDispatch()->ValidateProgramPipeline
+#define glGetProgramPipelineiv                           gl::CurrentDispatch()->GetProgramPipelineiv
+#define glGetProgramPipelineInfoLog                      gl::CurrentDispatch()->GetProgramPipelineInfoLog
+#define glUseProgramStages                               gl::CurrentDispatch()->UseProgramStages
+#define glActiveShaderProgram                            gl::CurrentDispatch()->ActiveShaderProgram
+#define glProgramUniform1i                               gl::CurrentDispatch()->ProgramUniform1i
+#define glProgramUniform1iv                              gl::CurrentDispatch()->ProgramUniform1iv
+#define glProgramUniform1uiv                             gl::CurrentDispatch()->ProgramUniform1uiv
+#define glIsBuffer                                       gl::CurrentDispatch()->IsBuffer
+#define glBindBuffer                                     gl::CurrentDispatch()->BindBuffer
+#define glBindBufferBase                                 gl::CurrentDispatch()->BindBufferBase
+#define glBindBufferRange                                gl::CurrentDispatch()->BindBufferRange
+#define glCreateBuffers                                  gl::CurrentDispatch()->CreateBuffers
+#define glDeleteBuffers                                  gl::CurrentDispatch()->DeleteBuffers
+#define glNamedBufferStorage                             gl::CurrentDispatch()->NamedBufferStorage
+#define glMapNamedBufferRange                            gl::CurrentDispatch()->MapNamedBufferRange
+#define glUnmapNamedBuffer                               gl::CurrentDispatch()->UnmapNamedBuffer
+#define glFlushMappedNamedBufferRange                    gl::CurrentDispatch()->FlushMappedNamedBufferRange
+#define glNamedBufferSubData                             gl::CurrentDispatch()->NamedBufferSubData
+#define glGetNamedBufferSubData                          gl::CurrentDispatch()->GetNamedBufferSubData
+#define glCopyNamedBufferSubData                         gl::CurrentDispatch()->CopyNamedBufferSubData
+#define glBindBuffersRange                               gl::CurrentDispatch()->BindBuffersRange
+#define glBindBuffersBase                                gl::CurrentDispatch()->BindBuffersBase
+#define glBindTexture                                    gl::CurrentDispatch()->BindTexture
+#define glBindTextures                                   gl::CurrentDispatch()->BindTextures
+#define glBindTextureUnit                                gl::CurrentDispatch()->BindTextureUnit
+#define glCreateTextures                                 gl::CurrentDispatch()->CreateTextures
+#define glDeleteTextures                                 gl::CurrentDispatch()->DeleteTextures
+#define glIsTexture                                      gl::CurrentDispatch()->IsTexture
+#define glTextureStorage1D                               gl::CurrentDispatch()->TextureStorage1D
+#define glTextureStorage2D                               gl::CurrentDispatch()->TextureStorage2D
+#define glTextureStorage3D                               gl::CurrentDispatch()->TextureStorage3D
+#define glTextureStorage2DMultisample                    gl::CurrentDispatch()->TextureStorage2DMultisample
+#define glTextureStorage3DMultisample                    gl::CurrentDispatch()->TextureStorage3DMultisample
+#define glTextureSubImage1D                              gl::CurrentDispatch()->TextureSubImage1D
+#define glTextureSubImage2D                              gl::CurrentDispatch()->TextureSubImage2D
+#define glTextureSubImage3D                              gl::CurrentDispatch()->TextureSubImage3D
+#define glCopyTextureSubImage1D                          gl::CurrentDispatch()->CopyTextureSubImage1D
+#define glCopyTextureSubImage2D                          gl::CurrentDispatch()->CopyTextureSubImage2D
+#define glCopyTextureSubImage3D                          gl::CurrentDispatch()->CopyTextureSubImage3D
+#define glTextureParameteri                              gl::CurrentDispatch()->TextureParameteri
+#define glTextureParameterf                              gl::CurrentDispatch()->TextureParameterf
+#define glTextureParameteriv                             gl::CurrentDispatch()->TextureParameteriv
+#define glTextureParameterfv                             gl::CurrentDispatch()->TextureParameterfv
+#define glGetTextureParameteriv                          gl::CurrentDispatch()->GetTextureParameteriv
+#define glGetTextureParameterfv                          gl::CurrentDispatch()->GetTextureParameterfv
+#define glGetTextureLevelParameterfv                     gl::CurrentDispatch()->GetTextureLevelParameterfv
+#define glGetTextureLevelParameteriv                     gl::CurrentDispatch()->GetTextureLevelParameteriv
+#define glGetInternalformativ                            gl::CurrentDispatch()->GetInternalformativ
+#define glGetTextureImage                                gl::CurrentDispatch()->GetTextureImage
+#define glGetCompressedTextureImage                      gl::CurrentDispatch()->GetCompressedTextureImage
+#define glInvalidateTexImage                             gl::CurrentDispatch()->InvalidateTexImage
+#define glCompressedTextureSubImage1D                    gl::CurrentDispatch()->CompressedTextureSubImage1D
+#define glCompressedTextureSubImage2D                    gl::CurrentDispatch()->CompressedTextureSubImage2D
+#define glCompressedTextureSubImage3D                    gl::CurrentDispatch()->CompressedTextureSubImage3D
+#define glInvalidateTexSubImage                          gl::CurrentDispatch()->InvalidateTexSubImage
+#define glClearTexImage                                  gl::CurrentDispatch()->ClearTexImage
+#define glClearTexSubImage                               gl::CurrentDispatch()->ClearTexSubImage
+#define glGetTextureSubImage                             gl::CurrentDispatch()->GetTextureSubImage
+#define glGetCompressedTextureSubImage                   gl::CurrentDispatch()->GetCompressedTextureSubImage
+#define glCopyImageSubData                               gl::CurrentDispatch()->CopyImageSubData
+#define glTextureView                                    gl::CurrentDispatch()->TextureView
+#define glCreateSamplers                                 gl::CurrentDispatch()->CreateSamplers
+#define glDeleteSamplers                                 gl::CurrentDispatch()->DeleteSamplers
+#define glBindSampler                                    gl::CurrentDispatch()->BindSampler
+#define glBindSamplers                                   gl::CurrentDispatch()->BindSamplers
+#define glIsSampler                                      gl::CurrentDispatch()->IsSampler
+#define glSamplerParameteri                              gl::CurrentDispatch()->SamplerParameteri
+#define glSamplerParameteriv                             gl::CurrentDispatch()->SamplerParameteriv
+#define glSamplerParameterf                              gl::CurrentDispatch()->SamplerParameterf
+#define glSamplerParameterfv                             gl::CurrentDispatch()->SamplerParameterfv
+#define glSamplerParameterIiv                            gl::CurrentDispatch()->SamplerParameterIiv
+#define glSamplerParameterIuiv                           gl::CurrentDispatch()->SamplerParameterIuiv
+#define glGetSamplerParameteriv                          gl::CurrentDispatch()->GetSamplerParameteriv
+#define glGetSamplerParameterIiv                         gl::CurrentDispatch()->GetSamplerParameterIiv
+#define glGetSamplerParameterfv                          gl::CurrentDispatch()->GetSamplerParameterfv
+#define glGetSamplerParameterIuiv                        gl::CurrentDispatch()->GetSamplerParameterIuiv
+#define glGetTextureHandleARB                            gl::CurrentDispatch()->GetTextureHandleARB
+#define glGetTextureSamplerHandleARB                     gl::CurrentDispatch()->GetTextureSamplerHandleARB
+#define glMakeTextureHandleResidentARB                   gl::CurrentDispatch()->MakeTextureHandleResidentARB
+#define glMakeTextureHandleNonResidentARB                gl::CurrentDispatch()->MakeTextureHandleNonResidentARB
+#define glMakeImageHandleResidentARB                     gl::CurrentDispatch()->MakeImageHandleResidentARB
+#define glMakeImageHandleNonResidentARB                  gl::CurrentDispatch()->MakeImageHandleNonResidentARB
+#define glUniformHandleui64ARB                           gl::CurrentDispatch()->UniformHandleui64ARB
+#define glUniformHandleui64vARB                          gl::CurrentDispatch()->UniformHandleui64vARB
+#define glProgramUniformHandleui64ARB                    gl::CurrentDispatch()->ProgramUniformHandleui64ARB
+#define glProgramUniformHandleui64vARB                   gl::CurrentDispatch()->ProgramUniformHandleui64vARB
+#define glIsTextureHandleResidentARB                     gl::CurrentDispatch()->IsTextureHandleResidentARB
+#define glIsImageHandleResidentARB                       gl::CurrentDispatch()->IsImageHandleResidentARB
+#define glTexturePageCommitmentEXT                       gl::CurrentDispatch()->TexturePageCommitmentEXT
+#define glBindFramebuffer                                gl::CurrentDispatch()->BindFramebuffer
+#define glIsFramebuffer                                  gl::CurrentDispatch()->IsFramebuffer
+#define glDeleteFramebuffers                             gl::CurrentDispatch()->DeleteFramebuffers
+#define glCreateFramebuffers                             gl::CurrentDispatch()->CreateFramebuffers
+#define glNamedFramebufferTexture                        gl::CurrentDispatch()->NamedFramebufferTexture
+#define glNamedFramebufferTextureLayer                   gl::CurrentDispatch()->NamedFramebufferTextureLayer
+#define glNamedFramebufferRenderbuffer                   gl::CurrentDispatch()->NamedFramebufferRenderbuffer
+#define glNamedFramebufferDrawBuffer                     gl::CurrentDispatch()->NamedFramebufferDrawBuffer
+#define glNamedFramebufferDrawBuffers                    gl::CurrentDispatch()->NamedFramebufferDrawBuffers
+#define glNamedFramebufferReadBuffer                     gl::CurrentDispatch()->NamedFramebufferReadBuffer
+#define glFramebufferRenderbuffer                        gl::CurrentDispatch()->FramebufferRenderbuffer
+#define glFramebufferTexture1D                           gl::CurrentDispatch()->FramebufferTexture1D
+#define glFramebufferTexture2D                           gl::CurrentDispatch()->FramebufferTexture2D
+#define glFramebufferTexture3D                           gl::CurrentDispatch()->FramebufferTexture3D
+#define glFramebufferTextureLayer                        gl::CurrentDispatch()->FramebufferTextureLayer
+#define glFramebufferTexture                             gl::CurrentDispatch()->FramebufferTexture
+#define glCheckNamedFramebufferStatus                    gl::CurrentDispatch()->CheckNamedFramebufferStatus
+#define glBlitNamedFramebuffer                           gl::CurrentDispatch()->BlitNamedFramebuffer
+#define glInvalidateNamedFramebufferData                 gl::CurrentDispatch()->InvalidateNamedFramebufferData
+#define glClearNamedFramebufferiv                        gl::CurrentDispatch()->ClearNamedFramebufferiv
+#define glClearNamedFramebufferuiv                       gl::CurrentDispatch()->ClearNamedFramebufferuiv
+#define glClearNamedFramebufferfv                        gl::CurrentDispatch()->ClearNamedFramebufferfv
+#define glClearNamedFramebufferfi                        gl::CurrentDispatch()->ClearNamedFramebufferfi
+#define glInvalidateNamedFramebufferSubData              gl::CurrentDispatch()->InvalidateNamedFramebufferSubData
+#define glIsRenderbuffer                                 gl::CurrentDispatch()->IsRenderbuffer
+#define glCreateRenderbuffers                            gl::CurrentDispatch()->CreateRenderbuffers
+#define glDeleteRenderbuffers                            gl::CurrentDispatch()->DeleteRenderbuffers
+#define glNamedRenderbufferStorage                       gl::CurrentDispatch()->NamedRenderbufferStorage
+#define glNamedRenderbufferStorageMultisample            gl::CurrentDispatch()->NamedRenderbufferStorageMultisample
+#define glGetNamedRenderbufferParameteriv                gl::CurrentDispatch()->GetNamedRenderbufferParameteriv
+#define glIsSync                                         gl::CurrentDispatch()->IsSync
+#define glFenceSync                                      gl::CurrentDispatch()->FenceSync
+#define glClientWaitSync                                 gl::CurrentDispatch()->ClientWaitSync
+#define glDeleteSync                                     gl::CurrentDispatch()->DeleteSync
+#define glWaitSync                                       gl::CurrentDispatch()->WaitSync
+#define glGetSynciv                                      gl::CurrentDispatch()->GetSynciv
+#define glDispatchCompute                                gl::CurrentDispatch()->DispatchCompute
+#define glMemoryBarrier                                  gl::CurrentDispatch()->MemoryBarrier
+#define glBindImageTexture                               gl::CurrentDispatch()->BindImageTexture
+#define glViewportArrayv                                 gl::CurrentDispatch()->ViewportArrayv
+#define glScissorArrayv                                  gl::CurrentDispatch()->ScissorArrayv
+#define glViewportIndexedf                               gl::CurrentDispatch()->ViewportIndexedf
+#define glDepthRangeArrayv                               gl::CurrentDispatch()->DepthRangeArrayv
+#define glDepthRangeIndexed                              gl::CurrentDispatch()->DepthRangeIndexed
+
+#endif //!__CRGL_DISPATCH_HPP__
@@ -22,125 +22,97 @@
 #ifndef __CRGL_FORMAT_HPP__
 #define __CRGL_FORMAT_HPP__
 
-// internal formats
-// GL_R8
-// GL_R16
-// GL_R16I
-// GL_R16UI
-// GL_R16_SNORM
-// GL_R16F
-// GL_R32F
-// GL_R32I
-// GL_R32UI
-// GL_RG8
-// GL_RG8I
-// GL_RG8UI
-// GL_RG8_SNORM
-// GL_RG16
-// GL_RG16I
-// GL_RG16UI
-// GL_RG16_SNORM
-// GL_RG16F
-// GL_RG32F
-// GL_RG32I
-// GL_RG32UI
-// GL_RGB8
-// GL_RGB8I
-// GL_RGB8UI
-// GL_RGB8_SNORM
-// GL_SRGB8
-// GL_RGB16
-// GL_RGB16I
-// GL_RGB16UI
-// GL_RGB16_SNORM
-// GL_RGB16F
-// GL_RGB32I
-// GL_RGB32UI
-// GL_RGB32F
-// GL_R3_G3_B2
-// GL_R11F_G11F_B10F
-// GL_RGB9_E5
-// GL_RGB4
-// GL_RGB5
-// GL_RGB565
-// GL_RGB10
-// GL_RGB12
-// GL_RGBA8
-// GL_RGBA8I
-// GL_RGBA8UI
-// GL_RGBA8_SNORM
-// GL_SRGB8_ALPHA8
-// GL_RGBA16
-// GL_RGBA16I
-// GL_RGBA16UI
-// GL_RGBA16_SNORM
-// GL_RGBA16F
-// GL_RGBA32I
-// GL_RGBA32UI
-// GL_RGBA32F
-// GL_RGBA2
-// GL_RGBA4
-// GL_RGB5_A1
-// GL_RGB10_A2
-// GL_RGB10_A2UI
-// GL_RGBA12
-// GL_DEPTH_COMPONENT16
-// GL_DEPTH_COMPONENT24
-// GL_DEPTH_COMPONENT32
-// GL_DEPTH_COMPONENT32F
-// GL_DEPTH24_STENCIL8
-// GL_DEPTH32F_STENCIL8
-// GL_STENCIL_INDEX1
-// GL_STENCIL_INDEX4
-// GL_STENCIL_INDEX8
-// GL_STENCIL_INDEX16
-// GL_COMPRESSED_RED
-// GL_COMPRESSED_RED_RGTC1
-// GL_COMPRESSED_SIGNED_RED_RGTC1
-// GL_COMPRESSED_R11_EAC
-// GL_COMPRESSED_SIGNED_R11_EAC
-// GL_COMPRESSED_RG11_EAC
-// GL_COMPRESSED_RG
-// GL_COMPRESSED_RG_RGTC2
-// GL_COMPRESSED_SIGNED_RG_RGTC2
-// GL_COMPRESSED_SIGNED_RG11_EAC
-// GL_COMPRESSED_RGB
-// GL_COMPRESSED_SRGB
-// GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT
-// GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT
-// GL_COMPRESSED_RGB8_ETC2
-// GL_COMPRESSED_SRGB8_ETC2
-// GL_COMPRESSED_RGB_S3TC_DXT1_EXT
-// GL_COMPRESSED_RGBA
-// GL_COMPRESSED_SRGB_ALPHA
-// GL_COMPRESSED_RGBA_BPTC_UNORM
-// GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM
-// GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2
-// GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2
-// GL_COMPRESSED_RGBA8_ETC2_EAC
-// GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC
-// GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
-// GL_COMPRESSED_RGBA_S3TC_DXT3_EXT
-// GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+// the supported internal formats are listed in the format table, see crglFormat.cpp
+
+// EXT_texture_sRGB S3TC formats, not part of the core profile header
+#ifndef GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_SRGB_S3TC_DXT1_EXT        0x8C4C
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT  0x8C4D
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT  0x8C4E
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT  0x8C4F
+#endif
 
 namespace gl
 {
+    enum formatFlags_t
+    {
+        FORMAT_SRGB         = 1 << 0,   // color are stored in sRGB space
+        FORMAT_DEPTH        = 1 << 1,   // have a depth component
+        FORMAT_STENCIL      = 1 << 2,   // have a stencil component
+        FORMAT_INTEGER      = 1 << 3,   // non normalized integer, use the *_INTEGER transfer formats
+        FORMAT_COMPRESSED   = 1 << 4,   // block compressed
+        FORMAT_GENERIC      = 1 << 5    // generic compressed, the driver choose the storage, sizes are unknow
+    };
+
+    /// @brief static description of a internal format
+    typedef struct formatInfo_t
+    {
+        GLenum      internalFormat; // sized internal format
+        GLenum      channels;       // pixel transfer format
+        GLenum      inverse;        // pixel transfer format whit the color order inverted ( BGR / BGRA )
+        GLenum      type;           // pixel transfer type
+        GLubyte     components;     // number of components
+        GLubyte     bytesPerPixel;  // pixel transfer size, 0 for compressed formats
+        GLubyte     blockWidth;     // block dimensions, 1x1 for uncompressed formats
+        GLubyte     blockHeight;
+        GLubyte     bytesPerBlock;  // block size, 0 for generic compressed formats
+        GLubyte     flags;          // formatFlags_t
+        GLubyte     bytesPerTexel;  // storage size, the transfer size padded to what the drivers usually allocate, 0 for compressed formats
+    } formatInfo_t;
+
     struct Format
     {
         GLenum internalFormat;  // pixel depth
-        GLenum format;          // RGBA format
+        GLenum format;          // RGBA format, GL_NONE to use the format table transfer format
 
-        Format( void ) : internalFormat( GL_NONE )
+        Format( void ) : internalFormat( GL_NONE ), format( GL_NONE )
         {
         }
 
-        Format( const GLenum &in_format ) : internalFormat( in_format )
+        Format( const GLenum &in_format ) : internalFormat( in_format ), format( GL_NONE )
         {
         }
 
+        /// @brief find the table description of a internal format
+        /// @return nullptr for unknow formats
+        static const formatInfo_t*  Find( const GLenum in_internalFormat );
+
+        /// @brief table description of this format, nullptr if unknow
+        const formatInfo_t* Info( void ) const { return Find( internalFormat ); }
+
         GLuint  BytesPerPixel( void ) const;
+        GLuint  BytesPerTexel( void ) const;
         GLenum  ColorChanels( const bool in_inverse ) const;
         GLenum  DataType( void ) const;
+        GLuint  Components( void ) const;
+        GLuint  BlockWidth( void ) const;
+        GLuint  BlockHeight( void ) const;
+        GLuint  BytesPerBlock( void ) const;
+
+        /// @brief the transfer format to use, the user set one or the table one
+        GLenum  TransferFormat( void ) const { return ( format != GL_NONE ) ? format : ColorChanels( false ); }
+
+        bool    IsSRGB( void ) const { return HasFlags( FORMAT_SRGB ); }
+        bool    IsDepth( void ) const { return HasFlags( FORMAT_DEPTH ); }
+        bool    IsStencil( void ) const { return HasFlags( FORMAT_STENCIL ); }
+        bool    IsInteger( void ) const { return HasFlags( FORMAT_INTEGER ); }
+        bool    IsCompressed( void ) const { return HasFlags( FORMAT_COMPRESSED ); }
+        bool    IsGeneric( void ) const { return HasFlags( FORMAT_GENERIC ); }
+        bool    HasFlags( const GLuint in_flags ) const;
+
+        /// @brief size in bytes of a image, rounded up to whole blocks
+        /// @return 0 for unknow or generic compressed formats
+        uint64_t    ImageSize( const GLsizei in_width, const GLsizei in_height, const GLsizei in_depth ) const;
+
+        /// @brief size in bytes of a mipmap level of a image whit the given base dimensions
+        uint64_t    LevelSize( const GLsizei in_width, const GLsizei in_height, const GLsizei in_depth, const GLint in_level ) const;
+
+        /// @brief memory a image take on the GPU, like ImageSize but whit the padded texel size
+        /// this is a estimation, the driver is free to store the texels as it want
+        uint64_t    StorageSize( const GLsizei in_width, const GLsizei in_height, const GLsizei in_depth ) const;
+
+        /// @brief size in bytes of the mipmap chain, for each layer
+        uint64_t    TotalSize( const GLsizei in_width, const GLsizei in_height, const GLsizei in_depth, const GLsizei in_levels, const GLsizei in_layers ) const;
         
         GLenum operator = ( const GLenum &in_format )
         {
@@ -31,6 +31,10 @@ namespace gl
         bool        Create( const GLuint in_width, const GLuint in_height, const GLuint in_samples, const GLenum in_format );
         void        Destroy( void );
         GLuint      GetHandle( void ) const;
+        GLenum      InternalFormat( void ) const;
+        GLuint      Width( void ) const;
+        GLuint      Height( void ) const;
+        GLuint      Samples( void ) const;
         operator    GLuint( void ) const;
 
     private:
@@ -54,6 +58,32 @@ namespace gl
             GLint X1; 
             GLint Y1;
         } rect_t;
+
+        /// @brief clear value of a color draw buffer
+        typedef struct clearColor_t
+        {
+            GLint       drawBuffer = 0;     // draw buffer index, not the attachment
+            GLenum      type = GL_FLOAT;    // GL_FLOAT for normalized and float formats, GL_INT / GL_UNSIGNED_INT for integer ones
+            GLfloat     color[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            GLint       colorInt[4] = { 0, 0, 0, 0 };
+            GLuint      colorUint[4] = { 0, 0, 0, 0 };
+        } clearColor_t;
+
+        typedef struct clearInfo_t
+        {
+            const clearColor_t* colors = nullptr;
+            GLuint              colorCount = 0;
+            bool                depth = false;
+            GLfloat             depthValue = 1.0f;
+            bool                stencil = false;
+            GLint               stencilValue = 0;
+
+            /// @brief region to clear, nullptr to follow the scissor state in use
+            const rect_t*       area = nullptr;
+
+            /// @brief clear whatever the color / depth / stencil write masks, restored after
+            bool                ignoreMasks = false;
+        } clearInfo_t;
         
         FrameBuffer( void );
         ~FrameBuffer( void );
@@ -61,6 +91,15 @@ namespace gl
         void    Destroy( void );
         bool    Attach( const attachament_t* in_attachaments, const GLuint in_base, const GLuint in_count );
         void    Blit( const GLuint in_dstFrameBuffer, const rect_t in_srcRec, const rect_t in_dstRect, GLbitfield mask, GLenum filter ) const;
+
+        /// @brief clear a set of color, depth and stencil buffers of this framebuffer
+        void    Clear( const clearInfo_t* in_clear ) const;
+
+        /// @brief clear throught glClearNamedFramebuffer*, the glClearColor / glClearDepth / glClearStencil values
+        /// are not touched. Whitout a area and ignoreMasks the clear follow the masks and scissor like glClear.
+        /// Call whit the context current, the area scissor and the masks are set and restored trought its state cache
+        /// @param in_frameBuffer framebuffer name, 0 for the default one
+        static void Clear( const GLuint in_frameBuffer, const clearInfo_t* in_clear );
         GLuint  Handler( void ) const;
         operator GLuint( void ) const;
 
@@ -0,0 +1,94 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#ifndef __CRGL_FRAMEBUFFER_CACHE_HPP__
+#define __CRGL_FRAMEBUFFER_CACHE_HPP__
+
+typedef struct glCoreFrameBufferCache_t glCoreFrameBufferCache_t;
+
+namespace gl
+{
+    /// @brief a framebuffer attachment, part of the cache key
+    typedef struct fboAttachment_t
+    {
+        GLenum      attachment = GL_COLOR_ATTACHMENT0;
+        GLenum      target = GL_TEXTURE_2D;     // texture target or GL_RENDERBUFFER
+        GLuint      handle = 0;
+        GLint       level = 0;
+        GLint       layer = -1;                 // -1 attach all the layers ( layered rendering )
+    } fboAttachment_t;
+
+    typedef struct frameBufferCacheStats_t
+    {
+        GLuint      entries = 0;
+        uint64_t    hits = 0;
+        uint64_t    misses = 0;         // framebuffers created and checked
+        uint64_t    incomplete = 0;     // combinations that failed the completeness check
+        uint64_t    evictions = 0;      // entries dropped for a destroyed attachment or the size limit
+    } frameBufferCacheStats_t;
+
+    /// @brief Map attachment sets to framebuffers checked once for completeness.
+    /// The attachment list is normalized ( sorted by attachment point ) before the lookup,
+    /// the draw buffers are set to the color attachments in order.
+    /// Entries using a texture or renderbuffer are dropped when the object is destroyed,
+    /// the cache listen the context resource notifications.
+    /// Objects destroyed whit no context current are not notified, the driver don't delete them
+    /// either ( the call is ignored ) so the name is not reused and the entry stay valid until Clear.
+    /// The framebuffers are owned by the context the cache was created on, use it only there.
+    class FrameBufferCache : public ResourceListener
+    {
+    public:
+        struct createInfo_t
+        {
+            /// @brief the least recently used framebuffer is deleted past this
+            GLuint      maxEntries = 64;
+        };
+
+        FrameBufferCache( void );
+        ~FrameBufferCache( void );
+
+        /// @brief register on the current context resource listeners
+        bool    Create( const createInfo_t* in_createInfo );
+        void    Destroy( void );
+
+        /// @brief retrieve the framebuffer of a attachment set, created on the first request
+        /// @return 0 if the combination is incomplete
+        GLuint  Get( const fboAttachment_t* in_attachments, const GLuint in_count );
+
+        /// @brief delete all the framebuffers
+        void    Clear( void );
+
+        frameBufferCacheStats_t Stats( void ) const;
+
+        /// @brief attachment description of a texture, level 0, all layers
+        static fboAttachment_t  Attachment( const Texture* in_texture, const GLenum in_attachment, const GLint in_level = 0, const GLint in_layer = -1 );
+
+        /// @brief attachment description of a renderbuffer
+        static fboAttachment_t  Attachment( const RenderBuffer* in_renderBuffer, const GLenum in_attachment );
+
+        void    ResourceDestroyed( const memoryResource_t in_resource, const GLuint in_name ) override;
+
+    private:
+        glCoreFrameBufferCache_t*   m_cache;
+    };
+};
+
+#endif //!__CRGL_FRAMEBUFFER_CACHE_HPP__
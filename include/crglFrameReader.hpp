@@ -0,0 +1,126 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#ifndef __CRGL_FRAME_READER_HPP__
+#define __CRGL_FRAME_READER_HPP__
+
+typedef struct glCoreFrameReader_t  glCoreFrameReader_t;
+
+namespace gl
+{
+    /// @brief a frame handed to the consumer, the pixels are valid until the callback return
+    typedef struct frame_t
+    {
+        const void*     pixels = nullptr;
+        GLsizeiptr      size = 0;           // bytes in pixels
+        GLuint          width = 0;
+        GLuint          height = 0;
+        uint64_t        index = 0;          // capture sequence number, skip on dropped frames
+        uint64_t        latency = 0;        // microseconds from Capture to the delivery
+    } frame_t;
+
+    /// @brief consumer callback, called on the frame reader worker thread
+    typedef void ( *frameConsumer_t )( const frame_t* in_frame, void* in_userData );
+
+    /// @brief GPU side conversion of a captured frame, RGBA to YUV and such
+    class FrameConverter
+    {
+    public:
+        virtual ~FrameConverter( void ) {}
+
+        /// @brief bytes the converted frame need
+        virtual GLsizeiptr  OutputSize( const GLuint in_width, const GLuint in_height ) const = 0;
+
+        /// @brief write the converted in_source texture in the buffer ( usually bound as SSBO )
+        /// called on the capture thread, whit the frame reader context current
+        virtual bool        Convert( const GLuint in_source, const GLuint in_width, const GLuint in_height, const GLuint in_buffer ) = 0;
+    };
+
+    typedef struct frameReaderStats_t
+    {
+        uint64_t    captured = 0;           // frames read back
+        uint64_t    delivered = 0;          // frames handed to the consumer
+        uint64_t    dropped = 0;            // frames skipped because the ring was full
+        uint64_t    minLatency = 0;         // microseconds
+        uint64_t    maxLatency = 0;
+        uint64_t    meanLatency = 0;
+    } frameReaderStats_t;
+
+    /// @brief Read the frames back whitout stalling the GPU.
+    /// Each capture is read in a ring of persistently mapped pixel pack buffers and fenced,
+    /// the frames completed are handed to a consumer callback on a worker thread.
+    class FrameReader
+    {
+    public:
+        struct createInfo_t
+        {
+            /// @brief size of the region read, from the framebuffer origin
+            GLuint              width = 0;
+            GLuint              height = 0;
+
+            /// @brief read back pixel format
+            Format              format = Format( GL_RGBA8 );
+
+            /// @brief number of frames in flight, 3 for triple buffering
+            GLuint              depth = 3;
+
+            /// @brief true to drop the new frames when the ring is full, false to block the capture
+            bool                dropWhenFull = true;
+
+            /// @brief optional GPU conversion, the frame is copied to a texture of format before it
+            FrameConverter*     converter = nullptr;
+
+            /// @brief receive the frames
+            frameConsumer_t     consumer = nullptr;
+            void*               userData = nullptr;
+        };
+
+        FrameReader( void );
+        ~FrameReader( void );
+
+        /// @brief allocate the ring and start the consumer thread, call whit the context current
+        bool    Create( const createInfo_t* in_createInfo );
+
+        /// @brief deliver the frames in flight, stop the thread and release the ring
+        void    Destroy( void );
+
+        /// @brief queue the readback of a framebuffer color buffer
+        /// @param in_framebuffer source framebuffer, 0 for the default one
+        /// @param in_readBuffer color buffer read, GL_NONE for GL_BACK on the default framebuffer and GL_COLOR_ATTACHMENT0 on the others
+        /// @return false if the frame was dropped
+        bool    Capture( const GLuint in_framebuffer, const GLenum in_readBuffer = GL_NONE );
+
+        /// @brief hand the finished readbacks to the consumer thread, Capture already call it
+        /// @return number of frames handed
+        GLuint  Poll( void );
+
+        /// @brief deliver all the frames in flight and wait the consumer
+        void    Flush( void );
+
+        frameReaderStats_t  Stats( void ) const;
+        void                ResetStats( void );
+
+    private:
+        glCoreFrameReader_t*    m_reader;
+    };
+};
+
+#endif //!__CRGL_FRAME_READER_HPP__
@@ -0,0 +1,447 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#ifndef __CRGL_FUNCTIONS_HPP__
+#define __CRGL_FUNCTIONS_HPP__
+
+/// @brief every OpenGL entry point loaded by the context, X( function pointer type, function name whitout the gl prefix )
+/// the list declare the dispatch table members, the load table and the function ids,
+/// when adding a entry also add the gl* forward to crglDispatch.hpp
+#define CRGL_FUNCTIONS( X ) \
+    X( PFNGLGETINTEGERVPROC,                            GetIntegerv ) \
+    X( PFNGLGETINTEGER64VPROC,                          GetInteger64v ) \
+    X( PFNGLISENABLEDPROC,                              IsEnabled ) \
+    X( PFNGLDISABLEPROC,                                Disable ) \
+    X( PFNGLENABLEPROC,                                 Enable ) \
+    X( PFNGLENABLEIPROC,                                Enablei ) \
+    X( PFNGLDISABLEIPROC,                               Disablei ) \
+    X( PFNGLFINISHPROC,                                 Finish ) \
+    X( PFNGLFLUSHPROC,                                  Flush ) \
+    \
+    X( PFNGLGETERRORPROC,                               GetError ) \
+    X( PFNGLGETSTRINGPROC,                              GetString ) \
+    X( PFNGLGETSTRINGIPROC,                             GetStringi ) \
+    X( PFNGLGETBOOLEANVPROC,                            GetBooleanv ) \
+    X( PFNGLGETBOOLEANI_VPROC,                          GetBooleani_v ) \
+    X( PFNGLHINTPROC,                                   Hint ) \
+    \
+    X( PFNGLVIEWPORTPROC,                               Viewport ) \
+    X( PFNGLSCISSORPROC,                                Scissor ) \
+    \
+    /* pixel transfer */ \
+    X( PFNGLREADPIXELSPROC,                             ReadPixels ) \
+    X( PFNGLPIXELSTOREIPROC,                            PixelStorei ) \
+    \
+    /* clear buffer */ \
+    X( PFNGLCLEARPROC,                                  Clear ) \
+    \
+    /* color buffer */ \
+    X( PFNGLCLEARCOLORPROC,                             ClearColor ) \
+    X( PFNGLCOLORMASKPROC,                              ColorMask ) \
+    X( PFNGLCOLORMASKIPROC,                             ColorMaski ) \
+    X( PFNGLBLENDFUNCPROC,                              BlendFunc ) \
+    X( PFNGLBLENDFUNCSEPARATEPROC,                      BlendFuncSeparate ) \
+    X( PFNGLLOGICOPPROC,                                LogicOp ) \
+    \
+    /* GL_ARB_draw_buffers_blend */ \
+    X( PFNGLBLENDEQUATIONSEPARATEIPROC,                 BlendEquationSeparatei ) \
+    X( PFNGLBLENDFUNCSEPARATEIPROC,                     BlendFuncSeparatei ) \
+    \
+    /* depth buffer */ \
+    X( PFNGLDEPTHRANGEPROC,                             DepthRange ) \
+    X( PFNGLCLEARDEPTHPROC,                             ClearDepth ) \
+    X( PFNGLDEPTHMASKPROC,                              DepthMask ) \
+    X( PFNGLDEPTHFUNCPROC,                              DepthFunc ) \
+    X( PFNGLPOLYGONOFFSETPROC,                          PolygonOffset ) \
+    \
+    /* stencil buffer */ \
+    X( PFNGLCLEARSTENCILPROC,                           ClearStencil ) \
+    X( PFNGLSTENCILMASKPROC,                            StencilMask ) \
+    X( PFNGLSTENCILFUNCPROC,                            StencilFunc ) \
+    X( PFNGLSTENCILOPPROC,                              StencilOp ) \
+    \
+    X( PFNGLSTENCILFUNCSEPARATEPROC,                    StencilFuncSeparate ) \
+    X( PFNGLSTENCILOPSEPARATEPROC,                      StencilOpSeparate ) \
+    X( PFNGLSTENCILMASKSEPARATEPROC,                    StencilMaskSeparate ) \
+    \
+    /* polygon */ \
+    X( PFNGLLINEWIDTHPROC,                              LineWidth ) \
+    X( PFNGLPOINTSIZEPROC,                              PointSize ) \
+    X( PFNGLPOLYGONMODEPROC,                            PolygonMode ) \
+    X( PFNGLCULLFACEPROC,                               CullFace ) \
+    \
+    /* draw */ \
+    X( PFNGLDRAWARRAYSPROC,                             DrawArrays ) \
+    X( PFNGLDRAWELEMENTSPROC,                           DrawElements ) \
+    X( PFNGLMULTIDRAWARRAYSPROC,                        MultiDrawArrays ) \
+    X( PFNGLMULTIDRAWELEMENTSPROC,                      MultiDrawElements ) \
+    X( PFNGLDRAWELEMENTSBASEVERTEXPROC,                 DrawElementsBaseVertex ) \
+    X( PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC,            DrawRangeElementsBaseVertex ) \
+    X( PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC,            MultiDrawElementsBaseVertex ) \
+    \
+    /* GL_ARB_draw_instanced */ \
+    X( PFNGLDRAWARRAYSINSTANCEDPROC,                    DrawArraysInstanced ) \
+    X( PFNGLDRAWELEMENTSINSTANCEDPROC,                  DrawElementsInstanced ) \
+    X( PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC,        DrawElementsInstancedBaseVertex ) \
+    X( PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC,        DrawArraysInstancedBaseInstance ) \
+    X( PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC,      DrawElementsInstancedBaseInstance ) \
+    X( PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC, DrawElementsInstancedBaseVertexBaseInstance ) \
+    \
+    /* GL_ARB_draw_indirect */ \
+    X( PFNGLDRAWARRAYSINDIRECTPROC,                     DrawArraysIndirect ) \
+    X( PFNGLDRAWELEMENTSINDIRECTPROC,                   DrawElementsIndirect ) \
+    \
+    /* GL_ARB_multi_draw_indirect */ \
+    X( PFNGLMULTIDRAWARRAYSINDIRECTPROC,                MultiDrawArraysIndirect ) \
+    X( PFNGLMULTIDRAWELEMENTSINDIRECTPROC,              MultiDrawElementsIndirect ) \
+    X( PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC,           MultiDrawArraysIndirectCount ) \
+    X( PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC,         MultiDrawElementsIndirectCount ) \
+    \
+    /* GL_ARB_transform_feedback2 */ \
+    X( PFNGLDRAWTRANSFORMFEEDBACKPROC,                  DrawTransformFeedback ) \
+    X( PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC,            DrawTransformFeedbackStream ) \
+    X( PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC,         DrawTransformFeedbackInstanced ) \
+    X( PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC,   DrawTransformFeedbackStreamInstanced ) \
+    \
+    /* GL_ARB_debug_output // GL_KHR_debug */ \
+    X( PFNGLDEBUGMESSAGECONTROLPROC,                    DebugMessageControl ) \
+    X( PFNGLDEBUGMESSAGECALLBACKPROC,                   DebugMessageCallback ) \
+    X( PFNGLGETDEBUGMESSAGELOGPROC,                     GetDebugMessageLog ) \
+    X( PFNGLDEBUGMESSAGEINSERTPROC,                     DebugMessageInsert ) \
+    X( PFNGLOBJECTLABELPROC,                            ObjectLabel ) \
+    X( PFNGLGETOBJECTLABELPROC,                         GetObjectLabel ) \
+    X( PFNGLOBJECTPTRLABELPROC,                         ObjectPtrLabel ) \
+    X( PFNGLGETOBJECTPTRLABELPROC,                      GetObjectPtrLabel ) \
+    \
+    /* vertex array */ \
+    X( PFNGLISVERTEXARRAYPROC,                          IsVertexArray ) \
+    X( PFNGLCREATEVERTEXARRAYSPROC,                     CreateVertexArrays ) \
+    X( PFNGLDELETEVERTEXARRAYSPROC,                     DeleteVertexArrays ) \
+    X( PFNGLBINDVERTEXARRAYPROC,                        BindVertexArray ) \
+    X( PFNGLENABLEVERTEXARRAYATTRIBPROC,                EnableVertexArrayAttrib ) \
+    X( PFNGLDISABLEVERTEXARRAYATTRIBPROC,               DisableVertexArrayAttrib ) \
+    X( PFNGLVERTEXARRAYATTRIBBINDINGPROC,               VertexArrayAttribBinding ) \
+    X( PFNGLVERTEXARRAYATTRIBFORMATPROC,                VertexArrayAttribFormat ) \
+    X( PFNGLVERTEXARRAYELEMENTBUFFERPROC,               VertexArrayElementBuffer ) \
+    X( PFNGLVERTEXARRAYVERTEXBUFFERPROC,                VertexArrayVertexBuffer ) \
+    \
+    /* GL_ARB_multi_bind */ \
+    X( PFNGLVERTEXARRAYVERTEXBUFFERSPROC,               VertexArrayVertexBuffers ) \
+    \
+    /* shader */ \
+    X( PFNGLISSHADERPROC,                               IsShader ) \
+    X( PFNGLCREATESHADERPROC,                           CreateShader ) \
+    X( PFNGLDELETESHADERPROC,                           DeleteShader ) \
+    X( PFNGLSHADERSOURCEPROC,                           ShaderSource ) \
+    X( PFNGLSHADERBINARYPROC,                           ShaderBinary ) \
+    X( PFNGLCOMPILESHADERPROC,                          CompileShader ) \
+    X( PFNGLSPECIALIZESHADERPROC,                       SpecializeShader ) \
+    X( PFNGLGETSHADERINFOLOGPROC,                       GetShaderInfoLog ) \
+    X( PFNGLGETSHADERIVPROC,                            GetShaderiv ) \
+    \
+    /* program */ \
+    X( PFNGLCREATEPROGRAMPROC,                          CreateProgram ) \
+    X( PFNGLDELETEPROGRAMPROC,                          DeleteProgram ) \
+    X( PFNGLISPROGRAMPROC,                              IsProgram ) \
+    X( PFNGLPROGRAMPARAMETERIPROC,                      ProgramParameteri ) \
+    X( PFNGLATTACHSHADERPROC,                           AttachShader ) \
+    X( PFNGLDETACHSHADERPROC,                           DetachShader ) \
+    X( PFNGLLINKPROGRAMPROC,                            LinkProgram ) \
+    X( PFNGLVALIDATEPROGRAMPROC,                        ValidateProgram ) \
+    X( PFNGLGETPROGRAMIVPROC,                           GetProgramiv ) \
+    X( PFNGLGETPROGRAMINFOLOGPROC,                      GetProgramInfoLog ) \
+    X( PFNGLUSEPROGRAMPROC,                             UseProgram ) \
+    X( PFNGLUNIFORM1IPROC,                              Uniform1i ) \
+    X( PFNGLUNIFORM1IVPROC,                             Uniform1iv ) \
+    X( PFNGLUNIFORM1UIVPROC,                            Uniform1uiv ) \
+    \
+    /* pipelines */ \
+    X( PFNGLBINDPROGRAMPIPELINEPROC,                    BindProgramPipeline ) \
+    X( PFNGLCREATEPROGRAMPIPELINESPROC,                 CreateProgramPipelines ) \
+    X( PFNGLDELETEPROGRAMPIPELINESPROC,                 DeleteProgramPipelines ) \
+    X( PFNGLVALIDATEPROGRAMPIPELINEPROC,                ValidateProgramPipeline ) \
+    X( PFNGLGETPROGRAMPIPELINEIVPROC,                   GetProgramPipelineiv ) \
+    X( PFNGLGETPROGRAMPIPELINEINFOLOGPROC,              GetProgramPipelineInfoLog ) \
+    X( PFNGLUSEPROGRAMSTAGESPROC,                       UseProgramStages ) \
+    X( PFNGLACTIVESHADERPROGRAMPROC,                    ActiveShaderProgram ) \
+    X( PFNGLPROGRAMUNIFORM1IPROC,                       ProgramUniform1i ) \
+    X( PFNGLPROGRAMUNIFORM1IVPROC,                      ProgramUniform1iv ) \
+    X( PFNGLPROGRAMUNIFORM1UIVPROC,                     ProgramUniform1uiv ) \
+    \
+    /* buffer */ \
+    X( PFNGLISBUFFERPROC,                               IsBuffer ) \
+    X( PFNGLBINDBUFFERPROC,                             BindBuffer ) \
+    X( PFNGLBINDBUFFERBASEPROC,                         BindBufferBase ) \
+    X( PFNGLBINDBUFFERRANGEPROC,                        BindBufferRange ) \
+    X( PFNGLCREATEBUFFERSPROC,                          CreateBuffers ) \
+    X( PFNGLDELETEBUFFERSPROC,                          DeleteBuffers ) \
+    X( PFNGLNAMEDBUFFERSTORAGEPROC,                     NamedBufferStorage ) \
+    X( PFNGLMAPNAMEDBUFFERRANGEPROC,                    MapNamedBufferRange ) \
+    X( PFNGLUNMAPNAMEDBUFFERPROC,                       UnmapNamedBuffer ) \
+    X( PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC,            FlushMappedNamedBufferRange ) \
+    X( PFNGLNAMEDBUFFERSUBDATAPROC,                     NamedBufferSubData ) \
+    X( PFNGLGETNAMEDBUFFERSUBDATAPROC,                  GetNamedBufferSubData ) \
+    X( PFNGLCOPYNAMEDBUFFERSUBDATAPROC,                 CopyNamedBufferSubData ) \
+    \
+    /* GL_ARB_multi_bind */ \
+    X( PFNGLBINDBUFFERSRANGEPROC,                       BindBuffersRange ) \
+    X( PFNGLBINDBUFFERSBASEPROC,                        BindBuffersBase ) \
+    \
+    /* Image */ \
+    X( PFNGLBINDTEXTUREPROC,                            BindTexture ) \
+    X( PFNGLBINDTEXTURESPROC,                           BindTextures ) \
+    X( PFNGLBINDTEXTUREUNITPROC,                        BindTextureUnit ) \
+    X( PFNGLCREATETEXTURESPROC,                         CreateTextures ) \
+    X( PFNGLDELETETEXTURESPROC,                         DeleteTextures ) \
+    X( PFNGLISTEXTUREPROC,                              IsTexture ) \
+    X( PFNGLTEXTURESTORAGE1DPROC,                       TextureStorage1D ) \
+    X( PFNGLTEXTURESTORAGE2DPROC,                       TextureStorage2D ) \
+    X( PFNGLTEXTURESTORAGE3DPROC,                       TextureStorage3D ) \
+    X( PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC,            TextureStorage2DMultisample ) \
+    X( PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC,            TextureStorage3DMultisample ) \
+    X( PFNGLTEXTURESUBIMAGE1DPROC,                      TextureSubImage1D ) \
+    X( PFNGLTEXTURESUBIMAGE2DPROC,                      TextureSubImage2D ) \
+    X( PFNGLTEXTURESUBIMAGE3DPROC,                      TextureSubImage3D ) \
+    X( PFNGLCOPYTEXTURESUBIMAGE1DPROC,                  CopyTextureSubImage1D ) \
+    X( PFNGLCOPYTEXTURESUBIMAGE2DPROC,                  CopyTextureSubImage2D ) \
+    X( PFNGLCOPYTEXTURESUBIMAGE3DPROC,                  CopyTextureSubImage3D ) \
+    X( PFNGLTEXTUREPARAMETERIPROC,                      TextureParameteri ) \
+    X( PFNGLTEXTUREPARAMETERFPROC,                      TextureParameterf ) \
+    X( PFNGLTEXTUREPARAMETERIVPROC,                     TextureParameteriv ) \
+    X( PFNGLTEXTUREPARAMETERFVPROC,                     TextureParameterfv ) \
+    X( PFNGLGETTEXTUREPARAMETERIVPROC,                  GetTextureParameteriv ) \
+    X( PFNGLGETTEXTUREPARAMETERFVPROC,                  GetTextureParameterfv ) \
+    X( PFNGLGETTEXTURELEVELPARAMETERFVPROC,             GetTextureLevelParameterfv ) \
+    X( PFNGLGETTEXTURELEVELPARAMETERIVPROC,             GetTextureLevelParameteriv ) \
+    X( PFNGLGETINTERNALFORMATIVPROC,                    GetInternalformativ ) \
+    X( PFNGLGETTEXTUREIMAGEPROC,                        GetTextureImage ) \
+    X( PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC,              GetCompressedTextureImage ) \
+    X( PFNGLINVALIDATETEXIMAGEPROC,                     InvalidateTexImage ) \
+    \
+    /* GL_ARB_compressed_texture_pixel_storage */ \
+    X( PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC,            CompressedTextureSubImage1D ) \
+    X( PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC,            CompressedTextureSubImage2D ) \
+    X( PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC,            CompressedTextureSubImage3D ) \
+    \
+    /* GL_ARB_invalidate_subdata */ \
+    X( PFNGLINVALIDATETEXSUBIMAGEPROC,                  InvalidateTexSubImage ) \
+    \
+    /* GL_ARB_clear_texture */ \
+    X( PFNGLCLEARTEXIMAGEPROC,                          ClearTexImage ) \
+    X( PFNGLCLEARTEXSUBIMAGEPROC,                       ClearTexSubImage ) \
+    \
+    /* GL_ARB_get_texture_sub_image */ \
+    X( PFNGLGETTEXTURESUBIMAGEPROC,                     GetTextureSubImage ) \
+    X( PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC,           GetCompressedTextureSubImage ) \
+    \
+    /* GL_ARB_copy_image */ \
+    X( PFNGLCOPYIMAGESUBDATAPROC,                       CopyImageSubData ) \
+    \
+    /* GL_ARB_texture_view */ \
+    X( PFNGLTEXTUREVIEWPROC,                            TextureView ) \
+    \
+    X( PFNGLCREATESAMPLERSPROC,                         CreateSamplers ) \
+    X( PFNGLDELETESAMPLERSPROC,                         DeleteSamplers ) \
+    X( PFNGLBINDSAMPLERPROC,                            BindSampler ) \
+    X( PFNGLBINDSAMPLERSPROC,                           BindSamplers ) \
+    X( PFNGLISSAMPLERPROC,                              IsSampler ) \
+    X( PFNGLSAMPLERPARAMETERIPROC,                      SamplerParameteri ) \
+    X( PFNGLSAMPLERPARAMETERIVPROC,                     SamplerParameteriv ) \
+    X( PFNGLSAMPLERPARAMETERFPROC,                      SamplerParameterf ) \
+    X( PFNGLSAMPLERPARAMETERFVPROC,                     SamplerParameterfv ) \
+    X( PFNGLSAMPLERPARAMETERIIVPROC,                    SamplerParameterIiv ) \
+    X( PFNGLSAMPLERPARAMETERIUIVPROC,                   SamplerParameterIuiv ) \
+    X( PFNGLGETSAMPLERPARAMETERIVPROC,                  GetSamplerParameteriv ) \
+    X( PFNGLGETSAMPLERPARAMETERIIVPROC,                 GetSamplerParameterIiv ) \
+    X( PFNGLGETSAMPLERPARAMETERFVPROC,                  GetSamplerParameterfv ) \
+    X( PFNGLGETSAMPLERPARAMETERIUIVPROC,                GetSamplerParameterIuiv ) \
+    \
+    /* GL_ARB_bindless_texture */ \
+    X( PFNGLGETTEXTUREHANDLEARBPROC,                    GetTextureHandleARB ) \
+    X( PFNGLGETTEXTURESAMPLERHANDLEARBPROC,             GetTextureSamplerHandleARB ) \
+    X( PFNGLMAKETEXTUREHANDLERESIDENTARBPROC,           MakeTextureHandleResidentARB ) \
+    X( PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC,        MakeTextureHandleNonResidentARB ) \
+    X( PFNGLMAKEIMAGEHANDLERESIDENTARBPROC,             MakeImageHandleResidentARB ) \
+    X( PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC,          MakeImageHandleNonResidentARB ) \
+    X( PFNGLUNIFORMHANDLEUI64ARBPROC,                   UniformHandleui64ARB ) \
+    X( PFNGLUNIFORMHANDLEUI64VARBPROC,                  UniformHandleui64vARB ) \
+    X( PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC,            ProgramUniformHandleui64ARB ) \
+    X( PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC,           ProgramUniformHandleui64vARB ) \
+    X( PFNGLISTEXTUREHANDLERESIDENTARBPROC,             IsTextureHandleResidentARB ) \
+    X( PFNGLISIMAGEHANDLERESIDENTARBPROC,               IsImageHandleResidentARB ) \
+    \
+    /* GL_ARB_sparse_texture */ \
+    X( PFNGLTEXTUREPAGECOMMITMENTEXTPROC,               TexturePageCommitmentEXT ) \
+    \
+    /* GL_ARB_framebuffer_object */ \
+    X( PFNGLBINDFRAMEBUFFERPROC,                        BindFramebuffer ) \
+    X( PFNGLISFRAMEBUFFERPROC,                          IsFramebuffer ) \
+    X( PFNGLDELETEFRAMEBUFFERSPROC,                     DeleteFramebuffers ) \
+    X( PFNGLCREATEFRAMEBUFFERSPROC,                     CreateFramebuffers ) \
+    X( PFNGLNAMEDFRAMEBUFFERTEXTUREPROC,                NamedFramebufferTexture ) \
+    X( PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC,           NamedFramebufferTextureLayer ) \
+    X( PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC,           NamedFramebufferRenderbuffer ) \
+    X( PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC,             NamedFramebufferDrawBuffer ) \
+    X( PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC,            NamedFramebufferDrawBuffers ) \
+    X( PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC,             NamedFramebufferReadBuffer ) \
+    X( PFNGLFRAMEBUFFERRENDERBUFFERPROC,                FramebufferRenderbuffer ) \
+    X( PFNGLFRAMEBUFFERTEXTURE1DPROC,                   FramebufferTexture1D ) \
+    X( PFNGLFRAMEBUFFERTEXTURE2DPROC,                   FramebufferTexture2D ) \
+    X( PFNGLFRAMEBUFFERTEXTURE3DPROC,                   FramebufferTexture3D ) \
+    X( PFNGLFRAMEBUFFERTEXTURELAYERPROC,                FramebufferTextureLayer ) \
+    X( PFNGLFRAMEBUFFERTEXTUREPROC,                     FramebufferTexture ) \
+    X( PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC,            CheckNamedFramebufferStatus ) \
+    X( PFNGLBLITNAMEDFRAMEBUFFERPROC,                   BlitNamedFramebuffer ) \
+    X( PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC,         InvalidateNamedFramebufferData ) \
+    X( PFNGLCLEARNAMEDFRAMEBUFFERIVPROC,                ClearNamedFramebufferiv ) \
+    X( PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC,               ClearNamedFramebufferuiv ) \
+    X( PFNGLCLEARNAMEDFRAMEBUFFERFVPROC,                ClearNamedFramebufferfv ) \
+    X( PFNGLCLEARNAMEDFRAMEBUFFERFIPROC,                ClearNamedFramebufferfi ) \
+    X( PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC,      InvalidateNamedFramebufferSubData ) \
+    \
+    /* rendebuffers */ \
+    X( PFNGLISRENDERBUFFERPROC,                         IsRenderbuffer ) \
+    X( PFNGLCREATERENDERBUFFERSPROC,                    CreateRenderbuffers ) \
+    X( PFNGLDELETERENDERBUFFERSPROC,                    DeleteRenderbuffers ) \
+    X( PFNGLNAMEDRENDERBUFFERSTORAGEPROC,               NamedRenderbufferStorage ) \
+    X( PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC,    NamedRenderbufferStorageMultisample ) \
+    X( PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC,        GetNamedRenderbufferParameteriv ) \
+    \
+    /* GL_ARB_sync */ \
+    X( PFNGLISSYNCPROC,                                 IsSync ) \
+    X( PFNGLFENCESYNCPROC,                              FenceSync ) \
+    X( PFNGLCLIENTWAITSYNCPROC,                         ClientWaitSync ) \
+    X( PFNGLDELETESYNCPROC,                             DeleteSync ) \
+    X( PFNGLWAITSYNCPROC,                               WaitSync ) \
+    X( PFNGLGETSYNCIVPROC,                              GetSynciv ) \
+    \
+    /* compute */ \
+    X( PFNGLDISPATCHCOMPUTEPROC,                        DispatchCompute ) \
+    X( PFNGLMEMORYBARRIERPROC,                          MemoryBarrier ) \
+    X( PFNGLBINDIMAGETEXTUREPROC,                       BindImageTexture ) \
+    \
+    X( PFNGLVIEWPORTARRAYVPROC,                         ViewportArrayv ) \
+    X( PFNGLSCISSORARRAYVPROC,                          ScissorArrayv ) \
+    X( PFNGLVIEWPORTINDEXEDFPROC,                       ViewportIndexedf ) \
+    X( PFNGLDEPTHRANGEARRAYVPROC,                       DepthRangeArrayv ) \
+    X( PFNGLDEPTHRANGEINDEXEDPROC,                      DepthRangeIndexed )
+
+/// @brief extensions the library can take advantage, X( extension name whitout the GL_ prefix )
+#define CRGL_EXTENSIONS( X ) \
+    X( ARB_bindless_texture ) \
+    X( ARB_buffer_storage ) \
+    X( ARB_clip_control ) \
+    X( ARB_compute_shader ) \
+    X( ARB_direct_state_access ) \
+    X( ARB_gl_spirv ) \
+    X( ARB_indirect_parameters ) \
+    X( ARB_multi_draw_indirect ) \
+    X( ARB_parallel_shader_compile ) \
+    X( ARB_pipeline_statistics_query ) \
+    X( ARB_shader_draw_parameters ) \
+    X( ARB_sparse_buffer ) \
+    X( ARB_sparse_texture ) \
+    X( ARB_sparse_texture2 ) \
+    X( ARB_texture_compression_bptc ) \
+    X( ARB_texture_filter_anisotropic ) \
+    X( EXT_texture_filter_anisotropic ) \
+    X( EXT_texture_compression_s3tc ) \
+    X( EXT_texture_sRGB ) \
+    X( EXT_sparse_texture2 ) \
+    X( KHR_debug ) \
+    X( KHR_no_error ) \
+    X( KHR_parallel_shader_compile ) \
+    X( NV_mesh_shader ) \
+    X( NVX_gpu_memory_info ) \
+    X( ATI_meminfo )
+
+namespace gl
+{
+#define CRGL_FUNCTION_ID( in_type, in_name ) FUNCTION_##in_name,
+    enum function_t
+    {
+        CRGL_FUNCTIONS( CRGL_FUNCTION_ID )
+        FUNCTION_COUNT
+    };
+#undef CRGL_FUNCTION_ID
+
+#define CRGL_EXTENSION_ID( in_name ) EXTENSION_##in_name,
+    enum extension_t
+    {
+        CRGL_EXTENSIONS( CRGL_EXTENSION_ID )
+        EXTENSION_COUNT
+    };
+#undef CRGL_EXTENSION_ID
+
+    /// @brief fixed size bit set, no allocation
+    template< GLuint _BITS >
+    struct bitSet_t
+    {
+        static constexpr GLuint k_WORDS = ( _BITS + 63 ) / 64;
+
+        uint64_t    words[k_WORDS] = {};
+
+        void    Set( const GLuint in_bit ) { words[in_bit >> 6] |= ( 1ull << ( in_bit & 63 ) ); }
+        bool    Test( const GLuint in_bit ) const { return ( words[in_bit >> 6] & ( 1ull << ( in_bit & 63 ) ) ) != 0; }
+        void    Clear( void ) { for ( GLuint i = 0; i < k_WORDS; i++ ) words[i] = 0; }
+        
+        GLuint  Count( void ) const 
+        { 
+            GLuint count = 0;
+            for ( GLuint i = 0; i < k_WORDS; i++ )
+            {
+                for ( uint64_t word = words[i]; word != 0; word &= word - 1 )
+                    count++;
+            }
+            return count;
+        }
+    };
+
+    typedef bitSet_t<FUNCTION_COUNT>    functionSet_t;
+    typedef bitSet_t<EXTENSION_COUNT>   extensionSet_t;
+
+    /// @brief a context entry points, each gl::Context own one
+#define CRGL_DISPATCH_MEMBER( in_type, in_name ) in_type in_name = nullptr;
+    typedef struct dispatch_t
+    {
+        CRGL_FUNCTIONS( CRGL_DISPATCH_MEMBER )
+    } dispatch_t;
+#undef CRGL_DISPATCH_MEMBER
+
+    /// @brief table used while no context is current on the thread, every entry is a no op
+    /// returning 0, so a object released after its context is gone don't call a null pointer
+    extern const dispatch_t k_NO_CONTEXT_DISPATCH;
+
+    /// @brief dispatch table of the context current on the calling thread
+    inline const dispatch_t*& CurrentDispatch( void )
+    {
+        static thread_local const dispatch_t* s_currentDispatch = &k_NO_CONTEXT_DISPATCH;
+        return s_currentDispatch;
+    }
+
+    /// @brief function name from the id, whit the gl prefix
+    const char* FunctionName( const function_t in_function );
+
+    /// @brief extension name from the id, whit the GL_ prefix
+    const char* ExtensionName( const extension_t in_extension );
+};
+
+#endif //!__CRGL_FUNCTIONS_HPP__
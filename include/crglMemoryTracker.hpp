@@ -0,0 +1,132 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#ifndef __CRGL_MEMORY_TRACKER_HPP__
+#define __CRGL_MEMORY_TRACKER_HPP__
+
+typedef struct glCoreMemoryTracker_t    glCoreMemoryTracker_t;
+
+namespace gl
+{
+    class Context;
+
+    enum memoryResource_t
+    {
+        MEMORY_BUFFER = 0,
+        MEMORY_TEXTURE,
+        MEMORY_RENDERBUFFER,
+        MEMORY_RESOURCE_COUNT
+    };
+
+    /// @brief allocations not tagged whit PushCategory go here
+    static constexpr GLuint k_MEMORY_CATEGORY_DEFAULT = 0;
+
+    typedef struct memoryAllocation_t
+    {
+        memoryResource_t    resource = MEMORY_BUFFER;
+        GLuint              name = 0;           // OpenGL object name
+        GLuint              category = 0;       // user category the allocation was tagged
+        uint64_t            bytes = 0;          // allocation size
+        bool                estimated = false;  // true when the driver is free to choose the storage size ( generic / unknow formats )
+    } memoryAllocation_t;
+
+    class MemoryTracker;
+
+    /// @brief the tracker that hold a allocation, kept by the resource to untrack from any context
+    typedef struct memoryOwner_t
+    {
+        MemoryTracker*      tracker = nullptr;
+        uint64_t            serial = 0;         // tell apart a new tracker created at the same address
+    } memoryOwner_t;
+
+    typedef struct memoryUsage_t
+    {
+        uint64_t    bytes = 0;                  // bytes currently allocated
+        uint64_t    highWater = 0;              // max bytes allocated at once
+        uint64_t    allocations = 0;            // live allocations
+        uint64_t    budget = 0;                 // 0 for unlimited
+    } memoryUsage_t;
+
+    /// @brief Aggregate the GPU memory used by the object wrappers.
+    /// Buffers, textures and renderbuffers register when created and unregister when destroyed,
+    /// from the tracker of the context they were created on, even if a other or none is current.
+    /// the sizes are computed from the creation parameters, whit the format storage size ( Format::StorageSize ), not the transfer one.
+    class MemoryTracker
+    {
+    public:
+        MemoryTracker( void );
+        ~MemoryTracker( void );
+
+        /// @brief register a allocation on the current category
+        /// @return the owner to untrack the allocation whit, whatever context is current then
+        memoryOwner_t   Track( const memoryResource_t in_resource, const GLuint in_name, const uint64_t in_bytes, const bool in_estimated );
+
+        /// @brief remove a allocation
+        void    Untrack( const memoryResource_t in_resource, const GLuint in_name );
+
+        /// @brief remove a allocation from the tracker that registered it, nothing if that tracker is gone
+        static void Untrack( const memoryOwner_t& in_owner, const memoryResource_t in_resource, const GLuint in_name );
+
+        /// @brief allocations made until PopCategory are tagged whit in_category
+        void    PushCategory( const GLuint in_category );
+        void    PopCategory( void );
+
+        /// @brief give a name to a category, used by reports
+        void    SetCategoryName( const GLuint in_category, const char* in_name );
+        const char* CategoryName( const GLuint in_category ) const;
+
+        /// @brief set a category budget, in bytes, 0 for unlimited
+        void    SetBudget( const GLuint in_category, const uint64_t in_bytes );
+
+        /// @brief true if the category is using more than the budget
+        bool    IsOverBudget( const GLuint in_category ) const;
+
+        /// @brief usage of all the tracked allocations
+        memoryUsage_t   Total( void ) const;
+
+        /// @brief usage of a resource type
+        memoryUsage_t   Resource( const memoryResource_t in_resource ) const;
+
+        /// @brief usage of a category
+        memoryUsage_t   Category( const GLuint in_category ) const;
+
+        /// @brief retrieve the biggest live allocations, sorted by size
+        /// @param in_allocations output array
+        /// @param in_count output array size
+        /// @return number of allocations writed
+        GLuint  Largest( memoryAllocation_t* in_allocations, const GLuint in_count ) const;
+
+        /// @brief write a human readable report throught in_context DebugOuput
+        void    Report( const Context* in_context ) const;
+
+        /// @brief storage size of a texture, all levels, layers and samples
+        /// @param in_estimated set to true if the size is a estimation
+        static uint64_t TextureSize( const Texture::createInfo_t* in_createInfo, bool* in_estimated );
+
+        /// @brief storage size of a renderbuffer
+        static uint64_t RenderBufferSize( const GLuint in_width, const GLuint in_height, const GLuint in_samples, const Format in_format, bool* in_estimated );
+
+    private:
+        glCoreMemoryTracker_t*  m_tracker;
+    };
+};
+
+#endif //!__CRGL_MEMORY_TRACKER_HPP__
@@ -0,0 +1,133 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+
+#ifndef __CRGL_MIP_GENERATOR_HPP__
+#define __CRGL_MIP_GENERATOR_HPP__
+
+typedef struct glCoreMipGenerator_t glCoreMipGenerator_t;
+
+namespace gl
+{
+    /// @brief downsampling filter
+    enum mipFilter_t
+    {
+        MIP_FILTER_BOX = 0,         // area average, exact 2x2 average on even sizes
+        MIP_FILTER_KAISER,          // Kaiser windowed sinc, 3 lobes, sharp whit little ringing
+        MIP_FILTER_LANCZOS          // Lanczos 3, sharpest, can ring on hard edges
+    };
+
+    /// @brief filter kernels instruction set
+    enum mipSimd_t
+    {
+        MIP_SIMD_AUTO = 0,          // the best the CPU support
+        MIP_SIMD_NONE,              // portable scalar code
+        MIP_SIMD_SSE2,
+        MIP_SIMD_AVX2,
+        MIP_SIMD_NEON
+    };
+
+    /// @brief a generated mip level, tightly packed rows in the format transfer layout
+    typedef struct mipLevel_t
+    {
+        GLuint          width = 0;
+        GLuint          height = 0;
+        const void*     pixels = nullptr;
+        GLsizeiptr      size = 0;
+    } mipLevel_t;
+
+    typedef struct mipGeneratorStats_t
+    {
+        uint64_t    images = 0;         // Generate calls
+        uint64_t    levels = 0;         // levels generated
+        uint64_t    pixels = 0;         // output pixels
+        uint64_t    microseconds = 0;   // time spent in Generate
+        mipSimd_t   simd = MIP_SIMD_NONE;   // kernels in use
+    } mipGeneratorStats_t;
+
+    /// @brief Build mip chains on the CPU, whitout a context, from any thread.
+    /// The pixels are decoded to linear float RGBA ( sRGB formats are linearized ), each level is
+    /// filtered from the previous one whit separable SIMD kernels and encoded back to the format.
+    /// The rows of each level are spread over the generator threads.
+    /// Every uncompressed color format of the format table is supported, integer formats are averaged and rounded
+    /// ( 32 bits integers are exact up to 2^24, the float precision ). Depth and stencil formats are not filtered.
+    class MipGenerator
+    {
+    public:
+        struct createInfo_t
+        {
+            mipFilter_t     filter = MIP_FILTER_BOX;
+
+            /// @brief worker threads, the calling thread work too, 0 for one per core
+            GLuint          threads = 0;
+
+            /// @brief kernels instruction set, the requested one must be supported
+            mipSimd_t       simd = MIP_SIMD_AUTO;
+
+            /// @brief filter sRGB formats in linear space
+            bool            gammaCorrect = true;
+
+            /// @brief the image tile, the filter wrap around the edges instead of clamp
+            bool            wrap = false;
+
+            /// @brief keep the fraction of pixels whit alpha above this value on every level
+            /// ( alpha tested foliage and fences ), 0 to disable
+            GLfloat         alphaReference = 0.0f;
+        };
+
+        MipGenerator( void );
+        ~MipGenerator( void );
+
+        /// @brief start the worker threads
+        bool    Create( const createInfo_t* in_createInfo );
+        void    Destroy( void );
+
+        /// @brief generate the levels of a image
+        /// @param in_pixels level 0, tightly packed rows in the format transfer layout
+        /// @param in_levels levels counting the base one, 0 for the full chain
+        /// @return false for unsupported formats, levels stay valid until the next Generate
+        bool    Generate( const Format in_format, const GLuint in_width, const GLuint in_height, const void* in_pixels, const GLuint in_levels = 0 );
+
+        /// @brief number of levels of the last image, counting the base one
+        GLuint  Levels( void ) const;
+
+        /// @brief a level of the last image, level 0 point to the source pixels
+        mipLevel_t  Level( const GLuint in_level ) const;
+
+        /// @brief upload the generated levels, from 1, to a texture whit the context current
+        /// @param in_uploader stream through a uploader ring, nullptr for Texture::SubImage
+        /// @param in_layer array layer or cube face
+        bool    Upload( Texture* in_texture, TextureUploader* in_uploader = nullptr, const GLsizei in_layer = 0 ) const;
+
+        mipGeneratorStats_t Stats( void ) const;
+
+        /// @brief true if the format can be generated
+        static bool Supported( const Format in_format );
+
+        /// @brief the best instruction set of the running CPU
+        static mipSimd_t    BestSimd( void );
+
+    private:
+        glCoreMipGenerator_t*   m_generator;
+    };
+};
+
+#endif //!__CRGL_MIP_GENERATOR_HPP__
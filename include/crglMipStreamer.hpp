@@ -0,0 +1,103 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#ifndef __CRGL_MIP_STREAMER_HPP__
+#define __CRGL_MIP_STREAMER_HPP__
+
+typedef struct glCoreMipStreamer_t  glCoreMipStreamer_t;
+
+namespace gl
+{
+    /// @brief provide the texels of a texture levels, called on the GL thread by MipStreamer::Update
+    class MipSource
+    {
+    public:
+        virtual ~MipSource( void ) {}
+
+        /// @brief write the level texels, tightly packed, in in_destine
+        /// @return false if the level is not available, the texture stop streaming and its stream id is released
+        virtual bool    LoadLevel( const GLint in_level, void* in_destine, const GLsizeiptr in_size ) = 0;
+    };
+
+    typedef struct mipStreamerStats_t
+    {
+        uint64_t    levels = 0;             // levels uploaded
+        uint64_t    bytes = 0;              // bytes uploaded
+        uint64_t    textures = 0;           // textures streamed
+        uint64_t    complete = 0;           // textures whit the level they need resident
+        uint64_t    meanFirstPixel = 0;     // microseconds from Add to the first level upload
+    } mipStreamerStats_t;
+
+    /// @brief Stream 2D textures from the smallest level up.
+    /// The full chain is allocated by Texture::Create, each Update upload the levels the
+    /// textures need most, whit a byte budget, and lower the textures resident level
+    /// ( GL_TEXTURE_BASE_LEVEL ) as they arrive.
+    /// The priority come from the projected screen size of each texture.
+    class MipStreamer
+    {
+    public:
+        struct createInfo_t
+        {
+            /// @brief bytes uploaded by a Update, at least one level is always uploaded
+            GLsizeiptr  bytesPerUpdate = 4 * 1024 * 1024;
+
+            /// @brief staging ring size, must hold the biggest level
+            GLsizeiptr  stagingSize = 32 * 1024 * 1024;
+        };
+
+        MipStreamer( void );
+        ~MipStreamer( void );
+
+        bool    Create( const createInfo_t* in_createInfo );
+        void    Destroy( void );
+
+        /// @brief start to stream a texture, the coarsest level is uploaded right away
+        /// @param in_texture a 2D texture, alive until Remove
+        /// @return stream id, 0 on failure or if the source can't give the coarsest level
+        GLuint  Add( Texture* in_texture, MipSource* in_source );
+        void    Remove( const GLuint in_stream );
+
+        /// @brief set the size, in pixels, the texture cover on the screen
+        /// the texture only need the levels whit at least one texel by pixel
+        void    SetScreenSize( const GLuint in_stream, const GLfloat in_pixels );
+
+        /// @brief upload the next levels, call once per frame on the GL thread
+        /// @return number of levels uploaded
+        GLuint  Update( void );
+
+        /// @brief finest level resident of a stream, 0 for a invalid stream
+        GLint   ResidentLevel( const GLuint in_stream ) const;
+
+        /// @brief finest level a stream need for its screen size
+        GLint   DesiredLevel( const GLuint in_stream ) const;
+
+        mipStreamerStats_t  Stats( void ) const;
+
+        /// @brief projected size in pixels of a object of in_radius at in_distance
+        /// @param in_fovY vertical field of view, radians
+        static GLfloat  ProjectedSize( const GLfloat in_radius, const GLfloat in_distance, const GLfloat in_fovY, const GLfloat in_viewportHeight );
+
+    private:
+        glCoreMipStreamer_t*    m_streamer;
+    };
+};
+
+#endif //!__CRGL_MIP_STREAMER_HPP__
@@ -0,0 +1,111 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+
+#ifndef __CRGL_MSAA_TARGET_HPP__
+#define __CRGL_MSAA_TARGET_HPP__
+
+typedef struct glCoreMsaaTarget_t   glCoreMsaaTarget_t;
+
+namespace gl
+{
+    /// @brief how the samples are merged in the resolved texture
+    enum resolveMode_t
+    {
+        RESOLVE_BLIT = 0,           // glBlitNamedFramebuffer, driver defined for depth ( usually the sample 0 )
+        RESOLVE_COMPUTE_AVERAGE,    // compute shader, samples average
+        RESOLVE_COMPUTE_MIN,        // compute shader, closest sample, for depth buffers
+        RESOLVE_COMPUTE_MAX,        // compute shader, farthest sample, for depth buffers
+        RESOLVE_COMPUTE_TONEMAPPED  // compute shader, average weighted by 1 / ( 1 + luma ), keep HDR highlights from aliasing
+    };
+
+    typedef struct msaaTargetStats_t
+    {
+        uint64_t    resolves = 0;       // resolves executed
+        uint64_t    skipped = 0;        // resolves requested whit nothing dirty
+        uint64_t    pixels = 0;         // resolved pixels
+        uint64_t    invalidates = 0;    // multisample contents discarded after a resolve
+    } msaaTargetStats_t;
+
+    /// @brief A multisample render target that own its single sample resolve texture.
+    /// The rendered regions are accumulated whit MarkDirty, Resolve merge only the dirty
+    /// rectangle and invalidate the multisample content after, so tilers don't write the samples back.
+    /// The compute modes need a multisample texture and a resolve format usable as image,
+    /// depth formats resolve to GL_R32F.
+    class MsaaTarget
+    {
+    public:
+        struct createInfo_t
+        {
+            GLuint          width = 0;
+            GLuint          height = 0;
+            GLuint          samples = 4;
+
+            /// @brief multisample storage format, color or depth
+            gl::Format      format = GL_RGBA8;
+
+            /// @brief store the samples in a renderbuffer, blit resolve only
+            bool            renderBuffer = false;
+
+            resolveMode_t   resolve = RESOLVE_BLIT;
+        };
+
+        MsaaTarget( void );
+        ~MsaaTarget( void );
+
+        bool    Create( const createInfo_t* in_createInfo );
+        void    Destroy( void );
+
+        /// @brief add a rendered region to the next resolve
+        /// @param in_rect the region, nullptr for the whole target
+        void    MarkDirty( const rect_t* in_rect = nullptr );
+
+        /// @brief merge the dirty region samples in the resolved texture.
+        /// The compute resolve use the texture unit 0 (restored) and the image unit 0 (left unbound)
+        /// @param in_invalidate discard the multisample content of the dirty region after
+        /// @return false if nothing was dirty
+        bool    Resolve( const bool in_invalidate = true );
+
+        /// @brief the framebuffer attachment point of the target format
+        GLenum  Attachment( void ) const;
+
+        /// @brief the multisample storage, only one is valid
+        const Texture*      MultisampleTexture( void ) const;
+        const RenderBuffer* MultisampleRenderBuffer( void ) const;
+
+        /// @brief the single sample result
+        const Texture*      Resolved( void ) const;
+
+        /// @brief the region pending resolve, empty if clean
+        rect_t  DirtyRect( void ) const;
+
+        GLuint  Width( void ) const;
+        GLuint  Height( void ) const;
+        GLuint  Samples( void ) const;
+
+        msaaTargetStats_t   Stats( void ) const;
+
+    private:
+        glCoreMsaaTarget_t* m_target;
+    };
+};
+
+#endif //!__CRGL_MSAA_TARGET_HPP__
@@ -0,0 +1,135 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#ifndef __CRGL_RENDER_FARM_HPP__
+#define __CRGL_RENDER_FARM_HPP__
+
+typedef struct glCoreRenderFarm_t   glCoreRenderFarm_t;
+
+namespace gl
+{
+    /// @brief a offscreen rendering run by the farm
+    class RenderJob
+    {
+    public:
+        virtual ~RenderJob( void ) {}
+
+        /// @brief called on a farm thread, whit the worker framebuffer bound and the viewport covering it
+        virtual void    Render( Context* in_context ) = 0;
+
+        /// @brief called on the same farm thread when the pixels reach the CPU
+        /// @param in_pixels tightly packed rows, bottom to top, in the farm color format, valid only during the call
+        /// nullptr, whit a 0 size, if the readback failed or no worker was left to run the job
+        virtual void    Finished( const void* in_pixels, const GLuint in_width, const GLuint in_height ) = 0;
+    };
+
+    /// @brief create a headless context, current on the calling thread, called from each farm thread
+    /// the farm take the context ownership
+    typedef Context* ( *contextFactory_t )( void* in_userData );
+
+    static constexpr GLuint k_RENDER_FARM_LATENCY_BUCKETS = 32;
+
+    typedef struct renderFarmStats_t
+    {
+        uint64_t    submitted = 0;
+        uint64_t    completed = 0;
+        uint64_t    failed = 0;                 // completed jobs whitout pixels, the readback failed
+        uint64_t    stolen = 0;                 // jobs taken from other worker queue
+        double      jobsPerSecond = 0.0;        // completed jobs per second since Start / ResetStats
+        uint64_t    minLatency = 0;             // microseconds, from Submit to Finished
+        uint64_t    maxLatency = 0;
+        uint64_t    meanLatency = 0;
+        uint64_t    latency[k_RENDER_FARM_LATENCY_BUCKETS] = {};  // bucket i count the jobs whit latency in [2^i, 2^(i+1)) microseconds
+    } renderFarmStats_t;
+
+    /// @brief Pool of independent headless contexts, one per thread, each whit its own framebuffer.
+    /// Jobs are spread over the workers queues, idle workers steal from the others,
+    /// the results are read back trought a ring of pixel pack buffers so the next job don't wait the readback.
+    class RenderFarm
+    {
+    public:
+        struct createInfo_t
+        {
+            /// @brief number of contexts / threads, 0 for one per core
+            GLuint              workers = 0;
+
+            /// @brief framebuffer size
+            GLuint              width = 256;
+            GLuint              height = 256;
+
+            /// @brief color attachament format, the readback use the format transfer type
+            Format              colorFormat = GL_RGBA8;
+
+            /// @brief depth attachament format, GL_NONE for no depth buffer
+            GLenum              depthFormat = GL_DEPTH24_STENCIL8;
+
+            /// @brief readbacks in flight per worker
+            GLuint              readbackDepth = 2;
+
+            /// @brief debug output of each context, nullptr for DEBUG_OFF
+            const debugConfig_t* debug = nullptr;
+
+            /// @brief context factory, nullptr use a EGL_PLATFORM_SURFACELESS_MESA pbuffer context ( USE_EGL_CONTEXT builds )
+            contextFactory_t    factory = nullptr;
+            void*               userData = nullptr;
+        };
+
+        RenderFarm( void );
+        ~RenderFarm( void );
+
+        /// @brief spawn the worker threads, each one create its context and framebuffer
+        /// wait every worker to start, the ones that fail are dropped and reported
+        /// @return true if at least one worker started
+        bool    Start( const createInfo_t* in_createInfo );
+
+        /// @brief finish the queued jobs and destroy the workers
+        void    Stop( void );
+
+        /// @brief queue a job, safe to call from any thread
+        /// the job must stay alive until Finished is called
+        bool    Submit( RenderJob* in_job );
+
+        /// @brief block until every submitted job is finished
+        void    WaitIdle( void ) const;
+
+        /// @brief number of running workers
+        GLuint  NumWorkers( void ) const;
+
+        /// @brief workers framebuffer size, 0 before Start
+        GLuint  Width( void ) const;
+        GLuint  Height( void ) const;
+
+        /// @brief workers color attachament format, the readback pixels layout, GL_NONE before Start
+        Format  ColorFormat( void ) const;
+
+        renderFarmStats_t   Stats( void ) const;
+        void                ResetStats( void );
+
+        /// @brief latency, in microseconds, under which in_percentile ( 0.0 - 1.0 ) of the jobs finished
+        /// resolution is the histogram bucket
+        uint64_t    LatencyPercentile( const double in_percentile ) const;
+
+    private:
+        glCoreRenderFarm_t* m_farm;
+    };
+};
+
+#endif //!__CRGL_RENDER_FARM_HPP__
@@ -0,0 +1,130 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#ifndef __CRGL_RENDER_GRAPH_HPP__
+#define __CRGL_RENDER_GRAPH_HPP__
+
+typedef struct glCoreRenderGraph_t  glCoreRenderGraph_t;
+
+namespace gl
+{
+    class RenderGraph;
+    class RenderTargetPool;
+
+    /// @brief how a pass touch a resource, drive the barriers and the framebuffer setup
+    enum graphAccess_t
+    {
+        GRAPH_READ_SAMPLED      = 1 << 0,   // texture fetches
+        GRAPH_READ_IMAGE        = 1 << 1,   // imageLoad
+        GRAPH_READ_ATTACHMENT   = 1 << 2,   // blending, depth / stencil test
+        GRAPH_WRITE_ATTACHMENT  = 1 << 3,   // framebuffer output
+        GRAPH_WRITE_IMAGE       = 1 << 4    // imageStore / image atomics
+    };
+
+    /// @brief state given to a pass while it execute
+    typedef struct renderGraphPass_t
+    {
+        const RenderGraph*  graph = nullptr;
+        GLuint              pass = 0;
+        const char*         name = nullptr;
+        GLuint              frameBuffer = 0;    // the pass attachments, 0 for passes whitout attachments
+        GLsizei             width = 0;          // attachments size, the viewport is already set
+        GLsizei             height = 0;
+    } renderGraphPass_t;
+
+    /// @brief record the pass commands, use RenderGraph::GetTexture to retrieve the resources
+    typedef void ( *renderGraphExecute_t )( const renderGraphPass_t* in_pass, void* in_userData );
+
+    typedef struct renderGraphStats_t
+    {
+        GLuint      passes = 0;         // passes executed
+        GLuint      culled = 0;         // passes whit no used output
+        GLuint      textures = 0;       // transient textures acquired
+        GLuint      barriers = 0;       // glMemoryBarrier calls
+        GLuint      invalidates = 0;    // attachments invalidated
+    } renderGraphStats_t;
+
+    /// @brief Frame described as passes declaring the resources they read and write.
+    /// Compile cull the passes not contributing to a imported texture and compute the
+    /// transient textures lifetime. Execute acquire each transient texture from a
+    /// RenderTargetPool right before the first use and release it right after the last,
+    /// so later textures alias the memory, issue only the memory barriers needed by
+    /// the image writes and invalidate the attachments not used anymore.
+    /// The passes run in declaration order.
+    class RenderGraph
+    {
+    public:
+        RenderGraph( void );
+        ~RenderGraph( void );
+
+        bool    Create( void );
+        void    Destroy( void );
+
+        /// @brief remove the passes and resources, keep the cached framebuffers
+        void    Reset( void );
+
+        /// @brief declare a texture owned by the graph
+        /// @return resource id
+        GLuint  CreateTexture( const char* in_name, const Texture::createInfo_t* in_createInfo );
+
+        /// @brief declare a texture owned by the caller, the passes writing it are never culled
+        GLuint  ImportTexture( const char* in_name, Texture* in_texture );
+
+        /// @brief add a pass
+        /// @return pass id
+        GLuint  AddPass( const char* in_name, renderGraphExecute_t in_execute, void* in_userData );
+
+        /// @brief declare a pass use of a resource
+        /// @param in_access graphAccess_t bits
+        /// @param in_attachment framebuffer attachment for the *_ATTACHMENT access
+        void    Read( const GLuint in_pass, const GLuint in_resource, const GLbitfield in_access, const GLenum in_attachment = GL_NONE );
+        void    Write( const GLuint in_pass, const GLuint in_resource, const GLbitfield in_access, const GLenum in_attachment = GL_NONE );
+
+        /// @brief keep a pass even whit no used outputs ( readbacks, queries )
+        void    SetSideEffect( const GLuint in_pass );
+
+        /// @brief cull the passes and compute the lifetimes
+        /// @return false if a pass use a undeclared resource
+        bool    Compile( void );
+
+        /// @brief run the compiled passes, call whit the context current
+        /// the framebuffer and viewport bound by the caller are restored after each pass whit attachments
+        /// @param in_pool where the transient textures come from
+        /// @return false if a texture can't be acquired or a pass attachments differ in size
+        bool    Execute( RenderTargetPool* in_pool );
+
+        /// @brief the texture of a resource, valid while a pass using it execute
+        Texture*    GetTexture( const GLuint in_resource ) const;
+
+        /// @brief true if Compile culled the pass
+        bool    IsCulled( const GLuint in_pass ) const;
+
+        renderGraphStats_t  Stats( void ) const;
+
+        /// @brief glMemoryBarrier bits needed to use a resource whit in_access after a image write
+        static GLbitfield   BarrierBits( const GLbitfield in_access );
+
+    private:
+        glCoreRenderGraph_t*    m_graph;
+    };
+};
+
+#endif //!__CRGL_RENDER_GRAPH_HPP__
@@ -0,0 +1,116 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#ifndef __CRGL_RENDER_PASS_HPP__
+#define __CRGL_RENDER_PASS_HPP__
+
+typedef struct glCoreRenderPass_t   glCoreRenderPass_t;
+
+namespace gl
+{
+    /// @brief what happen to a attachment content at the pass begin
+    enum loadOp_t
+    {
+        LOAD_OP_LOAD = 0,       // keep the previous content
+        LOAD_OP_CLEAR,          // clear to passAttachment_t::clear
+        LOAD_OP_DONT_CARE       // previous content not needed, invalidated
+    };
+
+    /// @brief what happen to a attachment content at the pass end
+    enum storeOp_t
+    {
+        STORE_OP_STORE = 0,     // keep the rendered content
+        STORE_OP_DONT_CARE      // not needed after the pass, invalidated ( depth buffers, MSAA targets already resolved )
+    };
+
+    typedef struct clearValue_t
+    {
+        GLfloat     color[4] = { 0.0f, 0.0f, 0.0f, 0.0f };  // normalized and float formats
+        GLint       colorInt[4] = { 0, 0, 0, 0 };           // signed integer formats
+        GLuint      colorUint[4] = { 0, 0, 0, 0 };          // unsigned integer formats
+        GLfloat     depth = 1.0f;
+        GLint       stencil = 0;
+    } clearValue_t;
+
+    typedef struct passAttachment_t
+    {
+        GLenum              attachment = GL_COLOR_ATTACHMENT0;
+        const Texture*      texture = nullptr;          // texture or renderbuffer
+        const RenderBuffer* renderBuffer = nullptr;
+        GLint               level = 0;
+        GLint               layer = -1;                 // -1 for all the layers
+        loadOp_t            load = LOAD_OP_LOAD;
+        storeOp_t           store = STORE_OP_STORE;
+        clearValue_t        clear;
+
+        /// @brief render to the target samples and resolve the render area at End,
+        /// texture and renderBuffer are ignored. Whit STORE_OP_DONT_CARE the samples are invalidated after the resolve
+        MsaaTarget*         msaa = nullptr;
+    } passAttachment_t;
+
+    typedef struct renderPassStats_t
+    {
+        uint64_t    passes = 0;
+        uint64_t    clears = 0;         // attachments cleared
+        uint64_t    invalidates = 0;    // attachments invalidated, on load and store
+        uint64_t    resolves = 0;       // multisample attachments resolved at End
+    } renderPassStats_t;
+
+    /// @brief Scope rendering to a set of attachments whit explicit load and store operations.
+    /// Begin bind the attachments framebuffer, set the viewport to the attachments size ( or the
+    /// render area ), clear the LOAD_OP_CLEAR attachments whit glClearNamedFramebuffer* and
+    /// invalidate the LOAD_OP_DONT_CARE ones. End invalidate the STORE_OP_DONT_CARE attachments,
+    /// so tilers and software rasterizers skip loading and storing contents nobody need.
+    /// MsaaTarget attachments are resolved at End, before the store invalidation.
+    /// The load clears always clear the whole area, regardless of the write masks and scissor.
+    class RenderPass
+    {
+    public:
+        RenderPass( void );
+        ~RenderPass( void );
+
+        /// @brief in_cache the framebuffers source, nullptr for a private cache
+        bool    Create( FrameBufferCache* in_cache = nullptr );
+        void    Destroy( void );
+
+        /// @brief start the pass, call whit the context current
+        /// @param in_renderArea area rendered, nullptr for the whole attachments
+        /// @return false if there is no context current or the attachments don't make a complete framebuffer
+        bool    Begin( const passAttachment_t* in_attachments, const GLuint in_count, const rect_t* in_renderArea = nullptr );
+
+        /// @brief finish the pass and bind back the default framebuffer
+        void    End( void );
+
+        /// @brief the current pass framebuffer, 0 outside a pass
+        GLuint  FrameBuffer( void ) const;
+
+        /// @brief the current pass attachments size
+        GLsizei Width( void ) const;
+        GLsizei Height( void ) const;
+
+        renderPassStats_t   Stats( void ) const;
+
+    private:
+        glCoreRenderPass_t* m_pass;
+    };
+};
+
+#endif //!__CRGL_RENDER_PASS_HPP__
@@ -0,0 +1,97 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#ifndef __CRGL_RENDER_TARGET_POOL_HPP__
+#define __CRGL_RENDER_TARGET_POOL_HPP__
+
+typedef struct glCoreRenderTargetPool_t glCoreRenderTargetPool_t;
+
+namespace gl
+{
+    /// @brief renderbuffer description, the RenderBuffer::Create parameters
+    typedef struct renderBufferInfo_t
+    {
+        GLuint      width = 0;
+        GLuint      height = 0;
+        GLuint      samples = 0;
+        GLenum      format = GL_NONE;
+    } renderBufferInfo_t;
+
+    typedef struct renderTargetPoolStats_t
+    {
+        GLuint      textures = 0;       // live pooled textures
+        GLuint      renderBuffers = 0;  // live pooled renderbuffers
+        GLuint      inUse = 0;          // targets acquired and not released
+        uint64_t    created = 0;        // acquires that allocated a new target
+        uint64_t    reused = 0;         // acquires served from the pool
+        uint64_t    trimmed = 0;        // targets destroyed for being unused
+        uint64_t    bytes = 0;          // memory held by the pool
+        uint64_t    highWater = 0;      // max memory held at once
+    } renderTargetPoolStats_t;
+
+    /// @brief Recycle the transient render targets ( bloom chains, SSAO buffers, ... ).
+    /// The targets are looked up by a hash of the description, a free one whit the same
+    /// description is handed back instead of allocating a new one. The targets still acquired
+    /// return to the pool at EndFrame, the ones left unused for trimFrames are destroyed.
+    class RenderTargetPool
+    {
+    public:
+        struct createInfo_t
+        {
+            /// @brief frames a free target is kept before being destroyed
+            GLuint      trimFrames = 3;
+        };
+
+        RenderTargetPool( void );
+        ~RenderTargetPool( void );
+
+        bool    Create( const createInfo_t* in_createInfo );
+        void    Destroy( void );
+
+        /// @brief a texture matching the description, valid until released or EndFrame
+        /// @return nullptr if the texture can't be created ( sparse textures are not pooled )
+        Texture*        AcquireTexture( const Texture::createInfo_t* in_createInfo );
+
+        /// @brief a renderbuffer matching the description, valid until released or EndFrame
+        RenderBuffer*   AcquireRenderBuffer( const renderBufferInfo_t* in_createInfo );
+
+        /// @brief give back a target before the end of the frame, so a later pass can reuse it
+        void    Release( const Texture* in_texture );
+        void    Release( const RenderBuffer* in_renderBuffer );
+
+        /// @brief release all the acquired targets and trim the unused ones, call once per frame
+        void    EndFrame( void );
+
+        /// @brief destroy all the free targets
+        void    Trim( void );
+
+        renderTargetPoolStats_t Stats( void ) const;
+
+        /// @brief the description hash, equal descriptions give the same hash
+        static uint64_t Hash( const Texture::createInfo_t* in_createInfo );
+        static uint64_t Hash( const renderBufferInfo_t* in_createInfo );
+
+    private:
+        glCoreRenderTargetPool_t*   m_pool;
+    };
+};
+
+#endif //!__CRGL_RENDER_TARGET_POOL_HPP__
@@ -0,0 +1,43 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#ifndef __CRGL_RESOURCE_JOB_HPP__
+#define __CRGL_RESOURCE_JOB_HPP__
+
+namespace gl
+{
+    /// @brief Resource creation / upload work run on a shared worker context.
+    /// The job must stay alive until Complete is called, Complete may delete it.
+    class ResourceJob
+    {
+    public:
+        virtual ~ResourceJob( void ) {}
+
+        /// @brief called on a worker thread, whit a context that share objects whit the main one current
+        virtual void    Execute( void ) = 0;
+
+        /// @brief called on the main context thread, after the main context waited the job fence,
+        /// the objects created on Execute are safe to use from here
+        virtual void    Complete( void ) {}
+    };
+};
+
+#endif //!__CRGL_RESOURCE_JOB_HPP__
@@ -82,6 +82,9 @@ namespace gl
 
             /// @brief 
             GLboolean       fixedsamplelocations;
+
+            /// @brief reserve only the virtual address space ( GL_ARB_sparse_texture ), the pages are commited by Commit
+            bool            sparse = false;
         }; 
 
         Texture( void );
@@ -159,6 +162,28 @@ namespace gl
         void GetParameterfv(  const GLenum in_pName, GLfloat* m_params ) const;
         GLuint Handle( void ) const;
         GLenum Target( void ) const;
+        Format PixelFormat( void ) const;
+        GLsizei Levels( void ) const;
+        dimensions_t Dimensions( void ) const;
+
+        /// @brief restrict the sampling to in_level and coarser ones, for progressive streaming
+        /// set GL_TEXTURE_BASE_LEVEL, the lod is computed from the base so GL_TEXTURE_MIN_LOD is not touched
+        void SetResidentLevel( const GLint in_level );
+        GLint ResidentLevel( void ) const;
+
+        /// @brief commit or release the physical memory of a sparse texture region
+        /// the region must be aligned to the page size, or reach the level edges
+        void Commit( const GLint in_level, const offsets_t in_offsets, const dimensions_t in_dimensions, const bool in_commit ) const;
+
+        /// @brief true if created whit createInfo_t::sparse
+        bool IsSparse( void ) const;
+
+        /// @brief number of levels that can be partially commited, the smaller ones make the mip tail
+        GLint SparseLevels( void ) const;
+
+        /// @brief virtual page size of a sparse format ( GL_VIRTUAL_PAGE_SIZE_*_ARB index 0 )
+        /// @return false if the format can't be sparse
+        static bool PageSize( const GLenum in_target, const GLenum in_internalFormat, dimensions_t* in_pageSize );
 
         operator GLuint( void ) const;
 
@@ -0,0 +1,119 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#ifndef __CRGL_TEXTURE_ATLAS_HPP__
+#define __CRGL_TEXTURE_ATLAS_HPP__
+
+typedef struct glCoreTextureAtlas_t glCoreTextureAtlas_t;
+
+namespace gl
+{
+    /// @brief location of a image inside the atlas
+    typedef struct atlasRect_t
+    {
+        GLfloat     u0 = 0.0f;      // normalized coordinates of the image, padding excluded
+        GLfloat     v0 = 0.0f;
+        GLfloat     u1 = 0.0f;
+        GLfloat     v1 = 0.0f;
+        GLint       layer = 0;      // array texture layer ( page )
+        GLint       x = 0;          // texel coordinates
+        GLint       y = 0;
+        GLsizei     width = 0;
+        GLsizei     height = 0;
+    } atlasRect_t;
+
+    typedef struct textureAtlasStats_t
+    {
+        GLuint      images = 0;     // live images
+        GLuint      pages = 0;      // array layers allocated
+        uint64_t    usedArea = 0;   // texels used by live images, padding included
+        uint64_t    freedArea = 0;  // texels of removed images not reclaimed yet
+        uint64_t    inserts = 0;
+        uint64_t    failed = 0;     // inserts that didn't fit
+        uint64_t    repacks = 0;
+    } textureAtlasStats_t;
+
+    /// @brief Pack many small images in the pages of a TEXTURE_2D_ARRAY, so draws using
+    /// diferent images can be batched whit a single texture bind.
+    /// Each page is filled by a skyline allocator ( bottom left ), removed images leave holes
+    /// that are reclaimed when the page become empty or by a repack, that move the live images
+    /// whit glCopyImageSubData. The rects of the images change on repack, check Generation.
+    class TextureAtlas
+    {
+    public:
+        struct createInfo_t
+        {
+            /// @brief page dimensions
+            GLsizei     width = 2048;
+            GLsizei     height = 2048;
+
+            /// @brief pages created up front, more are added on demand until maxPages
+            GLsizei     pages = 1;
+            GLsizei     maxPages = 16;
+
+            Format      format = Format( GL_RGBA8 );
+
+            /// @brief empty texels around each image, avoid bleeding whit linear filtering
+            GLint       padding = 1;
+
+            /// @brief when a image don't fit and the freed area reach this fraction of the
+            /// used area the atlas is repacked before adding a page, 0 disable
+            GLfloat     repackThreshold = 0.25f;
+        };
+
+        TextureAtlas( void );
+        ~TextureAtlas( void );
+
+        bool    Create( const createInfo_t* in_createInfo );
+        void    Destroy( void );
+
+        /// @brief allocate space for a image and upload it
+        /// @param in_pixels tightly packed pixels in the atlas format transfer layout, nullptr to only reserve
+        /// @return image id, 0 if it don't fit
+        GLuint  Insert( const GLsizei in_width, const GLsizei in_height, const void* in_pixels );
+
+        /// @brief release a image space
+        void    Remove( const GLuint in_id );
+
+        /// @brief replace the pixels of a image
+        void    Upload( const GLuint in_id, const void* in_pixels ) const;
+
+        /// @brief retrieve the image location
+        bool    Rect( const GLuint in_id, atlasRect_t* in_rect ) const;
+
+        /// @brief pack all the live images again, reclaiming the removed images space
+        /// @return false if the images don't fit anymore, the atlas is left unchanged
+        bool    Repack( void );
+
+        /// @brief incremented each time the images move, the rects must be retrieved again
+        uint64_t    Generation( void ) const;
+
+        /// @brief the TEXTURE_2D_ARRAY, recreated when pages are added
+        const Texture*  GetTexture( void ) const;
+
+        textureAtlasStats_t Stats( void ) const;
+
+    private:
+        glCoreTextureAtlas_t*   m_atlas;
+    };
+};
+
+#endif //!__CRGL_TEXTURE_ATLAS_HPP__
@@ -0,0 +1,96 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#ifndef __CRGL_TEXTURE_UPLOADER_HPP__
+#define __CRGL_TEXTURE_UPLOADER_HPP__
+
+typedef struct glCoreTextureUploader_t  glCoreTextureUploader_t;
+
+namespace gl
+{
+    /// @brief a piece of the staging ring, written by the caller before Upload
+    typedef struct uploadRegion_t
+    {
+        void*       data = nullptr;     // mapped pointer to write the pixels
+        GLsizeiptr  offset = 0;         // offset in the staging buffer
+        GLsizeiptr  size = 0;
+        uint64_t    id = 0;
+    } uploadRegion_t;
+
+    typedef struct textureUploaderStats_t
+    {
+        uint64_t    uploads = 0;        // SubImage calls issued
+        uint64_t    bytes = 0;          // bytes uploaded
+        uint64_t    failed = 0;         // allocations refused because the ring was full
+        GLsizeiptr  inUse = 0;          // bytes allocated and not recycled yet
+    } textureUploaderStats_t;
+
+    /// @brief Stream texture data through a persistently mapped pixel unpack ring.
+    /// Allocate and Upload can be called from any thread, the pixels are writed directly in the
+    /// staging memory. Flush, on the GL thread, issue the SubImage calls from buffer offsets
+    /// and fence them, the regions are recycled when the GPU is done whit they.
+    class TextureUploader
+    {
+    public:
+        struct createInfo_t
+        {
+            /// @brief staging ring size
+            GLsizeiptr  size = 64 * 1024 * 1024;
+
+            /// @brief regions offset alignment
+            GLsizeiptr  alignment = 256;
+        };
+
+        TextureUploader( void );
+        ~TextureUploader( void );
+
+        /// @brief allocate and map the ring, call whit the context current
+        bool    Create( const createInfo_t* in_createInfo );
+
+        /// @brief wait the uploads in flight and release the ring, call whit the context current
+        void    Destroy( void );
+
+        /// @brief reserve staging memory, safe to call from any thread
+        /// @return false if the ring don't have space now, try again after a Flush
+        bool    Allocate( const GLsizeiptr in_size, uploadRegion_t* in_region );
+
+        /// @brief queue the region upload to a texture, safe to call from any thread
+        /// the texture must be alive until the next Flush
+        bool    Upload( const uploadRegion_t* in_region, Texture* in_texture, const Texture::subImage_t* in_subImage );
+
+        /// @brief give back a region that will not be uploaded
+        void    Discard( const uploadRegion_t* in_region );
+
+        /// @brief allocate, copy and queue in one call
+        bool    Upload( Texture* in_texture, const Texture::subImage_t* in_subImage, const void* in_pixels, const GLsizeiptr in_size );
+
+        /// @brief issue the queued uploads and recycle the finished regions, call on the GL thread
+        /// @return number of uploads issued
+        GLuint  Flush( void );
+
+        textureUploaderStats_t  Stats( void ) const;
+
+    private:
+        glCoreTextureUploader_t*    m_uploader;
+    };
+};
+
+#endif //!__CRGL_TEXTURE_UPLOADER_HPP__
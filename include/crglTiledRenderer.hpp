@@ -0,0 +1,141 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+
+#ifndef __CRGL_TILED_RENDERER_HPP__
+#define __CRGL_TILED_RENDERER_HPP__
+
+typedef struct glCoreTiledRenderer_t    glCoreTiledRenderer_t;
+
+namespace gl
+{
+    /// @brief a region of the final image
+    typedef struct tile_t
+    {
+        GLuint      column = 0;             // tile index, row 0 is the image top
+        GLuint      row = 0;
+        GLuint      x = 0;                  // region in the image, in pixels, origin at the bottom left like OpenGL
+        GLuint      y = 0;
+        GLuint      width = 0;
+        GLuint      height = 0;
+        GLuint      imageWidth = 0;
+        GLuint      imageHeight = 0;
+
+        /// @brief column major matrix mapping the whole image clip space to the tile one,
+        /// multiply it on the left of the image projection ( see TiledRenderer::TileProjection )
+        GLfloat     offset[16] = { 1.0f, 0.0f, 0.0f, 0.0f,  0.0f, 1.0f, 0.0f, 0.0f,  0.0f, 0.0f, 1.0f, 0.0f,  0.0f, 0.0f, 0.0f, 1.0f };
+    } tile_t;
+
+    /// @brief the scene drawn in each tile
+    class TiledScene
+    {
+    public:
+        virtual ~TiledScene( void ) {}
+
+        /// @brief draw the tile, whit the tile framebuffer bound and the viewport covering the tile region
+        /// on a render farm it is called from the farm threads, each one whit its own context
+        virtual void    Render( Context* in_context, const tile_t* in_tile ) = 0;
+    };
+
+    /// @brief receive the finished image rows, top to bottom, tightly packed
+    /// @param in_first first row index, from the image top
+    /// @return false to abort the rendering
+    typedef bool ( *tiledRowsWriter_t )( const void* in_rows, const GLuint in_first, const GLuint in_count, const GLsizeiptr in_stride, void* in_userData );
+
+    typedef struct tiledRendererStats_t
+    {
+        uint64_t    tiles = 0;              // tiles rendered
+        uint64_t    bands = 0;              // tile rows stitched and written
+        uint64_t    bytesWritten = 0;       // image bytes handed to the output
+        uint64_t    bandBytes = 0;          // stitching memory, a single tile row
+    } tiledRendererStats_t;
+
+    /// @brief Render images bigger than the texture, viewport and memory limits.
+    /// The image is split in tiles that fit in a framebuffer, each tile is rendered whit a
+    /// projection offset, read back asynchronously and copied in a band that hold a single
+    /// row of tiles. Complete bands are streamed to the output file or callback, so only
+    /// width * tileHeight pixels are kept in memory.
+    /// The tiles run in sequence on the current context or spread over a RenderFarm.
+    class TiledRenderer
+    {
+    public:
+        struct createInfo_t
+        {
+            /// @brief final image size
+            GLuint              width = 0;
+            GLuint              height = 0;
+
+            /// @brief tile size, 0 for the largest the context support, capped to 2048
+            /// whit a farm it must fit in the farm framebuffer and can't be 0
+            GLuint              tileWidth = 0;
+            GLuint              tileHeight = 0;
+
+            /// @brief color format, the readback use the format transfer type
+            /// whit a farm it must match the farm color format, Create fail otherwise
+            Format              colorFormat = GL_RGBA8;
+
+            /// @brief depth attachment format of the sequential framebuffer, GL_NONE for no depth buffer
+            GLenum              depthFormat = GL_DEPTH24_STENCIL8;
+
+            /// @brief sequential readbacks in flight
+            GLuint              readbackDepth = 3;
+
+            /// @brief spread the tiles over the farm workers, nullptr to render on the current context
+            RenderFarm*         farm = nullptr;
+
+            /// @brief output file, binary PPM / PGM / PAM, only 8 bits per channel formats, nullptr for none
+            const char*         path = nullptr;
+
+            /// @brief output callback, called from the readback thread, nullptr for none
+            tiledRowsWriter_t   writer = nullptr;
+            void*               userData = nullptr;
+        };
+
+        TiledRenderer( void );
+        ~TiledRenderer( void );
+
+        /// @brief check the limits and create the sequential framebuffer, whit the context current
+        bool    Create( const createInfo_t* in_createInfo );
+        void    Destroy( void );
+
+        /// @brief render every tile and write the image, block until the image is written
+        /// @return false if a output failed or the tiles can't be rendered
+        bool    Render( TiledScene* in_scene );
+
+        GLuint  Columns( void ) const;
+        GLuint  Rows( void ) const;
+
+        /// @brief description of the tile at column, row
+        tile_t  Tile( const GLuint in_column, const GLuint in_row ) const;
+
+        tiledRendererStats_t    Stats( void ) const;
+
+        /// @brief the projection of a tile, in_tile->offset * in_projection
+        /// @param in_projection column major image projection
+        /// @param in_result column major tile projection
+        static void TileProjection( const tile_t* in_tile, const GLfloat* in_projection, GLfloat* in_result );
+
+    private:
+        glCoreTiledRenderer_t*  m_renderer;
+    };
+};
+
+#endif //!__CRGL_TILED_RENDERER_HPP__
@@ -0,0 +1,99 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#ifndef __CRGL_VIDEO_TEXTURE_HPP__
+#define __CRGL_VIDEO_TEXTURE_HPP__
+
+typedef struct glCoreVideoTexture_t glCoreVideoTexture_t;
+
+namespace gl
+{
+    enum videoFormat_t
+    {
+        VIDEO_NV12 = 0,     // 8 bit Y ( R8 ), interleaved UV at half resolution ( RG8 )
+        VIDEO_I420,         // 8 bit Y, U and V planes ( R8 ), chroma at half resolution
+        VIDEO_P010          // 10 bit in the high bits of 16 bit words, Y ( R16 ) and interleaved UV ( RG16 )
+    };
+
+    static constexpr GLuint k_VIDEO_MAX_PLANES = 3;
+
+    /// @brief a decoded plane as the decoder give it
+    typedef struct videoPlane_t
+    {
+        const void*     data = nullptr;
+        GLsizei         stride = 0;     // bytes between two rows, 0 for tightly packed
+    } videoPlane_t;
+
+    /// @brief Planar YUV frames uploaded as is, one texture per plane.
+    /// The planes are copied in a persistently mapped pixel unpack ring and uploaded whit
+    /// GL_UNPACK_ROW_LENGTH, so the decoder strides don't need to be repacked.
+    /// The RGB conversion happen when sampling, whit the GLSL from ShaderSource.
+    class VideoTexture
+    {
+    public:
+        struct createInfo_t
+        {
+            videoFormat_t   format = VIDEO_NV12;
+            GLuint          width = 0;
+            GLuint          height = 0;
+
+            /// @brief frames the ring hold before the upload wait the GPU
+            GLuint          ringFrames = 3;
+
+            /// @brief expected luma stride in bytes, strides up to it are copied in a single block
+            GLsizei         strideHint = 0;
+        };
+
+        VideoTexture( void );
+        ~VideoTexture( void );
+
+        /// @brief create the planes textures and the upload ring, call whit the context current
+        bool    Create( const createInfo_t* in_createInfo );
+        void    Destroy( void );
+
+        /// @brief upload a frame
+        /// @param in_planes NumPlanes planes, luma first
+        /// @return false if the planes don't match the format
+        bool    Upload( const videoPlane_t* in_planes, const GLuint in_count );
+
+        /// @brief bind the planes to consecutive texture units, in the ShaderSource samplers order
+        /// through the current context cache, the units sampler is reset to 0 so the planes filtering apply
+        void    Bind( const GLuint in_firstUnit ) const;
+
+        GLuint          NumPlanes( void ) const;
+        const Texture*  Plane( const GLuint in_plane ) const;
+
+        /// @brief number of uploads that waited a ring slot still in use by the GPU
+        uint64_t        Stalls( void ) const;
+
+        /// @brief GLSL sampling helpers, paste after the #version line.
+        /// vec3 crglSampleNV12( sampler2D y, sampler2D uv, vec2 coord )
+        /// vec3 crglSampleI420( sampler2D y, sampler2D u, sampler2D v, vec2 coord )
+        /// vec3 crglSampleP010( sampler2D y, sampler2D uv, vec2 coord )
+        /// BT.709 video range by default, define CRGL_YUV_BT601 and / or CRGL_YUV_FULL_RANGE before it to change
+        static const char*  ShaderSource( void );
+
+    private:
+        glCoreVideoTexture_t*   m_video;
+    };
+};
+
+#endif //!__CRGL_VIDEO_TEXTURE_HPP__
@@ -0,0 +1,128 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#ifndef __CRGL_VIRTUAL_TEXTURE_HPP__
+#define __CRGL_VIRTUAL_TEXTURE_HPP__
+
+typedef struct glCoreVirtualTexture_t   glCoreVirtualTexture_t;
+
+namespace gl
+{
+    /// @brief provide the texels of a virtual texture tile, called on the GL thread by VirtualTexture::Update
+    class TileSource
+    {
+    public:
+        virtual ~TileSource( void ) {}
+
+        /// @brief write in_width x in_height texels, tightly packed, of the tile in_x, in_y of in_level
+        /// the tiles on the level edges can be smaller than the tile size
+        /// @return false if the tile is not available, it is skipped until requested again
+        virtual bool    LoadTile( const GLint in_level, const GLuint in_x, const GLuint in_y, const GLuint in_width, const GLuint in_height, void* in_destine, const GLsizeiptr in_size ) = 0;
+    };
+
+    typedef struct virtualTextureStats_t
+    {
+        GLuint      resident = 0;       // tiles resident now
+        GLuint      capacity = 0;       // max tiles resident
+        uint64_t    requests = 0;       // tiles requested
+        uint64_t    misses = 0;         // requested tiles not resident
+        uint64_t    loads = 0;          // tiles loaded
+        uint64_t    evictions = 0;      // tiles evicted
+    } virtualTextureStats_t;
+
+    /// @brief Texture bigger than the memory budget, only the tiles in use are resident.
+    /// Whit GL_ARB_sparse_texture ( and glTexturePageCommitmentEXT loaded ) the tiles are the virtual pages of a sparse texture, commited
+    /// and released on demand. Whitout it a software page table is used: a physical cache atlas
+    /// plus a indirection texture, sampled whit the GLSL from ShaderSource.
+    /// The tiles are loaded by priority ( coarse levels first ) and evicted least recently used.
+    class VirtualTexture
+    {
+    public:
+        struct createInfo_t
+        {
+            /// @brief virtual size and mip levels
+            GLuint      width = 0;
+            GLuint      height = 0;
+            GLsizei     levels = 1;
+            Format      format = Format( GL_RGBA8 );
+
+            /// @brief tile size of the software page table, the sparse path use the page size
+            GLuint      tileSize = 128;
+
+            /// @brief tiles resident at once
+            GLuint      cacheTiles = 256;
+
+            /// @brief tiles loaded by a Update
+            GLuint      tilesPerUpdate = 16;
+
+            /// @brief false to force the software page table
+            bool        allowSparse = true;
+        };
+
+        VirtualTexture( void );
+        ~VirtualTexture( void );
+
+        /// @brief create the textures, call whit the context current
+        bool    Create( const createInfo_t* in_createInfo, TileSource* in_source );
+        void    Destroy( void );
+
+        /// @brief mark a tile as needed this frame, usually from a feedback pass
+        void    Request( const GLint in_level, const GLuint in_x, const GLuint in_y );
+
+        /// @brief request all the tiles of a level covering the normalized region
+        void    RequestRegion( const GLint in_level, const GLfloat in_u0, const GLfloat in_v0, const GLfloat in_u1, const GLfloat in_v1 );
+
+        /// @brief load the missing requested tiles and update the page table, call once per frame
+        /// @return number of tiles loaded
+        GLuint  Update( void );
+
+        bool    IsResident( const GLint in_level, const GLuint in_x, const GLuint in_y ) const;
+
+        /// @brief true when the hardware sparse path is in use
+        bool    IsSparse( void ) const;
+
+        /// @brief tile size in texels
+        GLuint  TileWidth( void ) const;
+        GLuint  TileHeight( void ) const;
+
+        /// @brief tiles count of a level
+        GLuint  TilesX( const GLint in_level ) const;
+        GLuint  TilesY( const GLint in_level ) const;
+
+        /// @brief the sparse texture, or the physical cache atlas of the software path
+        const Texture*  Physical( void ) const;
+
+        /// @brief software path indirection, a GL_RGBA16UI 2D array, one layer per level
+        /// each texel hold the atlas tile x, y, the level of that tile and 1 if valid
+        const Texture*  PageTable( void ) const;
+
+        virtualTextureStats_t   Stats( void ) const;
+
+        /// @brief GLSL for the software path, paste after the #version line
+        /// vec4 crglVirtualSample( sampler2D atlas, usampler2DArray pageTable, vec2 coord, float level, vec2 virtualSize, float tileSize )
+        static const char*  ShaderSource( void );
+
+    private:
+        glCoreVirtualTexture_t* m_virtual;
+    };
+};
+
+#endif //!__CRGL_VIRTUAL_TEXTURE_HPP__
@@ -0,0 +1,89 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#ifndef __CRGL_YUV_CONVERTER_HPP__
+#define __CRGL_YUV_CONVERTER_HPP__
+
+typedef struct glCoreYuvConverter_t glCoreYuvConverter_t;
+
+namespace gl
+{
+    enum yuvLayout_t
+    {
+        YUV_NV12 = 0,       // Y plane, then a interleaved UV plane at half resolution
+        YUV_I420            // Y plane, then U and V planes at half resolution
+    };
+
+    enum yuvMatrix_t
+    {
+        YUV_BT601 = 0,      // SD
+        YUV_BT709           // HD
+    };
+
+    /// @brief Convert a RGBA texture to planar 8 bit YUV 4:2:0 whit a compute pass.
+    /// The planes are writed tightly packed in a buffer, bound as SSBO, ready to feed a encoder.
+    /// It is a FrameConverter, so the conversion can run in the FrameReader readback.
+    /// The width must be a multiple of 8 and the height a multiple of 2.
+    class YuvConverter : public FrameConverter
+    {
+    public:
+        struct createInfo_t
+        {
+            yuvLayout_t     layout = YUV_NV12;
+            yuvMatrix_t     matrix = YUV_BT709;
+
+            /// @brief false for video range ( Y 16-235, UV 16-240 ), true for 0-255
+            bool            fullRange = false;
+
+            /// @brief write the first row from the top of the image, GL images start at the bottom
+            bool            flipY = false;
+        };
+
+        YuvConverter( void );
+        ~YuvConverter( void );
+
+        /// @brief build the compute program, call whit the context current
+        bool    Create( const createInfo_t* in_createInfo );
+        void    Destroy( void );
+
+        /// @brief width * height * 3 / 2
+        virtual GLsizeiptr  OutputSize( const GLuint in_width, const GLuint in_height ) const override;
+
+        /// @brief convert in_source level 0 into in_buffer, at least OutputSize bytes
+        virtual bool        Convert( const GLuint in_source, const GLuint in_width, const GLuint in_height, const GLuint in_buffer ) override;
+
+        /// @brief CPU reference of the conversion, same rounding as the GPU pass
+        /// @param in_rgba RGBA8 pixels, in_stride bytes per row
+        /// @param in_output OutputSize bytes
+        void    Reference( const uint8_t* in_rgba, const GLuint in_width, const GLuint in_height, const GLsizei in_stride, uint8_t* in_output ) const;
+
+        /// @brief self check, convert a generated image on the GPU and whit Reference and compare the planes,
+        /// call whit the context current, the differences are reported to DebugOuput
+        /// @param in_tolerance max difference per byte, the GPU float rounding can differ by 1
+        /// @return true if every byte is within in_tolerance
+        bool    Verify( const GLuint in_width, const GLuint in_height, const GLuint in_tolerance = 1 );
+
+    private:
+        glCoreYuvConverter_t*   m_converter;
+    };
+};
+
+#endif //!__CRGL_YUV_CONVERTER_HPP__
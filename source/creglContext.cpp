@@ -22,9 +22,129 @@
 #include "crglPrecompiled.hpp"
 #include "creglContext.hpp"
 
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
+typedef struct eglCompletedJob_t
+{
+    gl::ResourceJob*    job = nullptr;
+    GLsync              fence = nullptr;    // signaled when the job commands are done
+} eglCompletedJob_t;
+
+typedef struct eglWorker_t
+{
+    egl::Context        context;
+    std::thread         thread;
+} eglWorker_t;
+
+typedef struct eglWorkerPool_t
+{
+    std::mutex                                  lock;
+    std::condition_variable                     wake;
+    std::deque<gl::ResourceJob*>                jobs;
+    bool                                        quit = false;
+
+    // startup handshake, CreateWorkers wait every worker to report
+    std::condition_variable                     started;
+    GLuint                                      starting = 0;
+    std::vector<const egl::Context*>            failed;
+    
+    std::mutex                                  completedLock;
+    std::vector<eglCompletedJob_t>              completed;
+
+    std::atomic<GLuint>                         pending{ 0 };
+    std::vector<std::unique_ptr<eglWorker_t>>   workers;
+} eglWorkerPool_t;
+
+static void BuildContextAttribs( const egl::Context::createInfo_t* in_createInfo, std::vector<EGLint>& in_attribs )
+{
+    in_attribs.push_back( EGL_CONTEXT_MAJOR_VERSION_KHR );
+    in_attribs.push_back( in_createInfo->verMaj );
+    in_attribs.push_back( EGL_CONTEXT_MINOR_VERSION_KHR );
+    in_attribs.push_back( in_createInfo->verMin );
+    
+    in_attribs.push_back( EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR );
+    if ( in_createInfo->core )
+        in_attribs.push_back( EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR );
+    else
+        in_attribs.push_back( EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT_KHR );
+
+    in_attribs.push_back( EGL_CONTEXT_OPENGL_DEBUG );
+    if ( in_createInfo->debug )
+        in_attribs.push_back( EGL_TRUE );
+    else
+        in_attribs.push_back( EGL_FALSE );
+
+    // finish atrib list
+    in_attribs.push_back( EGL_NONE );
+}
+
+typedef struct eglDeviceFunctions_t
+{
+    PFNEGLQUERYDEVICESEXTPROC           QueryDevices = nullptr;
+    PFNEGLQUERYDEVICESTRINGEXTPROC      QueryDeviceString = nullptr;
+} eglDeviceFunctions_t;
+
+static bool HasEGLExtension( const char* in_extensions, const char* in_name )
+{
+    const size_t length = std::strlen( in_name );
+    const char* found = in_extensions;
+
+    if ( in_extensions == nullptr )
+        return false;
+
+    // match whole names only, EGL_EXT_device_base is not EGL_EXT_device_base_foo
+    while ( ( found = std::strstr( found, in_name ) ) != nullptr )
+    {
+        if ( ( found == in_extensions || found[-1] == ' ' ) && ( found[length] == ' ' || found[length] == '\0' ) )
+            return true;
+
+        found += length;
+    }
+
+    return false;
+}
+
+static const eglDeviceFunctions_t* DeviceFunctions( void )
+{
+    static const eglDeviceFunctions_t s_functions = []( void )
+    {
+        eglDeviceFunctions_t functions;
+        const char* clientExtensions = eglQueryString( EGL_NO_DISPLAY, EGL_EXTENSIONS );
+
+        // EGL_EXT_device_base is the old name of enumeration + query
+        if ( !HasEGLExtension( clientExtensions, "EGL_EXT_device_enumeration" ) && !HasEGLExtension( clientExtensions, "EGL_EXT_device_base" ) )
+            return functions;
+
+        functions.QueryDevices = reinterpret_cast<PFNEGLQUERYDEVICESEXTPROC>( eglGetProcAddress( "eglQueryDevicesEXT" ) );
+        functions.QueryDeviceString = reinterpret_cast<PFNEGLQUERYDEVICESTRINGEXTPROC>( eglGetProcAddress( "eglQueryDeviceStringEXT" ) );
+        return functions;
+    }();
+
+    return &s_functions;
+}
+
+egl::Context::Context( void ) : 
+    m_display( EGL_NO_DISPLAY ),
+    m_context( EGL_NO_CONTEXT ),
+    m_surface( EGL_NO_SURFACE ),
+    m_config( nullptr ),
+    m_workers( nullptr )
+{
+}
+
+egl::Context::~Context( void )
+{
+    Destroy();
+}
+
 bool egl::Context::Create(const void *in_windowHandle)
 {
 
@@ -42,7 +162,18 @@ bool egl::Context::Create(const void *in_windowHandle)
     }
 
     // Display initialization sequence
-    m_display = eglGetPlatformDisplay( contextCI->platform, contextCI->nativeDisplay, nullptr );
+    if ( contextCI->device != EGL_NO_DEVICE_EXT )
+    {
+        // a explicit device was asked, don't fallback to other one
+        m_display = eglGetPlatformDisplay( EGL_PLATFORM_DEVICE_EXT, contextCI->device, nullptr );
+        if ( m_display == EGL_NO_DISPLAY ) 
+        {
+            DebugOuput("EGL error: eglGetPlatformDisplay failed for the requested device\n" );
+            return false;
+        }
+    }
+    else
+        m_display = eglGetPlatformDisplay( contextCI->platform, contextCI->nativeDisplay, nullptr );
     
     // fallback
     if ( m_display == EGL_NO_DISPLAY ) 
@@ -102,6 +233,10 @@ bool egl::Context::Create(const void *in_windowHandle)
 
     if (num_config == 0) 
         return false;
+
+    // keep it to create the shared worker contexts
+    m_config = config;
+    m_createInfo = *contextCI;
     
     eglBindAPI(EGL_OPENGL_API); // using OpenGL desktop
 
@@ -137,25 +272,7 @@ bool egl::Context::Create(const void *in_windowHandle)
         m_surface = eglCreateWindowSurface( m_display, config, contextCI->nativeWindow, surface_attribs.data() );
     }
 
-    context_attribs.push_back( EGL_CONTEXT_MAJOR_VERSION_KHR );
-    context_attribs.push_back( contextCI->verMaj );
-    context_attribs.push_back( EGL_CONTEXT_MINOR_VERSION_KHR );
-    context_attribs.push_back( contextCI->verMin );
-    
-    context_attribs.push_back( EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR );
-    if ( contextCI->core )
-        context_attribs.push_back( EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR );
-    else
-        context_attribs.push_back( EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT_KHR );
-
-    context_attribs.push_back( EGL_CONTEXT_OPENGL_DEBUG );
-    if ( contextCI->debug )
-        context_attribs.push_back( EGL_TRUE );
-    else
-        context_attribs.push_back( EGL_FALSE );
-
-        // finish atrib list
-    context_attribs.push_back( EGL_NONE );
+    BuildContextAttribs( contextCI, context_attribs );
 
     m_context = eglCreateContext( m_display, config, EGL_NO_CONTEXT, context_attribs.data() );
     if ( m_context == EGL_NO_CONTEXT)
@@ -175,6 +292,9 @@ bool egl::Context::Create(const void *in_windowHandle)
 
 void egl::Context::Destroy(void)
 {
+    if ( m_workers != nullptr )
+        DestroyWorkers();
+
     if ( m_context != nullptr )
     {
         eglDestroyContext( m_display, m_context );
@@ -190,12 +310,20 @@ void egl::Context::Destroy(void)
 
 bool egl::Context::MakeCurrent(void)
 {
-    return eglMakeCurrent( m_display, m_surface, nullptr, m_context ) == EGL_TRUE;
+    if ( eglMakeCurrent( m_display, m_surface, m_surface, m_context ) != EGL_TRUE )
+        return false;
+
+    SetCurrent( this );
+    return true;
 }
 
 bool egl::Context::Release(void)
 {
-    return eglMakeCurrent( m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT ) == EGL_TRUE;
+    if ( eglMakeCurrent( m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT ) != EGL_TRUE )
+        return false;
+
+    SetCurrent( nullptr );
+    return true;
 }
 
 bool egl::Context::SwapBuffers(void)
@@ -212,3 +340,315 @@ void egl::Context::DebugOuput(const char *in_message) const
 {
     std::cerr << in_message;
 }
+
+bool egl::Context::CreateWorkers( const GLuint in_count, const bool in_surfaceless )
+{
+    if ( m_context == EGL_NO_CONTEXT || in_count == 0 )
+        return false;
+
+    if ( m_workers != nullptr )
+        DestroyWorkers();
+
+    // surfaceless need EGL_KHR_surfaceless_context, else go whit a 1x1 pbuffer
+    const char* extensions = eglQueryString( m_display, EGL_EXTENSIONS );
+    bool surfaceless = in_surfaceless && HasEGLExtension( extensions, "EGL_KHR_surfaceless_context" );
+
+    m_workers = new eglWorkerPool_t();
+    for ( GLuint i = 0; i < in_count; i++ )
+    {
+        std::unique_ptr<eglWorker_t> worker( new eglWorker_t() );
+        if ( !worker->context.CreateShared( this, surfaceless ) )
+        {
+            DebugOuput( "EGL error: failed to create a shared worker context\n" );
+            break;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock( m_workers->lock );
+            m_workers->starting++;
+        }
+
+        egl::Context* context = &worker->context;
+        eglWorkerPool_t* pool = m_workers;
+        worker->thread = std::thread( [context, pool, this]( void ) { context->WorkerLoop( pool, this ); } );
+        m_workers->workers.push_back( std::move( worker ) );
+    }
+
+    // the workers that can't make they context current left whitout taking jobs, drop them
+    std::vector<const egl::Context*> failed;
+    {
+        std::unique_lock<std::mutex> lock( m_workers->lock );
+        m_workers->started.wait( lock, [this]( void ) { return m_workers->starting == 0; } );
+        failed.swap( m_workers->failed );
+    }
+
+    auto& workers = m_workers->workers;
+    for ( auto worker = workers.begin(); worker != workers.end(); )
+    {
+        if ( std::find( failed.begin(), failed.end(), &( *worker )->context ) == failed.end() )
+        {
+            ++worker;
+            continue;
+        }
+
+        ( *worker )->thread.join();
+        ( *worker )->context.Destroy();
+        worker = workers.erase( worker );
+    }
+
+    if ( workers.size() < in_count )
+        DebugOuput( "EGL error: not all the requested workers could be started\n" );
+
+    if ( m_workers->workers.empty() )
+    {
+        delete m_workers;
+        m_workers = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+void egl::Context::DestroyWorkers( void )
+{
+    if ( m_workers == nullptr )
+        return;
+
+    // workers drain the queue before leaving
+    {
+        std::lock_guard<std::mutex> lock( m_workers->lock );
+        m_workers->quit = true;
+    }
+    m_workers->wake.notify_all();
+
+    for ( auto& worker : m_workers->workers )
+    {
+        if ( worker->thread.joinable() )
+            worker->thread.join();
+
+        worker->context.Destroy();
+    }
+
+    // hand over the last results
+    if ( gl::Context::Current() == this )
+        ProcessCompletedJobs();
+
+    delete m_workers;
+    m_workers = nullptr;
+}
+
+bool egl::Context::Submit( gl::ResourceJob* in_job )
+{
+    if ( m_workers == nullptr || in_job == nullptr )
+        return false;
+
+    m_workers->pending++;
+    {
+        std::lock_guard<std::mutex> lock( m_workers->lock );
+        m_workers->jobs.push_back( in_job );
+    }
+    m_workers->wake.notify_one();
+    return true;
+}
+
+GLuint egl::Context::ProcessCompletedJobs( void )
+{
+    std::vector<eglCompletedJob_t> completed;
+
+    if ( m_workers == nullptr )
+        return 0;
+
+    {
+        std::lock_guard<std::mutex> lock( m_workers->completedLock );
+        completed.swap( m_workers->completed );
+    }
+
+    for ( auto& done : completed )
+    {
+        // the GPU wait the worker commands, the CPU don't block
+        if ( done.fence != nullptr )
+        {
+            glWaitSync( done.fence, 0, GL_TIMEOUT_IGNORED );
+            glDeleteSync( done.fence );
+        }
+
+        m_workers->pending--;
+        done.job->Complete();
+    }
+
+    return static_cast<GLuint>( completed.size() );
+}
+
+GLuint egl::Context::PendingJobs( void ) const
+{
+    return ( m_workers != nullptr ) ? m_workers->pending.load() : 0;
+}
+
+GLuint egl::Context::NumWorkers( void ) const
+{
+    return ( m_workers != nullptr ) ? static_cast<GLuint>( m_workers->workers.size() ) : 0;
+}
+
+GLuint egl::Context::EnumerateDevices( device_t* in_devices, const GLuint in_count )
+{
+    const eglDeviceFunctions_t* functions = DeviceFunctions();
+    std::vector<EGLDeviceEXT> devices;
+    EGLint numDevices = 0;
+
+    if ( functions->QueryDevices == nullptr || functions->QueryDeviceString == nullptr )
+        return 0;
+
+    if ( functions->QueryDevices( 0, nullptr, &numDevices ) != EGL_TRUE || numDevices <= 0 )
+        return 0;
+
+    devices.resize( static_cast<size_t>( numDevices ) );
+    if ( functions->QueryDevices( numDevices, devices.data(), &numDevices ) != EGL_TRUE )
+        return 0;
+
+    if ( in_devices == nullptr )
+        return static_cast<GLuint>( numDevices );
+
+    for ( GLuint i = 0; i < std::min( in_count, static_cast<GLuint>( numDevices ) ); i++ )
+    {
+        device_t& device = in_devices[i];
+        device = device_t();
+        device.handle = devices[i];
+        device.extensions = functions->QueryDeviceString( device.handle, EGL_EXTENSIONS );
+        device.software = HasEGLExtension( device.extensions, "EGL_MESA_device_software" );
+
+        if ( HasEGLExtension( device.extensions, "EGL_EXT_device_query_name" ) )
+        {
+            device.name = functions->QueryDeviceString( device.handle, EGL_RENDERER_EXT );
+            device.vendor = functions->QueryDeviceString( device.handle, EGL_VENDOR );
+        }
+
+        if ( HasEGLExtension( device.extensions, "EGL_EXT_device_drm" ) )
+            device.drmDevice = functions->QueryDeviceString( device.handle, EGL_DRM_DEVICE_FILE_EXT );
+
+        if ( HasEGLExtension( device.extensions, "EGL_EXT_device_drm_render_node" ) )
+            device.renderNode = functions->QueryDeviceString( device.handle, EGL_DRM_RENDER_NODE_FILE_EXT );
+    }
+
+    // the query functions may raise a error on devices whitout the string
+    eglGetError();
+    return static_cast<GLuint>( numDevices );
+}
+
+bool egl::Context::QueryDevice( const EGLDeviceEXT in_device, deviceCaps_t* in_caps )
+{
+    EGLint configAttribs[] = 
+    {
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_NONE
+    };
+    EGLint numConfigs = 0;
+
+    if ( in_device == EGL_NO_DEVICE_EXT || in_caps == nullptr )
+        return false;
+
+    *in_caps = deviceCaps_t();
+
+    EGLDisplay display = eglGetPlatformDisplay( EGL_PLATFORM_DEVICE_EXT, in_device, nullptr );
+    if ( display == EGL_NO_DISPLAY )
+        return false;
+
+    if ( eglInitialize( display, &in_caps->major, &in_caps->minor ) != EGL_TRUE )
+        return false;
+
+    const char* extensions = eglQueryString( display, EGL_EXTENSIONS );
+    in_caps->vendor = eglQueryString( display, EGL_VENDOR );
+    in_caps->openGL = HasEGLExtension( eglQueryString( display, EGL_CLIENT_APIS ), "OpenGL" );
+    in_caps->createContext = HasEGLExtension( extensions, "EGL_KHR_create_context" );
+    in_caps->surfaceless = HasEGLExtension( extensions, "EGL_KHR_surfaceless_context" );
+    in_caps->noConfig = HasEGLExtension( extensions, "EGL_KHR_no_config_context" );
+    in_caps->pbuffer = eglChooseConfig( display, configAttribs, nullptr, 0, &numConfigs ) == EGL_TRUE && numConfigs > 0;
+    return true;
+}
+
+bool egl::Context::CreateShared( const Context* in_parent, const bool in_surfaceless )
+{
+    std::vector<EGLint> context_attribs;
+
+    m_display = in_parent->m_display;
+    m_config = in_parent->m_config;
+    m_createInfo = in_parent->m_createInfo;
+
+    if ( !in_surfaceless )
+    {
+        EGLint pbuffer_attribs[] = 
+        {
+            EGL_WIDTH, 1,
+            EGL_HEIGHT, 1,
+            EGL_NONE,
+        };
+
+        m_surface = eglCreatePbufferSurface( m_display, m_config, pbuffer_attribs );
+        if ( m_surface == EGL_NO_SURFACE )
+        {
+            DebugOuput( "EGL error: eglCreatePbufferSurface failed\n" );
+            return false;
+        }
+    }
+
+    BuildContextAttribs( &m_createInfo, context_attribs );
+
+    // created here, made current on the worker thread
+    m_context = eglCreateContext( m_display, m_config, in_parent->m_context, context_attribs.data() );
+    if ( m_context == EGL_NO_CONTEXT )
+    {
+        DebugOuput( "EGL error: eglCreateContext failed\n" );
+        return false;
+    }
+
+    return true;
+}
+
+void egl::Context::WorkerLoop( eglWorkerPool_t* in_pool, const Context* in_parent )
+{
+    const bool ready = MakeCurrent() && InitShared( in_parent );
+    if ( !ready )
+    {
+        DebugOuput( "EGL error: worker context initialization failed\n" );
+        Release();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock( in_pool->lock );
+        in_pool->starting--;
+        if ( !ready )
+            in_pool->failed.push_back( this );
+    }
+    in_pool->started.notify_all();
+
+    if ( !ready )
+        return;
+
+    for ( ;; )
+    {
+        gl::ResourceJob* job = nullptr;
+        {
+            std::unique_lock<std::mutex> lock( in_pool->lock );
+            in_pool->wake.wait( lock, [in_pool]( void ) { return in_pool->quit || !in_pool->jobs.empty(); } );
+            if ( in_pool->jobs.empty() )
+                break;
+
+            job = in_pool->jobs.front();
+            in_pool->jobs.pop_front();
+        }
+
+        job->Execute();
+
+        // the flush make the fence visible to the main context
+        eglCompletedJob_t done;
+        done.job = job;
+        done.fence = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+        glFlush();
+
+        std::lock_guard<std::mutex> lock( in_pool->completedLock );
+        in_pool->completed.push_back( done );
+    }
+
+    Finalize();
+    Release();
+}
@@ -0,0 +1,2115 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+
+#include "crglPrecompiled.hpp"
+#include "crglBlockEncoder.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined( __x86_64__ ) || defined( _M_X64 ) || defined( __i386__ ) || defined( _M_IX86 )
+#define CRGL_BLOCK_X86 1
+#include <immintrin.h>
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#define CRGL_BLOCK_NEON 1
+#include <arm_neon.h>
+#endif
+
+// the AVX2 kernel is built whit the target attribute and selected at runtime
+#if defined( __GNUC__ ) || defined( __clang__ )
+#define CRGL_BLOCK_TARGET( x )  __attribute__( ( target( x ) ) )
+#else
+#define CRGL_BLOCK_TARGET( x )
+#endif
+
+typedef std::chrono::steady_clock   blockClock_t;
+
+enum blockKind_t
+{
+    BLOCK_KIND_NONE = 0,
+    BLOCK_KIND_BC1,             // opaque DXT1
+    BLOCK_KIND_BC1_ALPHA,       // DXT1 whit punch-through alpha
+    BLOCK_KIND_BC2,
+    BLOCK_KIND_BC3,
+    BLOCK_KIND_BC4,
+    BLOCK_KIND_BC5,
+    BLOCK_KIND_BC7
+};
+
+/// @brief a block, or a partition subset, in planar float channels for the kernels
+/// the SIMD kernels read whole vectors, the lanes past count must hold a copy of a pixel ( see PadPixels )
+typedef struct blockPixels_t
+{
+    alignas( 32 ) float channels[4][16];
+    GLuint  count = 0;
+} blockPixels_t;
+
+/// @brief a decoded palette, up to the 16 entries of the BC7 4 bits indices
+typedef struct blockPalette_t
+{
+    float   colors[16][4];
+    GLuint  entries = 0;
+} blockPalette_t;
+
+/// @brief pick the nearest palette entry of each pixel
+/// @return the weighted squared error sum
+typedef float ( *fitKernel_t )( const blockPixels_t* in_pixels, const blockPalette_t* in_palette, const float* in_weights, uint8_t* in_indices );
+
+struct glCoreBlockEncoder_t;
+typedef void ( *blockJob_t )( glCoreBlockEncoder_t* in_encoder, const GLuint in_begin, const GLuint in_end );
+
+/// @brief the image in progress, shared whit the workers
+typedef struct blockPass_t
+{
+    blockKind_t     kind = BLOCK_KIND_NONE;
+    const uint8_t*  source = nullptr;
+    GLsizeiptr      stride = 0;
+    GLuint          width = 0;
+    GLuint          height = 0;
+    GLuint          blocksX = 0;
+    GLuint          blockBytes = 0;
+    uint8_t*        destine = nullptr;
+} blockPass_t;
+
+typedef struct glCoreBlockEncoder_t
+{
+    gl::BlockEncoder::createInfo_t      createInfo;
+    gl::mipSimd_t                       simd = gl::MIP_SIMD_NONE;
+    fitKernel_t                         fit = nullptr;
+    float                               weights[4] = { 1.0f, 1.0f, 1.0f, 1.0f };    // RGBA error weights
+    GLuint                              refines = 0;        // least squares passes
+    GLuint                              partitions = 0;     // BC7 2 subsets partitions tried
+
+    // parallel for
+    std::vector<std::thread>            threads;
+    std::mutex                          lock;
+    std::condition_variable             wake;
+    std::condition_variable             finished;
+    uint64_t                            generation = 0;
+    bool                                quit = false;
+    blockJob_t                          job = nullptr;
+    GLuint                              jobCount = 0;
+    GLuint                              jobChunk = 1;
+    std::atomic<GLuint>                 jobNext{ 0 };
+    GLuint                              busy = 0;
+
+    blockPass_t                         pass;
+    std::vector<uint8_t>                scratch;            // CompressedSubImage blocks
+    gl::blockEncoderStats_t             stats;
+} glCoreBlockEncoder_t;
+
+static blockKind_t BlockKind( const GLenum in_format )
+{
+    switch ( in_format )
+    {
+    case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+    case GL_COMPRESSED_SRGB_S3TC_DXT1_EXT:
+        return BLOCK_KIND_BC1;
+    case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+    case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT:
+        return BLOCK_KIND_BC1_ALPHA;
+    case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
+    case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT:
+        return BLOCK_KIND_BC2;
+    case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+    case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT:
+        return BLOCK_KIND_BC3;
+    case GL_COMPRESSED_RED_RGTC1:
+        return BLOCK_KIND_BC4;
+    case GL_COMPRESSED_RG_RGTC2:
+        return BLOCK_KIND_BC5;
+    case GL_COMPRESSED_RGBA_BPTC_UNORM:
+    case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+        return BLOCK_KIND_BC7;
+    default:
+        return BLOCK_KIND_NONE;
+    }
+}
+
+static GLuint BlockBytes( const blockKind_t in_kind )
+{
+    return ( in_kind == BLOCK_KIND_BC1 || in_kind == BLOCK_KIND_BC1_ALPHA || in_kind == BLOCK_KIND_BC4 ) ? 8 : 16;
+}
+
+static float Clamp255( const float in_value )
+{
+    return std::min( std::max( in_value, 0.0f ), 255.0f );
+}
+
+// ============================================================================================
+// fit kernels
+// ============================================================================================
+
+static float FitScalar( const blockPixels_t* in_pixels, const blockPalette_t* in_palette, const float* in_weights, uint8_t* in_indices )
+{
+    float error = 0.0f;
+    for ( GLuint i = 0; i < in_pixels->count; i++ )
+    {
+        float best = std::numeric_limits<float>::max();
+        GLuint index = 0;
+        for ( GLuint e = 0; e < in_palette->entries; e++ )
+        {
+            float distance = 0.0f;
+            for ( GLuint c = 0; c < 4; c++ )
+            {
+                const float delta = in_pixels->channels[c][i] - in_palette->colors[e][c];
+                distance += delta * delta * in_weights[c];
+            }
+
+            if ( distance < best )
+            {
+                best = distance;
+                index = e;
+            }
+        }
+
+        in_indices[i] = static_cast<uint8_t>( index );
+        error += best;
+    }
+
+    return error;
+}
+
+#if CRGL_BLOCK_X86
+CRGL_BLOCK_TARGET( "sse2" )
+static float FitSse2( const blockPixels_t* in_pixels, const blockPalette_t* in_palette, const float* in_weights, uint8_t* in_indices )
+{
+    const GLuint count = ( in_pixels->count + 3 ) & ~3u;
+    const __m128 lanes = _mm_set_ps( 3.0f, 2.0f, 1.0f, 0.0f );
+    const __m128 valid = _mm_set1_ps( static_cast<float>( in_pixels->count ) );
+    const __m128 wr = _mm_set1_ps( in_weights[0] );
+    const __m128 wg = _mm_set1_ps( in_weights[1] );
+    const __m128 wb = _mm_set1_ps( in_weights[2] );
+    const __m128 wa = _mm_set1_ps( in_weights[3] );
+    __m128 total = _mm_setzero_ps();
+    for ( GLuint i = 0; i < count; i += 4 )
+    {
+        const __m128 r = _mm_load_ps( &in_pixels->channels[0][i] );
+        const __m128 g = _mm_load_ps( &in_pixels->channels[1][i] );
+        const __m128 b = _mm_load_ps( &in_pixels->channels[2][i] );
+        const __m128 a = _mm_load_ps( &in_pixels->channels[3][i] );
+        __m128 best = _mm_set1_ps( std::numeric_limits<float>::max() );
+        __m128 index = _mm_setzero_ps();
+        for ( GLuint e = 0; e < in_palette->entries; e++ )
+        {
+            const float* color = in_palette->colors[e];
+            __m128 delta = _mm_sub_ps( r, _mm_set1_ps( color[0] ) );
+            __m128 distance = _mm_mul_ps( _mm_mul_ps( delta, delta ), wr );
+            delta = _mm_sub_ps( g, _mm_set1_ps( color[1] ) );
+            distance = _mm_add_ps( distance, _mm_mul_ps( _mm_mul_ps( delta, delta ), wg ) );
+            delta = _mm_sub_ps( b, _mm_set1_ps( color[2] ) );
+            distance = _mm_add_ps( distance, _mm_mul_ps( _mm_mul_ps( delta, delta ), wb ) );
+            delta = _mm_sub_ps( a, _mm_set1_ps( color[3] ) );
+            distance = _mm_add_ps( distance, _mm_mul_ps( _mm_mul_ps( delta, delta ), wa ) );
+
+            const __m128 closer = _mm_cmplt_ps( distance, best );
+            best = _mm_min_ps( distance, best );
+            index = _mm_or_ps( _mm_and_ps( closer, _mm_set1_ps( static_cast<float>( e ) ) ), _mm_andnot_ps( closer, index ) );
+        }
+
+        alignas( 16 ) int32_t selected[4];
+        _mm_store_si128( reinterpret_cast<__m128i*>( selected ), _mm_cvttps_epi32( index ) );
+        for ( GLuint k = 0; k < 4; k++ )
+            in_indices[i + k] = static_cast<uint8_t>( selected[k] );
+
+        // the padding lanes do not count
+        const __m128 inside = _mm_cmplt_ps( _mm_add_ps( lanes, _mm_set1_ps( static_cast<float>( i ) ) ), valid );
+        total = _mm_add_ps( total, _mm_and_ps( best, inside ) );
+    }
+
+    alignas( 16 ) float sums[4];
+    _mm_store_ps( sums, total );
+    return ( sums[0] + sums[1] ) + ( sums[2] + sums[3] );
+}
+
+CRGL_BLOCK_TARGET( "avx2,fma" )
+static float FitAvx2( const blockPixels_t* in_pixels, const blockPalette_t* in_palette, const float* in_weights, uint8_t* in_indices )
+{
+    const GLuint count = ( in_pixels->count + 7 ) & ~7u;
+    const __m256 lanes = _mm256_set_ps( 7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f );
+    const __m256 valid = _mm256_set1_ps( static_cast<float>( in_pixels->count ) );
+    const __m256 wr = _mm256_set1_ps( in_weights[0] );
+    const __m256 wg = _mm256_set1_ps( in_weights[1] );
+    const __m256 wb = _mm256_set1_ps( in_weights[2] );
+    const __m256 wa = _mm256_set1_ps( in_weights[3] );
+    __m256 total = _mm256_setzero_ps();
+    for ( GLuint i = 0; i < count; i += 8 )
+    {
+        const __m256 r = _mm256_load_ps( &in_pixels->channels[0][i] );
+        const __m256 g = _mm256_load_ps( &in_pixels->channels[1][i] );
+        const __m256 b = _mm256_load_ps( &in_pixels->channels[2][i] );
+        const __m256 a = _mm256_load_ps( &in_pixels->channels[3][i] );
+        __m256 best = _mm256_set1_ps( std::numeric_limits<float>::max() );
+        __m256 index = _mm256_setzero_ps();
+        for ( GLuint e = 0; e < in_palette->entries; e++ )
+        {
+            const float* color = in_palette->colors[e];
+            __m256 delta = _mm256_sub_ps( r, _mm256_set1_ps( color[0] ) );
+            __m256 distance = _mm256_mul_ps( _mm256_mul_ps( delta, delta ), wr );
+            delta = _mm256_sub_ps( g, _mm256_set1_ps( color[1] ) );
+            distance = _mm256_fmadd_ps( _mm256_mul_ps( delta, delta ), wg, distance );
+            delta = _mm256_sub_ps( b, _mm256_set1_ps( color[2] ) );
+            distance = _mm256_fmadd_ps( _mm256_mul_ps( delta, delta ), wb, distance );
+            delta = _mm256_sub_ps( a, _mm256_set1_ps( color[3] ) );
+            distance = _mm256_fmadd_ps( _mm256_mul_ps( delta, delta ), wa, distance );
+
+            const __m256 closer = _mm256_cmp_ps( distance, best, _CMP_LT_OQ );
+            best = _mm256_min_ps( distance, best );
+            index = _mm256_blendv_ps( index, _mm256_set1_ps( static_cast<float>( e ) ), closer );
+        }
+
+        alignas( 32 ) int32_t selected[8];
+        _mm256_store_si256( reinterpret_cast<__m256i*>( selected ), _mm256_cvttps_epi32( index ) );
+        for ( GLuint k = 0; k < 8; k++ )
+            in_indices[i + k] = static_cast<uint8_t>( selected[k] );
+
+        const __m256 inside = _mm256_cmp_ps( _mm256_add_ps( lanes, _mm256_set1_ps( static_cast<float>( i ) ) ), valid, _CMP_LT_OQ );
+        total = _mm256_add_ps( total, _mm256_and_ps( best, inside ) );
+    }
+
+    alignas( 32 ) float sums[8];
+    _mm256_store_ps( sums, total );
+    return ( ( sums[0] + sums[1] ) + ( sums[2] + sums[3] ) ) + ( ( sums[4] + sums[5] ) + ( sums[6] + sums[7] ) );
+}
+#endif
+
+#if CRGL_BLOCK_NEON
+static float FitNeon( const blockPixels_t* in_pixels, const blockPalette_t* in_palette, const float* in_weights, uint8_t* in_indices )
+{
+    const GLuint count = ( in_pixels->count + 3 ) & ~3u;
+    const float lanesInit[4] = { 0.0f, 1.0f, 2.0f, 3.0f };
+    const float32x4_t lanes = vld1q_f32( lanesInit );
+    const float32x4_t valid = vdupq_n_f32( static_cast<float>( in_pixels->count ) );
+    const float32x4_t wr = vdupq_n_f32( in_weights[0] );
+    const float32x4_t wg = vdupq_n_f32( in_weights[1] );
+    const float32x4_t wb = vdupq_n_f32( in_weights[2] );
+    const float32x4_t wa = vdupq_n_f32( in_weights[3] );
+    float32x4_t total = vdupq_n_f32( 0.0f );
+    for ( GLuint i = 0; i < count; i += 4 )
+    {
+        const float32x4_t r = vld1q_f32( &in_pixels->channels[0][i] );
+        const float32x4_t g = vld1q_f32( &in_pixels->channels[1][i] );
+        const float32x4_t b = vld1q_f32( &in_pixels->channels[2][i] );
+        const float32x4_t a = vld1q_f32( &in_pixels->channels[3][i] );
+        float32x4_t best = vdupq_n_f32( std::numeric_limits<float>::max() );
+        float32x4_t index = vdupq_n_f32( 0.0f );
+        for ( GLuint e = 0; e < in_palette->entries; e++ )
+        {
+            const float* color = in_palette->colors[e];
+            float32x4_t delta = vsubq_f32( r, vdupq_n_f32( color[0] ) );
+            float32x4_t distance = vmulq_f32( vmulq_f32( delta, delta ), wr );
+            delta = vsubq_f32( g, vdupq_n_f32( color[1] ) );
+            distance = vmlaq_f32( distance, vmulq_f32( delta, delta ), wg );
+            delta = vsubq_f32( b, vdupq_n_f32( color[2] ) );
+            distance = vmlaq_f32( distance, vmulq_f32( delta, delta ), wb );
+            delta = vsubq_f32( a, vdupq_n_f32( color[3] ) );
+            distance = vmlaq_f32( distance, vmulq_f32( delta, delta ), wa );
+
+            const uint32x4_t closer = vcltq_f32( distance, best );
+            best = vminq_f32( distance, best );
+            index = vbslq_f32( closer, vdupq_n_f32( static_cast<float>( e ) ), index );
+        }
+
+        int32_t selected[4];
+        vst1q_s32( selected, vcvtq_s32_f32( index ) );
+        for ( GLuint k = 0; k < 4; k++ )
+            in_indices[i + k] = static_cast<uint8_t>( selected[k] );
+
+        const uint32x4_t inside = vcltq_f32( vaddq_f32( lanes, vdupq_n_f32( static_cast<float>( i ) ) ), valid );
+        total = vaddq_f32( total, vreinterpretq_f32_u32( vandq_u32( vreinterpretq_u32_f32( best ), inside ) ) );
+    }
+
+    float sums[4];
+    vst1q_f32( sums, total );
+    return ( sums[0] + sums[1] ) + ( sums[2] + sums[3] );
+}
+#endif
+
+static bool SimdSupported( const gl::mipSimd_t in_simd )
+{
+    switch ( in_simd )
+    {
+    case gl::MIP_SIMD_NONE:
+        return true;
+#if CRGL_BLOCK_X86
+#if defined( __GNUC__ ) || defined( __clang__ )
+    case gl::MIP_SIMD_SSE2:
+        return __builtin_cpu_supports( "sse2" );
+    case gl::MIP_SIMD_AVX2:
+        return __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" );
+#else
+    case gl::MIP_SIMD_SSE2:
+        return true;
+#endif
+#endif
+#if CRGL_BLOCK_NEON
+    case gl::MIP_SIMD_NEON:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+static void SelectKernel( glCoreBlockEncoder_t* in_encoder, const gl::mipSimd_t in_simd )
+{
+    in_encoder->simd = in_simd;
+    in_encoder->fit = FitScalar;
+    switch ( in_simd )
+    {
+#if CRGL_BLOCK_X86
+    case gl::MIP_SIMD_SSE2:
+        in_encoder->fit = FitSse2;
+        break;
+    case gl::MIP_SIMD_AVX2:
+        in_encoder->fit = FitAvx2;
+        break;
+#endif
+#if CRGL_BLOCK_NEON
+    case gl::MIP_SIMD_NEON:
+        in_encoder->fit = FitNeon;
+        break;
+#endif
+    default:
+        in_encoder->simd = gl::MIP_SIMD_NONE;
+        break;
+    }
+}
+
+// ============================================================================================
+// parallel for
+// ============================================================================================
+
+static void RunChunks( glCoreBlockEncoder_t* in_encoder )
+{
+    for ( ;; )
+    {
+        const GLuint begin = in_encoder->jobNext.fetch_add( in_encoder->jobChunk );
+        if ( begin >= in_encoder->jobCount )
+            break;
+
+        in_encoder->job( in_encoder, begin, std::min( begin + in_encoder->jobChunk, in_encoder->jobCount ) );
+    }
+}
+
+static void WorkerLoop( glCoreBlockEncoder_t* in_encoder )
+{
+    uint64_t generation = 0;
+    for ( ;; )
+    {
+        {
+            std::unique_lock<std::mutex> lock( in_encoder->lock );
+            in_encoder->wake.wait( lock, [&]( void ) { return in_encoder->quit || in_encoder->generation != generation; } );
+            if ( in_encoder->quit )
+                return;
+
+            generation = in_encoder->generation;
+        }
+
+        RunChunks( in_encoder );
+
+        std::lock_guard<std::mutex> lock( in_encoder->lock );
+        if ( --in_encoder->busy == 0 )
+            in_encoder->finished.notify_all();
+    }
+}
+
+/// @brief run in_job over [0, in_count) block rows on the workers and the calling thread
+static void ParallelFor( glCoreBlockEncoder_t* in_encoder, blockJob_t in_job, const GLuint in_count )
+{
+    const GLuint threads = static_cast<GLuint>( in_encoder->threads.size() );
+    if ( threads == 0 || in_count < 2 )
+    {
+        in_job( in_encoder, 0, in_count );
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock( in_encoder->lock );
+        in_encoder->job = in_job;
+        in_encoder->jobCount = in_count;
+        in_encoder->jobChunk = std::max<GLuint>( in_count / ( ( threads + 1 ) * 4 ), 1 );
+        in_encoder->jobNext = 0;
+        in_encoder->busy = threads;
+        in_encoder->generation++;
+    }
+    in_encoder->wake.notify_all();
+
+    RunChunks( in_encoder );
+
+    std::unique_lock<std::mutex> lock( in_encoder->lock );
+    in_encoder->finished.wait( lock, [in_encoder]( void ) { return in_encoder->busy == 0; } );
+}
+
+// ============================================================================================
+// endpoints fitting
+// ============================================================================================
+
+/// @brief mean and principal axis of the first in_channels channels
+static void PrincipalAxis( const blockPixels_t* in_pixels, const GLuint in_channels, float* in_mean, float* in_axis )
+{
+    const GLuint count = in_pixels->count;
+    const float scale = 1.0f / static_cast<float>( std::max<GLuint>( count, 1 ) );
+    for ( GLuint c = 0; c < 4; c++ )
+    {
+        float sum = 0.0f;
+        for ( GLuint i = 0; i < count; i++ )
+            sum += in_pixels->channels[c][i];
+
+        in_mean[c] = sum * scale;
+        in_axis[c] = 0.0f;
+    }
+
+    float covariance[4][4] = {};
+    for ( GLuint i = 0; i < count; i++ )
+    {
+        float delta[4];
+        for ( GLuint c = 0; c < in_channels; c++ )
+            delta[c] = in_pixels->channels[c][i] - in_mean[c];
+
+        for ( GLuint a = 0; a < in_channels; a++ )
+            for ( GLuint b = a; b < in_channels; b++ )
+                covariance[a][b] += delta[a] * delta[b];
+    }
+
+    for ( GLuint a = 0; a < in_channels; a++ )
+        for ( GLuint b = 0; b < a; b++ )
+            covariance[a][b] = covariance[b][a];
+
+    // power iteration, from the most spread channel
+    GLuint largest = 0;
+    for ( GLuint c = 1; c < in_channels; c++ )
+    {
+        if ( covariance[c][c] > covariance[largest][largest] )
+            largest = c;
+    }
+
+    float axis[4] = {};
+    for ( GLuint c = 0; c < in_channels; c++ )
+        axis[c] = covariance[largest][c];
+
+    for ( GLuint iteration = 0; iteration < 8; iteration++ )
+    {
+        float next[4] = {};
+        float peak = 0.0f;
+        for ( GLuint a = 0; a < in_channels; a++ )
+        {
+            for ( GLuint b = 0; b < in_channels; b++ )
+                next[a] += covariance[a][b] * axis[b];
+
+            peak = std::max( peak, std::fabs( next[a] ) );
+        }
+
+        if ( peak < 1e-6f )
+            break;
+
+        for ( GLuint c = 0; c < in_channels; c++ )
+            axis[c] = next[c] / peak;
+    }
+
+    float length = 0.0f;
+    for ( GLuint c = 0; c < in_channels; c++ )
+        length += axis[c] * axis[c];
+
+    // flat block, any axis do
+    if ( length < 1e-12f )
+    {
+        for ( GLuint c = 0; c < in_channels; c++ )
+            in_axis[c] = 1.0f / std::sqrt( static_cast<float>( in_channels ) );
+        return;
+    }
+
+    length = 1.0f / std::sqrt( length );
+    for ( GLuint c = 0; c < in_channels; c++ )
+        in_axis[c] = axis[c] * length;
+}
+
+/// @brief extent of the pixels along the axis, the channels past in_channels take the mean
+static void AxisEndpoints( const blockPixels_t* in_pixels, const GLuint in_channels, float* in_endpoint0, float* in_endpoint1 )
+{
+    float mean[4];
+    float axis[4];
+    PrincipalAxis( in_pixels, in_channels, mean, axis );
+
+    float minimum = std::numeric_limits<float>::max();
+    float maximum = -std::numeric_limits<float>::max();
+    for ( GLuint i = 0; i < in_pixels->count; i++ )
+    {
+        float projection = 0.0f;
+        for ( GLuint c = 0; c < in_channels; c++ )
+            projection += ( in_pixels->channels[c][i] - mean[c] ) * axis[c];
+
+        minimum = std::min( minimum, projection );
+        maximum = std::max( maximum, projection );
+    }
+
+    if ( in_pixels->count == 0 )
+        minimum = maximum = 0.0f;
+
+    for ( GLuint c = 0; c < 4; c++ )
+    {
+        in_endpoint0[c] = Clamp255( mean[c] + axis[c] * minimum );
+        in_endpoint1[c] = Clamp255( mean[c] + axis[c] * maximum );
+    }
+}
+
+/// @brief least squares endpoints for the chosen indices
+/// @param in_fractions position of each index between the endpoints, 0 for the first
+/// @return false if the indices do not constrain both endpoints
+static bool RefineEndpoints( const blockPixels_t* in_pixels, const GLuint in_channels, const uint8_t* in_indices, const float* in_fractions, float* in_endpoint0, float* in_endpoint1 )
+{
+    float alpha2 = 0.0f;
+    float beta2 = 0.0f;
+    float alphaBeta = 0.0f;
+    float alphaX[4] = {};
+    float betaX[4] = {};
+    for ( GLuint i = 0; i < in_pixels->count; i++ )
+    {
+        const float beta = in_fractions[in_indices[i]];
+        const float alpha = 1.0f - beta;
+        alpha2 += alpha * alpha;
+        beta2 += beta * beta;
+        alphaBeta += alpha * beta;
+        for ( GLuint c = 0; c < in_channels; c++ )
+        {
+            alphaX[c] += alpha * in_pixels->channels[c][i];
+            betaX[c] += beta * in_pixels->channels[c][i];
+        }
+    }
+
+    const float determinant = alpha2 * beta2 - alphaBeta * alphaBeta;
+    if ( std::fabs( determinant ) < 1e-4f )
+        return false;
+
+    const float inverse = 1.0f / determinant;
+    for ( GLuint c = 0; c < in_channels; c++ )
+    {
+        in_endpoint0[c] = Clamp255( ( alphaX[c] * beta2 - betaX[c] * alphaBeta ) * inverse );
+        in_endpoint1[c] = Clamp255( ( betaX[c] * alpha2 - alphaX[c] * alphaBeta ) * inverse );
+    }
+
+    return true;
+}
+
+/// @brief repeat the last pixel up to the kernels vector size
+static void PadPixels( blockPixels_t* in_pixels )
+{
+    const GLuint last = in_pixels->count - 1;
+    const GLuint end = std::min<GLuint>( ( in_pixels->count + 7 ) & ~7u, 16 );
+    for ( GLuint i = in_pixels->count; i < end; i++ )
+        for ( GLuint c = 0; c < 4; c++ )
+            in_pixels->channels[c][i] = in_pixels->channels[c][last];
+}
+
+static void LoadPixels( const uint8_t in_block[16][4], blockPixels_t* in_pixels )
+{
+    for ( GLuint i = 0; i < 16; i++ )
+        for ( GLuint c = 0; c < 4; c++ )
+            in_pixels->channels[c][i] = in_block[i][c];
+
+    in_pixels->count = 16;
+}
+
+// ============================================================================================
+// BC1 / BC2 / BC3 color
+// ============================================================================================
+
+static const float k_BC1_FRACTIONS4[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+static const float k_BC1_FRACTIONS3[3] = { 0.0f, 1.0f, 0.5f };
+
+typedef struct bc1Block_t
+{
+    uint16_t    color0 = 0;
+    uint16_t    color1 = 0;
+    uint8_t     indices[16] = {};
+    float       error = 0.0f;
+} bc1Block_t;
+
+/// @brief best 565 endpoints pair to reproduce a 8 bits value whit the 2/3 : 1/3 interpolation
+typedef struct bc1SingleTables_t
+{
+    uint8_t     match5[256][2];
+    uint8_t     match6[256][2];
+} bc1SingleTables_t;
+
+static GLuint Expand5( const GLuint in_value )
+{
+    return ( in_value << 3 ) | ( in_value >> 2 );
+}
+
+static GLuint Expand6( const GLuint in_value )
+{
+    return ( in_value << 2 ) | ( in_value >> 4 );
+}
+
+static void BuildSingleTable( uint8_t in_table[256][2], const GLuint in_bits )
+{
+    const GLuint levels = 1u << in_bits;
+    for ( GLuint value = 0; value < 256; value++ )
+    {
+        GLuint best = std::numeric_limits<GLuint>::max();
+        for ( GLuint a = 0; a < levels; a++ )
+        {
+            const GLuint expandedA = ( in_bits == 5 ) ? Expand5( a ) : Expand6( a );
+            for ( GLuint b = 0; b < levels; b++ )
+            {
+                const GLuint expandedB = ( in_bits == 5 ) ? Expand5( b ) : Expand6( b );
+                const GLuint interpolated = ( 2 * expandedA + expandedB ) / 3;
+                const GLuint delta = ( interpolated > value ) ? interpolated - value : value - interpolated;
+
+                // on a tie prefer close endpoints, the decoders round the interpolation differently
+                const GLuint spread = ( expandedA > expandedB ) ? expandedA - expandedB : expandedB - expandedA;
+                const GLuint error = delta * 256 + spread;
+                if ( error < best )
+                {
+                    best = error;
+                    in_table[value][0] = static_cast<uint8_t>( a );
+                    in_table[value][1] = static_cast<uint8_t>( b );
+                }
+            }
+        }
+    }
+}
+
+static const bc1SingleTables_t& SingleTables( void )
+{
+    static const bc1SingleTables_t tables = []( void )
+    {
+        bc1SingleTables_t result;
+        BuildSingleTable( result.match5, 5 );
+        BuildSingleTable( result.match6, 6 );
+        return result;
+    }( );
+
+    return tables;
+}
+
+static uint16_t Quantize565( const float* in_color )
+{
+    const GLuint r = static_cast<GLuint>( Clamp255( in_color[0] ) * ( 31.0f / 255.0f ) + 0.5f );
+    const GLuint g = static_cast<GLuint>( Clamp255( in_color[1] ) * ( 63.0f / 255.0f ) + 0.5f );
+    const GLuint b = static_cast<GLuint>( Clamp255( in_color[2] ) * ( 31.0f / 255.0f ) + 0.5f );
+    return static_cast<uint16_t>( ( r << 11 ) | ( g << 5 ) | b );
+}
+
+static void Expand565( const uint16_t in_color, GLuint* in_rgb )
+{
+    in_rgb[0] = Expand5( ( in_color >> 11 ) & 31 );
+    in_rgb[1] = Expand6( ( in_color >> 5 ) & 63 );
+    in_rgb[2] = Expand5( in_color & 31 );
+}
+
+/// @brief the colors of a BC1 block, the 3 colors mode leave the transparent black out
+static void Bc1Palette( const uint16_t in_color0, const uint16_t in_color1, blockPalette_t* in_palette )
+{
+    GLuint color0[3];
+    GLuint color1[3];
+    Expand565( in_color0, color0 );
+    Expand565( in_color1, color1 );
+
+    const bool four = in_color0 > in_color1;
+    for ( GLuint c = 0; c < 3; c++ )
+    {
+        in_palette->colors[0][c] = static_cast<float>( color0[c] );
+        in_palette->colors[1][c] = static_cast<float>( color1[c] );
+        if ( four )
+        {
+            in_palette->colors[2][c] = static_cast<float>( ( 2 * color0[c] + color1[c] ) / 3 );
+            in_palette->colors[3][c] = static_cast<float>( ( color0[c] + 2 * color1[c] ) / 3 );
+        }
+        else
+            in_palette->colors[2][c] = static_cast<float>( ( color0[c] + color1[c] ) / 2 );
+    }
+
+    for ( GLuint e = 0; e < 4; e++ )
+        in_palette->colors[e][3] = 255.0f;
+
+    in_palette->entries = four ? 4 : 3;
+}
+
+static void FitBc1Four( const glCoreBlockEncoder_t* in_encoder, const blockPixels_t* in_pixels, const float* in_weights, const float* in_endpoint0, const float* in_endpoint1, bc1Block_t* in_block )
+{
+    uint16_t color0 = Quantize565( in_endpoint0 );
+    uint16_t color1 = Quantize565( in_endpoint1 );
+    if ( color0 < color1 )
+        std::swap( color0, color1 );
+
+    // equal endpoints select the 3 colors mode, step one away
+    if ( color0 == color1 )
+    {
+        if ( color1 > 0 )
+            color1--;
+        else
+            color0++;
+    }
+
+    blockPalette_t palette;
+    Bc1Palette( color0, color1, &palette );
+    in_block->color0 = color0;
+    in_block->color1 = color1;
+    in_block->error = in_encoder->fit( in_pixels, &palette, in_weights, in_block->indices );
+}
+
+static void FitBc1Three( const glCoreBlockEncoder_t* in_encoder, const blockPixels_t* in_pixels, const float* in_weights, const float* in_endpoint0, const float* in_endpoint1, bc1Block_t* in_block )
+{
+    uint16_t color0 = Quantize565( in_endpoint0 );
+    uint16_t color1 = Quantize565( in_endpoint1 );
+    if ( color0 > color1 )
+        std::swap( color0, color1 );
+
+    blockPalette_t palette;
+    Bc1Palette( color0, color1, &palette );
+    in_block->color0 = color0;
+    in_block->color1 = color1;
+    in_block->error = in_encoder->fit( in_pixels, &palette, in_weights, in_block->indices );
+}
+
+static bool IsSolid( const uint8_t in_block[16][4], const GLuint in_channels )
+{
+    for ( GLuint i = 1; i < 16; i++ )
+    {
+        for ( GLuint c = 0; c < in_channels; c++ )
+        {
+            if ( in_block[i][c] != in_block[0][c] )
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/// @brief a single color hit exactly the interpolated entry more often than the endpoints
+static void SolidBc1( const uint8_t in_block[16][4], bc1Block_t* in_result )
+{
+    const bc1SingleTables_t& tables = SingleTables();
+    const uint8_t* r = tables.match5[in_block[0][0]];
+    const uint8_t* g = tables.match6[in_block[0][1]];
+    const uint8_t* b = tables.match5[in_block[0][2]];
+    uint16_t color0 = static_cast<uint16_t>( ( r[0] << 11 ) | ( g[0] << 5 ) | b[0] );
+    uint16_t color1 = static_cast<uint16_t>( ( r[1] << 11 ) | ( g[1] << 5 ) | b[1] );
+
+    uint8_t index = 2;
+    if ( color0 < color1 )
+    {
+        std::swap( color0, color1 );
+        index = 3;
+    }
+    else if ( color0 == color1 )
+        index = 0;
+
+    in_result->color0 = color0;
+    in_result->color1 = color1;
+    in_result->error = 0.0f;
+    for ( GLuint i = 0; i < 16; i++ )
+        in_result->indices[i] = index;
+}
+
+/// @brief 4 colors block, the only mode of the BC2 and BC3 color
+static void EncodeBc1Four( const glCoreBlockEncoder_t* in_encoder, const uint8_t in_block[16][4], bc1Block_t* in_result )
+{
+    if ( IsSolid( in_block, 3 ) )
+    {
+        SolidBc1( in_block, in_result );
+        return;
+    }
+
+    const float weights[4] = { in_encoder->weights[0], in_encoder->weights[1], in_encoder->weights[2], 0.0f };
+    blockPixels_t pixels;
+    LoadPixels( in_block, &pixels );
+
+    float endpoint0[4];
+    float endpoint1[4];
+    AxisEndpoints( &pixels, 3, endpoint0, endpoint1 );
+    FitBc1Four( in_encoder, &pixels, weights, endpoint0, endpoint1, in_result );
+
+    for ( GLuint pass = 0; pass < in_encoder->refines; pass++ )
+    {
+        if ( !RefineEndpoints( &pixels, 3, in_result->indices, k_BC1_FRACTIONS4, endpoint0, endpoint1 ) )
+            break;
+
+        bc1Block_t candidate;
+        FitBc1Four( in_encoder, &pixels, weights, endpoint0, endpoint1, &candidate );
+        if ( candidate.error >= in_result->error )
+            break;
+
+        *in_result = candidate;
+    }
+}
+
+/// @brief 3 colors block, the in_transparent pixels mask use the transparent black
+static void EncodeBc1Three( const glCoreBlockEncoder_t* in_encoder, const uint8_t in_block[16][4], const uint32_t in_transparent, bc1Block_t* in_result )
+{
+    const float weights[4] = { in_encoder->weights[0], in_encoder->weights[1], in_encoder->weights[2], 0.0f };
+    blockPixels_t pixels;
+    GLuint map[16];
+    pixels.count = 0;
+    for ( GLuint i = 0; i < 16; i++ )
+    {
+        if ( ( in_transparent >> i ) & 1 )
+            continue;
+
+        for ( GLuint c = 0; c < 4; c++ )
+            pixels.channels[c][pixels.count] = in_block[i][c];
+
+        map[pixels.count++] = i;
+    }
+
+    bc1Block_t best;
+    if ( pixels.count > 0 )
+    {
+        PadPixels( &pixels );
+        float endpoint0[4];
+        float endpoint1[4];
+        AxisEndpoints( &pixels, 3, endpoint0, endpoint1 );
+        FitBc1Three( in_encoder, &pixels, weights, endpoint0, endpoint1, &best );
+
+        for ( GLuint pass = 0; pass < in_encoder->refines; pass++ )
+        {
+            if ( !RefineEndpoints( &pixels, 3, best.indices, k_BC1_FRACTIONS3, endpoint0, endpoint1 ) )
+                break;
+
+            bc1Block_t candidate;
+            FitBc1Three( in_encoder, &pixels, weights, endpoint0, endpoint1, &candidate );
+            if ( candidate.error >= best.error )
+                break;
+
+            best = candidate;
+        }
+    }
+
+    in_result->color0 = best.color0;
+    in_result->color1 = best.color1;
+    in_result->error = best.error;
+    for ( GLuint i = 0; i < 16; i++ )
+        in_result->indices[i] = 3;
+
+    for ( GLuint i = 0; i < pixels.count; i++ )
+        in_result->indices[map[i]] = best.indices[i];
+}
+
+static void WriteBc1( const bc1Block_t* in_block, uint8_t* in_destine )
+{
+    uint32_t bits = 0;
+    for ( GLuint i = 0; i < 16; i++ )
+        bits |= static_cast<uint32_t>( in_block->indices[i] ) << ( i * 2 );
+
+    in_destine[0] = static_cast<uint8_t>( in_block->color0 );
+    in_destine[1] = static_cast<uint8_t>( in_block->color0 >> 8 );
+    in_destine[2] = static_cast<uint8_t>( in_block->color1 );
+    in_destine[3] = static_cast<uint8_t>( in_block->color1 >> 8 );
+    for ( GLuint i = 0; i < 4; i++ )
+        in_destine[4 + i] = static_cast<uint8_t>( bits >> ( i * 8 ) );
+}
+
+static void EncodeBc1( const glCoreBlockEncoder_t* in_encoder, const uint8_t in_block[16][4], const bool in_alpha, uint8_t* in_destine )
+{
+    uint32_t transparent = 0;
+    if ( in_alpha )
+    {
+        for ( GLuint i = 0; i < 16; i++ )
+        {
+            if ( in_block[i][3] < 128 )
+                transparent |= 1u << i;
+        }
+    }
+
+    bc1Block_t result;
+    if ( transparent != 0 )
+        EncodeBc1Three( in_encoder, in_block, transparent, &result );
+    else
+    {
+        EncodeBc1Four( in_encoder, in_block, &result );
+
+        // the half way entry can beat the thirds
+        if ( in_encoder->createInfo.quality == gl::BLOCK_QUALITY_HIGH && result.error > 0.0f )
+        {
+            bc1Block_t three;
+            EncodeBc1Three( in_encoder, in_block, 0, &three );
+            if ( three.error < result.error )
+                result = three;
+        }
+    }
+
+    WriteBc1( &result, in_destine );
+}
+
+// ============================================================================================
+// BC4 / BC5, BC2 and BC3 alpha
+// ============================================================================================
+
+static const float k_BC4_FRACTIONS8[8] = { 0.0f, 1.0f, 1.0f / 7.0f, 2.0f / 7.0f, 3.0f / 7.0f, 4.0f / 7.0f, 5.0f / 7.0f, 6.0f / 7.0f };
+
+typedef struct bc4Block_t
+{
+    GLuint      value0 = 0;
+    GLuint      value1 = 0;
+    uint8_t     indices[16] = {};
+    float       error = 0.0f;
+} bc4Block_t;
+
+/// @brief the values of a BC4 block, in the first channel, the interpolation is rounded to nearest
+static void Bc4Palette( const GLuint in_value0, const GLuint in_value1, blockPalette_t* in_palette )
+{
+    for ( GLuint e = 0; e < 8; e++ )
+    {
+        for ( GLuint c = 1; c < 4; c++ )
+            in_palette->colors[e][c] = 0.0f;
+    }
+
+    in_palette->colors[0][0] = static_cast<float>( in_value0 );
+    in_palette->colors[1][0] = static_cast<float>( in_value1 );
+    if ( in_value0 > in_value1 )
+    {
+        for ( GLuint code = 2; code < 8; code++ )
+            in_palette->colors[code][0] = static_cast<float>( ( ( 8 - code ) * in_value0 + ( code - 1 ) * in_value1 + 3 ) / 7 );
+    }
+    else
+    {
+        for ( GLuint code = 2; code < 6; code++ )
+            in_palette->colors[code][0] = static_cast<float>( ( ( 6 - code ) * in_value0 + ( code - 1 ) * in_value1 + 2 ) / 5 );
+
+        in_palette->colors[6][0] = 0.0f;
+        in_palette->colors[7][0] = 255.0f;
+    }
+
+    in_palette->entries = 8;
+}
+
+static void FitBc4( const glCoreBlockEncoder_t* in_encoder, const blockPixels_t* in_pixels, const GLuint in_value0, const GLuint in_value1, bc4Block_t* in_block )
+{
+    static const float k_WEIGHTS[4] = { 1.0f, 0.0f, 0.0f, 0.0f };
+    blockPalette_t palette;
+    Bc4Palette( in_value0, in_value1, &palette );
+    in_block->value0 = in_value0;
+    in_block->value1 = in_value1;
+    in_block->error = in_encoder->fit( in_pixels, &palette, k_WEIGHTS, in_block->indices );
+}
+
+/// @brief a single channel block, the BC3 alpha and the BC5 channels are BC4 blocks
+static void EncodeBc4( const glCoreBlockEncoder_t* in_encoder, const uint8_t in_block[16][4], const GLuint in_channel, uint8_t* in_destine )
+{
+    blockPixels_t pixels;
+    GLuint minimum = 255;
+    GLuint maximum = 0;
+    GLuint interiorMinimum = 255;
+    GLuint interiorMaximum = 0;
+    for ( GLuint i = 0; i < 16; i++ )
+    {
+        const GLuint value = in_block[i][in_channel];
+        pixels.channels[0][i] = static_cast<float>( value );
+        pixels.channels[1][i] = pixels.channels[2][i] = pixels.channels[3][i] = 0.0f;
+        minimum = std::min( minimum, value );
+        maximum = std::max( maximum, value );
+        if ( value != 0 && value != 255 )
+        {
+            interiorMinimum = std::min( interiorMinimum, value );
+            interiorMaximum = std::max( interiorMaximum, value );
+        }
+    }
+    pixels.count = 16;
+
+    // 8 values mode, the first endpoint must be the greater
+    bc4Block_t best;
+    FitBc4( in_encoder, &pixels, maximum, minimum, &best );
+    if ( in_encoder->createInfo.quality != gl::BLOCK_QUALITY_FAST && best.error > 0.0f )
+    {
+        for ( GLuint pass = 0; pass < in_encoder->refines; pass++ )
+        {
+            float endpoint0[4];
+            float endpoint1[4];
+            if ( !RefineEndpoints( &pixels, 1, best.indices, k_BC4_FRACTIONS8, endpoint0, endpoint1 ) )
+                break;
+
+            GLuint value0 = static_cast<GLuint>( endpoint0[0] + 0.5f );
+            GLuint value1 = static_cast<GLuint>( endpoint1[0] + 0.5f );
+            if ( value0 < value1 )
+                std::swap( value0, value1 );
+
+            if ( value0 == value1 )
+                break;
+
+            bc4Block_t candidate;
+            FitBc4( in_encoder, &pixels, value0, value1, &candidate );
+            if ( candidate.error >= best.error )
+                break;
+
+            best = candidate;
+        }
+
+        if ( in_encoder->createInfo.quality == gl::BLOCK_QUALITY_HIGH && best.error > 0.0f )
+        {
+            const bc4Block_t center = best;
+            for ( int delta0 = -2; delta0 <= 2; delta0++ )
+            {
+                for ( int delta1 = -2; delta1 <= 2; delta1++ )
+                {
+                    const int value0 = static_cast<int>( center.value0 ) + delta0;
+                    const int value1 = static_cast<int>( center.value1 ) + delta1;
+                    if ( value0 > 255 || value1 < 0 || value0 <= value1 || ( delta0 == 0 && delta1 == 0 ) )
+                        continue;
+
+                    bc4Block_t candidate;
+                    FitBc4( in_encoder, &pixels, static_cast<GLuint>( value0 ), static_cast<GLuint>( value1 ), &candidate );
+                    if ( candidate.error < best.error )
+                        best = candidate;
+                }
+            }
+        }
+
+        // 6 values mode, exact 0 and 255
+        if ( minimum == 0 || maximum == 255 )
+        {
+            bc4Block_t candidate;
+            if ( interiorMinimum > interiorMaximum )
+                FitBc4( in_encoder, &pixels, 0, 0, &candidate );
+            else
+                FitBc4( in_encoder, &pixels, interiorMinimum, interiorMaximum, &candidate );
+
+            if ( candidate.error < best.error )
+                best = candidate;
+        }
+    }
+
+    uint64_t bits = 0;
+    for ( GLuint i = 0; i < 16; i++ )
+        bits |= static_cast<uint64_t>( best.indices[i] ) << ( i * 3 );
+
+    in_destine[0] = static_cast<uint8_t>( best.value0 );
+    in_destine[1] = static_cast<uint8_t>( best.value1 );
+    for ( GLuint i = 0; i < 6; i++ )
+        in_destine[2 + i] = static_cast<uint8_t>( bits >> ( i * 8 ) );
+}
+
+/// @brief explicit 4 bits alpha
+static void EncodeBc2Alpha( const uint8_t in_block[16][4], uint8_t* in_destine )
+{
+    uint64_t bits = 0;
+    for ( GLuint i = 0; i < 16; i++ )
+        bits |= static_cast<uint64_t>( ( in_block[i][3] * 15 + 127 ) / 255 ) << ( i * 4 );
+
+    for ( GLuint i = 0; i < 8; i++ )
+        in_destine[i] = static_cast<uint8_t>( bits >> ( i * 8 ) );
+}
+
+// ============================================================================================
+// BC7
+// ============================================================================================
+
+/// @brief 2 subsets partitions, bit i set when the pixel i belong to the second subset
+static const uint16_t k_BC7_PARTITIONS2[64] =
+{
+    0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+    0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+    0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+    0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+    0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+    0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+    0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+    0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22
+};
+
+/// @brief anchor pixel of the second subset, its index drop the high bit
+static const uint8_t k_BC7_ANCHORS2[64] =
+{
+    15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15,
+    15,  2,  8,  2,  2,  8,  8, 15,
+     2,  8,  2,  2,  8,  8,  2,  2,
+    15, 15,  6,  8,  2,  8, 15, 15,
+     2,  8,  2,  2,  2, 15, 15,  6,
+     6,  2,  6,  8, 15, 15,  2,  2,
+    15, 15, 15, 15, 15,  2,  2, 15
+};
+
+static const GLuint k_BC7_WEIGHTS2[4] = { 0, 21, 43, 64 };
+static const GLuint k_BC7_WEIGHTS3[8] = { 0, 9, 18, 27, 37, 46, 55, 64 };
+static const GLuint k_BC7_WEIGHTS4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+typedef struct bc7ModeInfo_t
+{
+    GLuint  subsets;
+    GLuint  partitionBits;
+    GLuint  rotationBits;
+    GLuint  selectorBits;
+    GLuint  colorBits;
+    GLuint  alphaBits;
+    GLuint  endpointPBits;      // a p-bit per endpoint
+    GLuint  sharedPBits;        // a p-bit per subset
+    GLuint  indexBits;
+    GLuint  index2Bits;         // separated alpha / color indices
+} bc7ModeInfo_t;
+
+static const bc7ModeInfo_t k_BC7_MODES[8] =
+{
+    { 3, 4, 0, 0, 4, 0, 1, 0, 3, 0 },
+    { 2, 6, 0, 0, 6, 0, 0, 1, 3, 0 },
+    { 3, 6, 0, 0, 5, 0, 0, 0, 2, 0 },
+    { 2, 6, 0, 0, 7, 0, 1, 0, 2, 0 },
+    { 1, 0, 2, 1, 5, 6, 0, 0, 2, 3 },
+    { 1, 0, 2, 0, 7, 8, 0, 0, 2, 2 },
+    { 1, 0, 0, 0, 7, 7, 1, 0, 4, 0 },
+    { 2, 6, 0, 0, 5, 5, 1, 0, 2, 0 }
+};
+
+/// @brief a 128 bits block, written and read from the least significant bit
+typedef struct bc7Bits_t
+{
+    uint8_t     bytes[16] = {};
+    GLuint      position = 0;
+} bc7Bits_t;
+
+static void WriteBits( bc7Bits_t* in_bits, const GLuint in_value, const GLuint in_count )
+{
+    for ( GLuint i = 0; i < in_count; i++, in_bits->position++ )
+    {
+        if ( ( in_value >> i ) & 1 )
+            in_bits->bytes[in_bits->position >> 3] |= static_cast<uint8_t>( 1u << ( in_bits->position & 7 ) );
+    }
+}
+
+static GLuint ReadBits( bc7Bits_t* in_bits, const GLuint in_count )
+{
+    GLuint value = 0;
+    for ( GLuint i = 0; i < in_count && in_bits->position < 128; i++, in_bits->position++ )
+        value |= static_cast<GLuint>( ( in_bits->bytes[in_bits->position >> 3] >> ( in_bits->position & 7 ) ) & 1 ) << i;
+
+    return value;
+}
+
+static const GLuint* Bc7Weights( const GLuint in_bits )
+{
+    return ( in_bits == 2 ) ? k_BC7_WEIGHTS2 : ( in_bits == 3 ) ? k_BC7_WEIGHTS3 : k_BC7_WEIGHTS4;
+}
+
+static GLuint Bc7Interpolate( const GLuint in_endpoint0, const GLuint in_endpoint1, const GLuint in_weight )
+{
+    return ( ( 64 - in_weight ) * in_endpoint0 + in_weight * in_endpoint1 + 32 ) >> 6;
+}
+
+/// @brief unquantized endpoint, the p-bit already appended
+static GLuint Bc7Expand( const GLuint in_value, const GLuint in_precision )
+{
+    return ( ( in_value << ( 8 - in_precision ) ) | ( in_value >> ( 2 * in_precision - 8 ) ) ) & 0xFF;
+}
+
+static void Bc7Palette( const GLuint* in_endpoint0, const GLuint* in_endpoint1, const GLuint in_indexBits, blockPalette_t* in_palette )
+{
+    const GLuint* weights = Bc7Weights( in_indexBits );
+    in_palette->entries = 1u << in_indexBits;
+    for ( GLuint e = 0; e < in_palette->entries; e++ )
+    {
+        for ( GLuint c = 0; c < 4; c++ )
+            in_palette->colors[e][c] = static_cast<float>( Bc7Interpolate( in_endpoint0[c], in_endpoint1[c], weights[e] ) );
+    }
+}
+
+/// @brief mode 6, 1 subset RGBA 7.7.7.7 whit a p-bit per endpoint, 4 bits indices
+typedef struct bc7Mode6_t
+{
+    GLuint      quantized[2][4] = {};
+    GLuint      pbits[2] = {};
+    uint8_t     indices[16] = {};
+    float       error = 0.0f;
+} bc7Mode6_t;
+
+static void QuantizeMode6( const float* in_endpoint, const float* in_weights, GLuint* in_quantized, GLuint* in_pbit )
+{
+    float best = std::numeric_limits<float>::max();
+    for ( GLuint pbit = 0; pbit < 2; pbit++ )
+    {
+        GLuint quantized[4];
+        float error = 0.0f;
+        for ( GLuint c = 0; c < 4; c++ )
+        {
+            const float level = ( in_endpoint[c] - static_cast<float>( pbit ) ) * 0.5f + 0.5f;
+            quantized[c] = static_cast<GLuint>( std::min( std::max( level, 0.0f ), 127.0f ) );
+            const float delta = static_cast<float>( ( quantized[c] << 1 ) | pbit ) - in_endpoint[c];
+            error += delta * delta * in_weights[c];
+        }
+
+        if ( error < best )
+        {
+            best = error;
+            *in_pbit = pbit;
+            for ( GLuint c = 0; c < 4; c++ )
+                in_quantized[c] = quantized[c];
+        }
+    }
+}
+
+static void FitMode6( const glCoreBlockEncoder_t* in_encoder, const blockPixels_t* in_pixels, const float* in_endpoint0, const float* in_endpoint1, bc7Mode6_t* in_block )
+{
+    QuantizeMode6( in_endpoint0, in_encoder->weights, in_block->quantized[0], &in_block->pbits[0] );
+    QuantizeMode6( in_endpoint1, in_encoder->weights, in_block->quantized[1], &in_block->pbits[1] );
+
+    GLuint endpoints[2][4];
+    for ( GLuint e = 0; e < 2; e++ )
+        for ( GLuint c = 0; c < 4; c++ )
+            endpoints[e][c] = ( in_block->quantized[e][c] << 1 ) | in_block->pbits[e];
+
+    blockPalette_t palette;
+    Bc7Palette( endpoints[0], endpoints[1], 4, &palette );
+    in_block->error = in_encoder->fit( in_pixels, &palette, in_encoder->weights, in_block->indices );
+}
+
+static float EncodeMode6( const glCoreBlockEncoder_t* in_encoder, const blockPixels_t* in_pixels, bc7Bits_t* in_bits )
+{
+    float fractions[16];
+    for ( GLuint i = 0; i < 16; i++ )
+        fractions[i] = static_cast<float>( k_BC7_WEIGHTS4[i] ) / 64.0f;
+
+    float endpoint0[4];
+    float endpoint1[4];
+    AxisEndpoints( in_pixels, 4, endpoint0, endpoint1 );
+
+    bc7Mode6_t best;
+    FitMode6( in_encoder, in_pixels, endpoint0, endpoint1, &best );
+    for ( GLuint pass = 0; pass < in_encoder->refines && best.error > 0.0f; pass++ )
+    {
+        if ( !RefineEndpoints( in_pixels, 4, best.indices, fractions, endpoint0, endpoint1 ) )
+            break;
+
+        bc7Mode6_t candidate;
+        FitMode6( in_encoder, in_pixels, endpoint0, endpoint1, &candidate );
+        if ( candidate.error >= best.error )
+            break;
+
+        best = candidate;
+    }
+
+    // the anchor index high bit is implicit 0
+    if ( best.indices[0] & 8 )
+    {
+        for ( GLuint c = 0; c < 4; c++ )
+            std::swap( best.quantized[0][c], best.quantized[1][c] );
+
+        std::swap( best.pbits[0], best.pbits[1] );
+        for ( GLuint i = 0; i < 16; i++ )
+            best.indices[i] = static_cast<uint8_t>( 15 - best.indices[i] );
+    }
+
+    WriteBits( in_bits, 1u << 6, 7 );
+    for ( GLuint c = 0; c < 4; c++ )
+    {
+        WriteBits( in_bits, best.quantized[0][c], 7 );
+        WriteBits( in_bits, best.quantized[1][c], 7 );
+    }
+
+    WriteBits( in_bits, best.pbits[0], 1 );
+    WriteBits( in_bits, best.pbits[1], 1 );
+    for ( GLuint i = 0; i < 16; i++ )
+        WriteBits( in_bits, best.indices[i], ( i == 0 ) ? 3 : 4 );
+
+    return best.error;
+}
+
+/// @brief a mode 1 subset, RGB 6.6.6 whit a shared p-bit, 3 bits indices
+typedef struct bc7Subset_t
+{
+    GLuint      quantized[2][3] = {};
+    GLuint      pbit = 0;
+    uint8_t     indices[16] = {};
+    float       error = 0.0f;
+} bc7Subset_t;
+
+static GLuint ExpandMode1( const GLuint in_quantized, const GLuint in_pbit )
+{
+    return Bc7Expand( ( in_quantized << 1 ) | in_pbit, 7 );
+}
+
+static void FitMode1( const glCoreBlockEncoder_t* in_encoder, const blockPixels_t* in_pixels, const float* in_endpoint0, const float* in_endpoint1, bc7Subset_t* in_subset )
+{
+    const float* endpoints[2] = { in_endpoint0, in_endpoint1 };
+    float best = std::numeric_limits<float>::max();
+    for ( GLuint pbit = 0; pbit < 2; pbit++ )
+    {
+        GLuint quantized[2][3];
+        float error = 0.0f;
+        for ( GLuint e = 0; e < 2; e++ )
+        {
+            for ( GLuint c = 0; c < 3; c++ )
+            {
+                const float level = ( endpoints[e][c] - static_cast<float>( 2 * pbit ) ) * 0.25f + 0.5f;
+                quantized[e][c] = static_cast<GLuint>( std::min( std::max( level, 0.0f ), 63.0f ) );
+                const float delta = static_cast<float>( ExpandMode1( quantized[e][c], pbit ) ) - endpoints[e][c];
+                error += delta * delta * in_encoder->weights[c];
+            }
+        }
+
+        if ( error < best )
+        {
+            best = error;
+            in_subset->pbit = pbit;
+            for ( GLuint e = 0; e < 2; e++ )
+                for ( GLuint c = 0; c < 3; c++ )
+                    in_subset->quantized[e][c] = quantized[e][c];
+        }
+    }
+
+    GLuint expanded[2][4];
+    for ( GLuint e = 0; e < 2; e++ )
+    {
+        for ( GLuint c = 0; c < 3; c++ )
+            expanded[e][c] = ExpandMode1( in_subset->quantized[e][c], in_subset->pbit );
+
+        expanded[e][3] = 255;
+    }
+
+    blockPalette_t palette;
+    Bc7Palette( expanded[0], expanded[1], 3, &palette );
+    in_subset->error = in_encoder->fit( in_pixels, &palette, in_encoder->weights, in_subset->indices );
+}
+
+static void EncodeMode1Subset( const glCoreBlockEncoder_t* in_encoder, const blockPixels_t* in_pixels, bc7Subset_t* in_subset )
+{
+    float fractions[8];
+    for ( GLuint i = 0; i < 8; i++ )
+        fractions[i] = static_cast<float>( k_BC7_WEIGHTS3[i] ) / 64.0f;
+
+    float endpoint0[4];
+    float endpoint1[4];
+    AxisEndpoints( in_pixels, 3, endpoint0, endpoint1 );
+    FitMode1( in_encoder, in_pixels, endpoint0, endpoint1, in_subset );
+    for ( GLuint pass = 0; pass < in_encoder->refines && in_subset->error > 0.0f; pass++ )
+    {
+        if ( !RefineEndpoints( in_pixels, 3, in_subset->indices, fractions, endpoint0, endpoint1 ) )
+            break;
+
+        bc7Subset_t candidate;
+        FitMode1( in_encoder, in_pixels, endpoint0, endpoint1, &candidate );
+        if ( candidate.error >= in_subset->error )
+            break;
+
+        *in_subset = candidate;
+    }
+}
+
+/// @brief the partitions in columns, for the subset sums
+typedef struct bc7PartitionTable_t
+{
+    alignas( 16 ) float     second[16][64];     // 1 where the pixel belong to the second subset
+    alignas( 16 ) float     counts[64];         // second subset pixels
+} bc7PartitionTable_t;
+
+static const bc7PartitionTable_t& PartitionTable( void )
+{
+    static const bc7PartitionTable_t table = []( void )
+    {
+        bc7PartitionTable_t result;
+        for ( GLuint partition = 0; partition < 64; partition++ )
+        {
+            result.counts[partition] = 0.0f;
+            for ( GLuint i = 0; i < 16; i++ )
+            {
+                result.second[i][partition] = static_cast<float>( ( k_BC7_PARTITIONS2[partition] >> i ) & 1 );
+                result.counts[partition] += result.second[i][partition];
+            }
+        }
+        return result;
+    }( );
+
+    return table;
+}
+
+/// @brief error left around the principal axis of a subset, from its color moments
+/// ( sums of r, g, b, rr, rg, rb, gg, gb, bb )
+static float SubsetResidual( const float* in_moments, const float in_count )
+{
+    const float scale = 1.0f / in_count;
+    float covariance[3][3];
+    covariance[0][0] = in_moments[3] - in_moments[0] * in_moments[0] * scale;
+    covariance[0][1] = covariance[1][0] = in_moments[4] - in_moments[0] * in_moments[1] * scale;
+    covariance[0][2] = covariance[2][0] = in_moments[5] - in_moments[0] * in_moments[2] * scale;
+    covariance[1][1] = in_moments[6] - in_moments[1] * in_moments[1] * scale;
+    covariance[1][2] = covariance[2][1] = in_moments[7] - in_moments[1] * in_moments[2] * scale;
+    covariance[2][2] = in_moments[8] - in_moments[2] * in_moments[2] * scale;
+    const float trace = covariance[0][0] + covariance[1][1] + covariance[2][2];
+
+    // largest eigenvalue, the variance the subset line hold, a power step from the most spread channel
+    const GLuint largest = ( covariance[0][0] > covariance[1][1] ) ? ( ( covariance[0][0] > covariance[2][2] ) ? 0 : 2 ) : ( ( covariance[1][1] > covariance[2][2] ) ? 1 : 2 );
+    const float* axis = covariance[largest];
+    float next[3];
+    for ( GLuint a = 0; a < 3; a++ )
+        next[a] = covariance[a][0] * axis[0] + covariance[a][1] * axis[1] + covariance[a][2] * axis[2];
+
+    const float projection = axis[0] * next[0] + axis[1] * next[1] + axis[2] * next[2];
+    if ( projection < 1e-6f )
+        return std::max( trace, 0.0f );
+
+    const float eigenvalue = ( next[0] * next[0] + next[1] * next[1] + next[2] * next[2] ) / projection;
+    return std::max( trace - eigenvalue, 0.0f );
+}
+
+/// @brief sort the partitions by the error left around the principal axis of each subset
+static GLuint RankPartitions( const uint8_t in_block[16][4], GLuint* in_partitions, const GLuint in_count )
+{
+    const bc7PartitionTable_t& table = PartitionTable();
+    float moments[16][9];
+    float total[9] = {};
+    for ( GLuint i = 0; i < 16; i++ )
+    {
+        const float r = in_block[i][0];
+        const float g = in_block[i][1];
+        const float b = in_block[i][2];
+        const float pixel[9] = { r, g, b, r * r, r * g, r * b, g * g, g * b, b * b };
+        for ( GLuint m = 0; m < 9; m++ )
+        {
+            moments[i][m] = pixel[m];
+            total[m] += pixel[m];
+        }
+    }
+
+    // the second subsets sums of every partition at once, the first subset is what is left
+    alignas( 16 ) float second[9][64] = {};
+    for ( GLuint i = 0; i < 16; i++ )
+    {
+        for ( GLuint m = 0; m < 9; m++ )
+        {
+            const float moment = moments[i][m];
+            for ( GLuint partition = 0; partition < 64; partition++ )
+                second[m][partition] += table.second[i][partition] * moment;
+        }
+    }
+
+    float ranks[64];
+    GLuint order[64];
+    for ( GLuint partition = 0; partition < 64; partition++ )
+    {
+        float first[9];
+        float last[9];
+        for ( GLuint m = 0; m < 9; m++ )
+        {
+            last[m] = second[m][partition];
+            first[m] = total[m] - last[m];
+        }
+
+        const float count = table.counts[partition];
+        ranks[partition] = SubsetResidual( first, 16.0f - count ) + SubsetResidual( last, count );
+        order[partition] = partition;
+    }
+
+    const GLuint count = std::min<GLuint>( in_count, 64 );
+    std::partial_sort( order, order + count, order + 64, [&ranks]( const GLuint a, const GLuint b ) { return ranks[a] < ranks[b]; } );
+    for ( GLuint i = 0; i < count; i++ )
+        in_partitions[i] = order[i];
+
+    return count;
+}
+
+static float EncodeMode1( const glCoreBlockEncoder_t* in_encoder, const uint8_t in_block[16][4], const GLuint in_partition, bc7Bits_t* in_bits )
+{
+    const uint16_t mask = k_BC7_PARTITIONS2[in_partition];
+    const GLuint anchors[2] = { 0, k_BC7_ANCHORS2[in_partition] };
+    GLuint local[16];
+    bc7Subset_t subsets[2];
+    float error = 0.0f;
+    for ( GLuint subset = 0; subset < 2; subset++ )
+    {
+        blockPixels_t pixels;
+        pixels.count = 0;
+        for ( GLuint i = 0; i < 16; i++ )
+        {
+            if ( ( ( mask >> i ) & 1 ) != subset )
+                continue;
+
+            for ( GLuint c = 0; c < 4; c++ )
+                pixels.channels[c][pixels.count] = in_block[i][c];
+
+            local[i] = pixels.count++;
+        }
+
+        PadPixels( &pixels );
+        EncodeMode1Subset( in_encoder, &pixels, &subsets[subset] );
+        error += subsets[subset].error;
+
+        // the anchor index high bit is implicit 0
+        bc7Subset_t& encoded = subsets[subset];
+        if ( encoded.indices[local[anchors[subset]]] & 4 )
+        {
+            for ( GLuint c = 0; c < 3; c++ )
+                std::swap( encoded.quantized[0][c], encoded.quantized[1][c] );
+
+            for ( GLuint i = 0; i < pixels.count; i++ )
+                encoded.indices[i] = static_cast<uint8_t>( 7 - encoded.indices[i] );
+        }
+    }
+
+    WriteBits( in_bits, 2, 2 );
+    WriteBits( in_bits, in_partition, 6 );
+    for ( GLuint c = 0; c < 3; c++ )
+    {
+        for ( GLuint subset = 0; subset < 2; subset++ )
+        {
+            WriteBits( in_bits, subsets[subset].quantized[0][c], 6 );
+            WriteBits( in_bits, subsets[subset].quantized[1][c], 6 );
+        }
+    }
+
+    WriteBits( in_bits, subsets[0].pbit, 1 );
+    WriteBits( in_bits, subsets[1].pbit, 1 );
+    for ( GLuint i = 0; i < 16; i++ )
+    {
+        const GLuint subset = ( mask >> i ) & 1;
+        WriteBits( in_bits, subsets[subset].indices[local[i]], ( i == anchors[0] || i == anchors[1] ) ? 2 : 3 );
+    }
+
+    return error;
+}
+
+static void EncodeBc7( const glCoreBlockEncoder_t* in_encoder, const uint8_t in_block[16][4], uint8_t* in_destine )
+{
+    blockPixels_t pixels;
+    LoadPixels( in_block, &pixels );
+
+    bc7Bits_t best;
+    float bestError = EncodeMode6( in_encoder, &pixels, &best );
+
+    // mode 1 have no alpha, but twice the color endpoints
+    bool opaque = true;
+    for ( GLuint i = 0; i < 16 && opaque; i++ )
+        opaque = in_block[i][3] == 255;
+
+    if ( opaque && in_encoder->partitions > 0 && bestError > 0.0f )
+    {
+        GLuint partitions[64];
+        const GLuint count = RankPartitions( in_block, partitions, in_encoder->partitions );
+        for ( GLuint i = 0; i < count; i++ )
+        {
+            bc7Bits_t bits;
+            const float error = EncodeMode1( in_encoder, in_block, partitions[i], &bits );
+            if ( error < bestError )
+            {
+                bestError = error;
+                best = bits;
+            }
+        }
+    }
+
+    std::memcpy( in_destine, best.bytes, 16 );
+}
+
+// ============================================================================================
+// decoders
+// ============================================================================================
+
+static void DecodeBc1( const uint8_t* in_source, const bool in_fourColors, const bool in_alpha, uint8_t in_pixels[16][4] )
+{
+    const uint16_t color0 = static_cast<uint16_t>( in_source[0] | ( in_source[1] << 8 ) );
+    const uint16_t color1 = static_cast<uint16_t>( in_source[2] | ( in_source[3] << 8 ) );
+    GLuint colors[4][4];
+    Expand565( color0, colors[0] );
+    Expand565( color1, colors[1] );
+    colors[0][3] = colors[1][3] = colors[2][3] = colors[3][3] = 255;
+
+    const bool four = in_fourColors || color0 > color1;
+    for ( GLuint c = 0; c < 3; c++ )
+    {
+        if ( four )
+        {
+            colors[2][c] = ( 2 * colors[0][c] + colors[1][c] ) / 3;
+            colors[3][c] = ( colors[0][c] + 2 * colors[1][c] ) / 3;
+        }
+        else
+        {
+            colors[2][c] = ( colors[0][c] + colors[1][c] ) / 2;
+            colors[3][c] = 0;
+        }
+    }
+
+    if ( !four && in_alpha )
+        colors[3][3] = 0;
+
+    const uint32_t bits = static_cast<uint32_t>( in_source[4] ) | ( static_cast<uint32_t>( in_source[5] ) << 8 ) |
+                          ( static_cast<uint32_t>( in_source[6] ) << 16 ) | ( static_cast<uint32_t>( in_source[7] ) << 24 );
+    for ( GLuint i = 0; i < 16; i++ )
+    {
+        const GLuint index = ( bits >> ( i * 2 ) ) & 3;
+        for ( GLuint c = 0; c < 4; c++ )
+            in_pixels[i][c] = static_cast<uint8_t>( colors[index][c] );
+    }
+}
+
+static void DecodeBc4( const uint8_t* in_source, const GLuint in_channel, uint8_t in_pixels[16][4] )
+{
+    blockPalette_t palette;
+    Bc4Palette( in_source[0], in_source[1], &palette );
+
+    uint64_t bits = 0;
+    for ( GLuint i = 0; i < 6; i++ )
+        bits |= static_cast<uint64_t>( in_source[2 + i] ) << ( i * 8 );
+
+    for ( GLuint i = 0; i < 16; i++ )
+        in_pixels[i][in_channel] = static_cast<uint8_t>( palette.colors[( bits >> ( i * 3 ) ) & 7][0] );
+}
+
+static void DecodeBc7( const uint8_t* in_source, uint8_t in_pixels[16][4] )
+{
+    bc7Bits_t bits;
+    std::memcpy( bits.bytes, in_source, 16 );
+
+    GLuint mode = 0;
+    while ( mode < 8 && ReadBits( &bits, 1 ) == 0 )
+        mode++;
+
+    // reserved mode, or the 3 subsets modes
+    if ( mode >= 8 || k_BC7_MODES[mode].subsets > 2 )
+    {
+        std::memset( in_pixels, 0, 64 );
+        return;
+    }
+
+    const bc7ModeInfo_t& info = k_BC7_MODES[mode];
+    const GLuint partition = ReadBits( &bits, info.partitionBits );
+    const GLuint rotation = ReadBits( &bits, info.rotationBits );
+    const GLuint selector = ReadBits( &bits, info.selectorBits );
+
+    GLuint endpoints[2][2][4] = {};
+    for ( GLuint c = 0; c < 3; c++ )
+        for ( GLuint s = 0; s < info.subsets; s++ )
+            for ( GLuint e = 0; e < 2; e++ )
+                endpoints[s][e][c] = ReadBits( &bits, info.colorBits );
+
+    for ( GLuint s = 0; s < info.subsets && info.alphaBits > 0; s++ )
+        for ( GLuint e = 0; e < 2; e++ )
+            endpoints[s][e][3] = ReadBits( &bits, info.alphaBits );
+
+    GLuint colorPrecision = info.colorBits;
+    GLuint alphaPrecision = info.alphaBits;
+    const GLuint pbitChannels = ( info.alphaBits > 0 ) ? 4 : 3;
+    if ( info.endpointPBits || info.sharedPBits )
+    {
+        for ( GLuint s = 0; s < info.subsets; s++ )
+        {
+            GLuint pbit = info.sharedPBits ? ReadBits( &bits, 1 ) : 0;
+            for ( GLuint e = 0; e < 2; e++ )
+            {
+                if ( info.endpointPBits )
+                    pbit = ReadBits( &bits, 1 );
+
+                for ( GLuint c = 0; c < pbitChannels; c++ )
+                    endpoints[s][e][c] = ( endpoints[s][e][c] << 1 ) | pbit;
+            }
+        }
+
+        colorPrecision++;
+        if ( info.alphaBits > 0 )
+            alphaPrecision++;
+    }
+
+    for ( GLuint s = 0; s < info.subsets; s++ )
+    {
+        for ( GLuint e = 0; e < 2; e++ )
+        {
+            for ( GLuint c = 0; c < 3; c++ )
+                endpoints[s][e][c] = Bc7Expand( endpoints[s][e][c], colorPrecision );
+
+            endpoints[s][e][3] = ( info.alphaBits > 0 ) ? Bc7Expand( endpoints[s][e][3], alphaPrecision ) : 255;
+        }
+    }
+
+    const uint16_t mask = ( info.subsets == 2 ) ? k_BC7_PARTITIONS2[partition] : 0;
+    const GLuint anchor = ( info.subsets == 2 ) ? k_BC7_ANCHORS2[partition] : 0;
+    GLuint indices[16];
+    GLuint indices2[16] = {};
+    for ( GLuint i = 0; i < 16; i++ )
+        indices[i] = ReadBits( &bits, info.indexBits - ( ( i == 0 || i == anchor ) ? 1 : 0 ) );
+
+    for ( GLuint i = 0; i < 16 && info.index2Bits > 0; i++ )
+        indices2[i] = ReadBits( &bits, info.index2Bits - ( ( i == 0 ) ? 1 : 0 ) );
+
+    for ( GLuint i = 0; i < 16; i++ )
+    {
+        const GLuint s = ( mask >> i ) & 1;
+        GLuint colorWeight = Bc7Weights( info.indexBits )[indices[i]];
+        GLuint alphaWeight = colorWeight;
+        if ( info.index2Bits > 0 )
+        {
+            alphaWeight = Bc7Weights( info.index2Bits )[indices2[i]];
+            if ( selector )
+                std::swap( colorWeight, alphaWeight );
+        }
+
+        for ( GLuint c = 0; c < 3; c++ )
+            in_pixels[i][c] = static_cast<uint8_t>( Bc7Interpolate( endpoints[s][0][c], endpoints[s][1][c], colorWeight ) );
+
+        in_pixels[i][3] = static_cast<uint8_t>( Bc7Interpolate( endpoints[s][0][3], endpoints[s][1][3], alphaWeight ) );
+        if ( rotation > 0 )
+            std::swap( in_pixels[i][3], in_pixels[i][rotation - 1] );
+    }
+}
+
+static void DecodeBlock( const blockKind_t in_kind, const uint8_t* in_source, uint8_t in_pixels[16][4] )
+{
+    switch ( in_kind )
+    {
+    case BLOCK_KIND_BC1:
+    case BLOCK_KIND_BC1_ALPHA:
+        DecodeBc1( in_source, false, in_kind == BLOCK_KIND_BC1_ALPHA, in_pixels );
+        break;
+    case BLOCK_KIND_BC2:
+        DecodeBc1( in_source + 8, true, false, in_pixels );
+        for ( GLuint i = 0; i < 16; i++ )
+            in_pixels[i][3] = static_cast<uint8_t>( ( ( in_source[i / 2] >> ( ( i & 1 ) * 4 ) ) & 15 ) * 17 );
+        break;
+    case BLOCK_KIND_BC3:
+        DecodeBc1( in_source + 8, true, false, in_pixels );
+        DecodeBc4( in_source, 3, in_pixels );
+        break;
+    case BLOCK_KIND_BC4:
+    case BLOCK_KIND_BC5:
+        for ( GLuint i = 0; i < 16; i++ )
+        {
+            in_pixels[i][1] = in_pixels[i][2] = 0;
+            in_pixels[i][3] = 255;
+        }
+
+        DecodeBc4( in_source, 0, in_pixels );
+        if ( in_kind == BLOCK_KIND_BC5 )
+            DecodeBc4( in_source + 8, 1, in_pixels );
+        break;
+    case BLOCK_KIND_BC7:
+        DecodeBc7( in_source, in_pixels );
+        break;
+    default:
+        std::memset( in_pixels, 0, 64 );
+        break;
+    }
+}
+
+// ============================================================================================
+// passes
+// ============================================================================================
+
+/// @brief the edge pixels are repeated to fill the partial blocks
+static void LoadBlock( const blockPass_t* in_pass, const GLuint in_blockX, const GLuint in_blockY, uint8_t in_block[16][4] )
+{
+    for ( GLuint y = 0; y < 4; y++ )
+    {
+        const GLuint row = std::min( in_blockY * 4 + y, in_pass->height - 1 );
+        const uint8_t* source = in_pass->source + static_cast<size_t>( row ) * static_cast<size_t>( in_pass->stride );
+        for ( GLuint x = 0; x < 4; x++ )
+        {
+            const GLuint column = std::min( in_blockX * 4 + x, in_pass->width - 1 );
+            std::memcpy( in_block[y * 4 + x], source + column * 4, 4 );
+        }
+    }
+}
+
+static void EncodeJob( glCoreBlockEncoder_t* in_encoder, const GLuint in_begin, const GLuint in_end )
+{
+    const blockPass_t& pass = in_encoder->pass;
+    for ( GLuint blockY = in_begin; blockY < in_end; blockY++ )
+    {
+        for ( GLuint blockX = 0; blockX < pass.blocksX; blockX++ )
+        {
+            uint8_t block[16][4];
+            LoadBlock( &pass, blockX, blockY, block );
+
+            uint8_t* destine = pass.destine + ( static_cast<size_t>( blockY ) * pass.blocksX + blockX ) * pass.blockBytes;
+            bc1Block_t color;
+            switch ( pass.kind )
+            {
+            case BLOCK_KIND_BC1:
+            case BLOCK_KIND_BC1_ALPHA:
+                EncodeBc1( in_encoder, block, pass.kind == BLOCK_KIND_BC1_ALPHA, destine );
+                break;
+            case BLOCK_KIND_BC2:
+                EncodeBc2Alpha( block, destine );
+                EncodeBc1Four( in_encoder, block, &color );
+                WriteBc1( &color, destine + 8 );
+                break;
+            case BLOCK_KIND_BC3:
+                EncodeBc4( in_encoder, block, 3, destine );
+                EncodeBc1Four( in_encoder, block, &color );
+                WriteBc1( &color, destine + 8 );
+                break;
+            case BLOCK_KIND_BC4:
+                EncodeBc4( in_encoder, block, 0, destine );
+                break;
+            case BLOCK_KIND_BC5:
+                EncodeBc4( in_encoder, block, 0, destine );
+                EncodeBc4( in_encoder, block, 1, destine + 8 );
+                break;
+            case BLOCK_KIND_BC7:
+                EncodeBc7( in_encoder, block, destine );
+                break;
+            default:
+                break;
+            }
+        }
+    }
+}
+
+// ============================================================================================
+// gl::BlockEncoder
+// ============================================================================================
+
+gl::BlockEncoder::BlockEncoder( void ) : m_encoder( nullptr )
+{
+}
+
+gl::BlockEncoder::~BlockEncoder( void )
+{
+    Destroy();
+}
+
+bool gl::BlockEncoder::Create( const createInfo_t* in_createInfo )
+{
+    static const GLuint k_REFINES[] = { 0, 1, 3 };
+    static const GLuint k_PARTITIONS[] = { 0, 2, 8 };
+
+    if ( in_createInfo == nullptr || in_createInfo->quality > BLOCK_QUALITY_HIGH )
+        return false;
+
+    Destroy();
+
+    const mipSimd_t simd = ( in_createInfo->simd == MIP_SIMD_AUTO ) ? MipGenerator::BestSimd() : in_createInfo->simd;
+    if ( !SimdSupported( simd ) )
+        return false;
+
+    m_encoder = new glCoreBlockEncoder_t();
+    m_encoder->createInfo = *in_createInfo;
+    m_encoder->refines = k_REFINES[in_createInfo->quality];
+    m_encoder->partitions = k_PARTITIONS[in_createInfo->quality];
+    SelectKernel( m_encoder, simd );
+    m_encoder->stats.simd = m_encoder->simd;
+
+    // Rec. 601 luma weights, scaled to keep the alpha comparable
+    if ( in_createInfo->perceptual )
+    {
+        m_encoder->weights[0] = 0.299f * 3.0f;
+        m_encoder->weights[1] = 0.587f * 3.0f;
+        m_encoder->weights[2] = 0.114f * 3.0f;
+    }
+
+    // build the tables before the workers race for them
+    SingleTables();
+    PartitionTable();
+
+    GLuint threads = in_createInfo->threads;
+    if ( threads == 0 )
+        threads = std::max<GLuint>( std::thread::hardware_concurrency(), 1 );
+
+    for ( GLuint i = 1; i < threads; i++ )
+        m_encoder->threads.push_back( std::thread( WorkerLoop, m_encoder ) );
+
+    return true;
+}
+
+void gl::BlockEncoder::Destroy( void )
+{
+    if ( m_encoder == nullptr )
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock( m_encoder->lock );
+        m_encoder->quit = true;
+    }
+    m_encoder->wake.notify_all();
+
+    for ( auto& thread : m_encoder->threads )
+        thread.join();
+
+    delete m_encoder;
+    m_encoder = nullptr;
+}
+
+bool gl::BlockEncoder::Encode( const Format in_format, const GLuint in_width, const GLuint in_height, const void* in_pixels, void* in_blocks, const GLsizeiptr in_size, const GLsizeiptr in_stride )
+{
+    const blockKind_t kind = BlockKind( in_format.internalFormat );
+    if ( m_encoder == nullptr || kind == BLOCK_KIND_NONE || in_pixels == nullptr || in_blocks == nullptr || in_width == 0 || in_height == 0 )
+        return false;
+
+    if ( in_size < CompressedSize( in_format, in_width, in_height ) )
+        return false;
+
+    const blockClock_t::time_point start = blockClock_t::now();
+    const GLuint blocksY = ( in_height + 3 ) / 4;
+
+    blockPass_t& pass = m_encoder->pass;
+    pass.kind = kind;
+    pass.source = static_cast<const uint8_t*>( in_pixels );
+    pass.stride = ( in_stride != 0 ) ? in_stride : static_cast<GLsizeiptr>( in_width ) * 4;
+    pass.width = in_width;
+    pass.height = in_height;
+    pass.blocksX = ( in_width + 3 ) / 4;
+    pass.blockBytes = BlockBytes( kind );
+    pass.destine = static_cast<uint8_t*>( in_blocks );
+    ParallelFor( m_encoder, EncodeJob, blocksY );
+
+    m_encoder->stats.images++;
+    m_encoder->stats.blocks += static_cast<uint64_t>( pass.blocksX ) * blocksY;
+    m_encoder->stats.pixels += static_cast<uint64_t>( in_width ) * in_height;
+    m_encoder->stats.microseconds += static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::microseconds>( blockClock_t::now() - start ).count() );
+    return true;
+}
+
+bool gl::BlockEncoder::CompressedSubImage( Texture* in_texture, const Texture::subImage_t* in_subImage, const void* in_pixels )
+{
+    if ( m_encoder == nullptr || in_texture == nullptr || in_subImage == nullptr )
+        return false;
+
+    // the blocks must be aligned to the texture grid
+    const Format format = in_texture->PixelFormat();
+    const GLsizei width = in_subImage->dimension.width;
+    const GLsizei height = in_subImage->dimension.height;
+    if ( width <= 0 || height <= 0 || ( ( in_subImage->offsets.xoffset | in_subImage->offsets.yoffset ) & 3 ) != 0 )
+        return false;
+
+    const GLsizeiptr size = CompressedSize( format, static_cast<GLuint>( width ), static_cast<GLuint>( height ) );
+    m_encoder->scratch.resize( static_cast<size_t>( size ) );
+    if ( !Encode( format, static_cast<GLuint>( width ), static_cast<GLuint>( height ), in_pixels, m_encoder->scratch.data(), size ) )
+        return false;
+
+    Texture::subImage_t subImage = *in_subImage;
+    subImage.imageSize = static_cast<GLsizei>( size );
+    subImage.dimension.depth = std::max( subImage.dimension.depth, 1 );
+    in_texture->CompressedSubImage( &subImage, m_encoder->scratch.data() );
+    return true;
+}
+
+bool gl::BlockEncoder::Upload( Texture* in_texture, const MipGenerator* in_generator, const GLsizei in_layer )
+{
+    if ( m_encoder == nullptr || in_texture == nullptr || in_generator == nullptr )
+        return false;
+
+    const GLuint levels = std::min<GLuint>( in_generator->Levels(), static_cast<GLuint>( in_texture->Levels() ) );
+    for ( GLuint i = 0; i < levels; i++ )
+    {
+        const mipLevel_t level = in_generator->Level( i );
+        if ( level.size != static_cast<GLsizeiptr>( level.width ) * level.height * 4 )
+            return false;
+
+        Texture::subImage_t subImage;
+        subImage.level = static_cast<GLint>( i );
+        subImage.layer = in_layer;
+        subImage.dimension.width = static_cast<GLsizei>( level.width );
+        subImage.dimension.height = static_cast<GLsizei>( level.height );
+        subImage.dimension.depth = 1;
+        if ( !CompressedSubImage( in_texture, &subImage, level.pixels ) )
+            return false;
+    }
+
+    return levels > 0;
+}
+
+bool gl::BlockEncoder::Benchmark( const Format in_format, const GLuint in_width, const GLuint in_height, const void* in_pixels, blockBenchmark_t* in_result )
+{
+    const blockKind_t kind = BlockKind( in_format.internalFormat );
+    if ( in_result == nullptr || kind == BLOCK_KIND_NONE || in_width == 0 || in_height == 0 )
+        return false;
+
+    const GLsizeiptr size = CompressedSize( in_format, in_width, in_height );
+    const size_t pixels = static_cast<size_t>( in_width ) * in_height;
+    std::vector<uint8_t> blocks( static_cast<size_t>( size ) );
+    std::vector<uint8_t> decoded( pixels * 4 );
+
+    const blockClock_t::time_point start = blockClock_t::now();
+    if ( !Encode( in_format, in_width, in_height, in_pixels, blocks.data(), size ) )
+        return false;
+
+    const double seconds = std::chrono::duration<double>( blockClock_t::now() - start ).count();
+    Decode( in_format, in_width, in_height, blocks.data(), decoded.data() );
+
+    // only the channels the format store
+    GLuint channels = 4;
+    if ( kind == BLOCK_KIND_BC1 )
+        channels = 3;
+    else if ( kind == BLOCK_KIND_BC4 )
+        channels = 1;
+    else if ( kind == BLOCK_KIND_BC5 )
+        channels = 2;
+
+    const uint8_t* source = static_cast<const uint8_t*>( in_pixels );
+    double sum = 0.0;
+    for ( size_t i = 0; i < pixels; i++ )
+    {
+        for ( GLuint c = 0; c < channels; c++ )
+        {
+            const double delta = static_cast<double>( source[i * 4 + c] ) - static_cast<double>( decoded[i * 4 + c] );
+            sum += delta * delta;
+        }
+    }
+
+    const double mse = sum / ( static_cast<double>( pixels ) * channels );
+    in_result->seconds = seconds;
+    in_result->megapixels = static_cast<double>( pixels ) / 1000000.0 / std::max( seconds, 1e-9 );
+    in_result->bitsPerPixel = static_cast<double>( size ) * 8.0 / static_cast<double>( pixels );
+    in_result->rmse = std::sqrt( mse );
+    in_result->psnr = ( mse > 0.0 ) ? 10.0 * std::log10( 255.0 * 255.0 / mse ) : std::numeric_limits<double>::infinity();
+    return true;
+}
+
+gl::blockEncoderStats_t gl::BlockEncoder::Stats( void ) const
+{
+    return ( m_encoder != nullptr ) ? m_encoder->stats : blockEncoderStats_t();
+}
+
+bool gl::BlockEncoder::Supported( const Format in_format )
+{
+    return BlockKind( in_format.internalFormat ) != BLOCK_KIND_NONE;
+}
+
+GLsizeiptr gl::BlockEncoder::CompressedSize( const Format in_format, const GLuint in_width, const GLuint in_height )
+{
+    const blockKind_t kind = BlockKind( in_format.internalFormat );
+    if ( kind == BLOCK_KIND_NONE )
+        return 0;
+
+    return static_cast<GLsizeiptr>( ( in_width + 3 ) / 4 ) * static_cast<GLsizeiptr>( ( in_height + 3 ) / 4 ) * BlockBytes( kind );
+}
+
+bool gl::BlockEncoder::Decode( const Format in_format, const GLuint in_width, const GLuint in_height, const void* in_blocks, void* in_pixels )
+{
+    const blockKind_t kind = BlockKind( in_format.internalFormat );
+    if ( kind == BLOCK_KIND_NONE || in_blocks == nullptr || in_pixels == nullptr )
+        return false;
+
+    const GLuint blocksX = ( in_width + 3 ) / 4;
+    const GLuint blocksY = ( in_height + 3 ) / 4;
+    const GLuint blockBytes = BlockBytes( kind );
+    const uint8_t* source = static_cast<const uint8_t*>( in_blocks );
+    uint8_t* destine = static_cast<uint8_t*>( in_pixels );
+    for ( GLuint blockY = 0; blockY < blocksY; blockY++ )
+    {
+        for ( GLuint blockX = 0; blockX < blocksX; blockX++ )
+        {
+            uint8_t block[16][4];
+            DecodeBlock( kind, source + ( static_cast<size_t>( blockY ) * blocksX + blockX ) * blockBytes, block );
+
+            for ( GLuint y = 0; y < 4 && blockY * 4 + y < in_height; y++ )
+            {
+                const GLuint columns = std::min<GLuint>( 4, in_width - blockX * 4 );
+                std::memcpy( destine + ( ( static_cast<size_t>( blockY ) * 4 + y ) * in_width + blockX * 4 ) * 4, block[y * 4], columns * 4 );
+            }
+        }
+    }
+
+    return true;
+}
@@ -25,8 +25,10 @@
 
 typedef struct glCoreBuffer_t 
 {
-    GLenum  target = 0;
-    GLuint  buffer = 0;
+    GLenum      target = 0;
+    GLuint      buffer = 0;
+    GLsizeiptr  size = 0;
+    gl::memoryOwner_t   memory;
 } glCoreBuffer_t;
 
 gl::Buffer::Buffer( void ) : m_bufferHandler( nullptr )
@@ -56,6 +58,10 @@ void gl::Buffer::Create( const GLuint in_target, const GLsizeiptr in_size, const
     // create the buffer object
     glCreateBuffers( 1, &m_bufferHandler->buffer );
     glNamedBufferStorage( m_bufferHandler->buffer, in_size, in_data, in_flags );
+    m_bufferHandler->size = in_size;
+
+    if ( Context* context = Context::Current() )
+        m_bufferHandler->memory = context->Memory().Track( MEMORY_BUFFER, m_bufferHandler->buffer, static_cast<uint64_t>( in_size ), false );
 }
 
 void gl::Buffer::Destroy( void )
@@ -65,6 +71,9 @@ void gl::Buffer::Destroy( void )
 
     if( m_bufferHandler->buffer != 0 )
     {
+        // the tracker of the creation context, even if another one is current now
+        MemoryTracker::Untrack( m_bufferHandler->memory, MEMORY_BUFFER, m_bufferHandler->buffer );
+
         glDeleteBuffers( 1, &m_bufferHandler->buffer );
         m_bufferHandler->buffer = 0;
     }
@@ -79,6 +88,9 @@ void gl::Buffer::Upload(const void *in_data, const GLintptr in_offset, const GLs
         throw std::runtime_error( "invalid handle!" );
 
     glNamedBufferSubData( m_bufferHandler->buffer, in_offset, in_size, in_data );
+
+    if ( Context* context = Context::Current() )
+        context->RecordBufferUpload( static_cast<uint64_t>( in_size ) );
 }
 
 void gl::Buffer::Download( void* &in_data, const GLintptr in_offset, const GLsizeiptr in_size )
@@ -22,6 +22,10 @@
 #include "crglPrecompiled.hpp"
 #include "crglContext.hpp"
 
+#include <chrono>
+#include <mutex>
+#include <new>
+
 #if 0
 #if defined( _WIN32 )
 #   include <wingdi.h>
@@ -35,14 +39,32 @@ extern __GLXextFuncPtr glXGetProcAddressARB (const GLubyte *);
 static const char k_INVALID_VERTEX_ARRAY_MSG[76] = "crglContext::BindVertexArray not recived a valid vertex array name as input";
 static const char k_INVALID_FRAME_BUFFER_MSG[75] = "crglContext::BindFrameBuffer not recived a valid FrameBuffer name as input";
 static const char k_INVALID_BLEND_DRAW_BUFFER_INDEX[58] = "crglContext::SetBlendState draw buffer index out of range";
+static const char k_INVALID_COLOR_MASK_DRAW_BUFFER_INDEX[57] = "crglContext::SetColorMask draw buffer index out of range";
+
+// context current on this thread
+static thread_local gl::Context* s_currentContext = nullptr;
 
-gl::Context::Context( void )
+// shared by a context and the ones sharing objects whit it, notified from any of their threads
+typedef struct glCoreResourceListeners_t
+{
+    std::mutex              lock;       // held while notifying, so a removed listener is never called
+    gl::ResourceListener*   listeners[gl::k_MAX_RESOURCE_LISTENERS] = {};
+    GLuint                  count = 0;
+} glCoreResourceListeners_t;
+
+gl::Context::Context( void ) : m_memoryTracker( &m_memory ), m_listeners( new glCoreResourceListeners_t() ), m_resourceListeners( m_listeners ), m_stateArrays( nullptr )
 {
 }
 
 gl::Context::~Context( void )
 {
+    if ( s_currentContext == this )
+        SetCurrent( nullptr );
+
     Destroy();
+
+    delete m_listeners;
+    m_listeners = nullptr;
 }
 
 void gl::Context::Destroy(void)
@@ -66,81 +88,191 @@ void* gl::Context::GetFunctionPointer( const char* in_name ) const
 }
 #endif
 
-bool gl::Context::Init( void )
+bool gl::Context::Init( const debugConfig_t* in_debug )
 {
+    using clock = std::chrono::steady_clock;
+    clock::time_point start = clock::now();
+    clock::time_point loaded, parsed;
+
+    // Init is called whit the context current
+    SetCurrent( this );
+
+    m_startupStats = startupStats_t();
+
     LoadFunctions();
+    loaded = clock::now();
 
-    // enable debug
-    glEnable( GL_DEBUG_OUTPUT);
-    // To lock on error (synchronized debug)
-    glEnable( GL_DEBUG_OUTPUT_SYNCHRONOUS ); 
+    LoadExtensions();
+    parsed = clock::now();
 
-    glDebugMessageCallback( DebugOutputCall, this ); // set callback
-    glDebugMessageControl( GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, GL_TRUE ); // Ativa tudo
+    if ( in_debug != nullptr )
+        m_debugConfig = *in_debug;
+    else
+        m_debugConfig = debugConfig_t();
+
+    InitDebugOutput();
 
     // Get context properties
+    const struct { GLenum name; GLint* value; } limits[] = 
+    {
+        // max texture units
+        { GL_MAX_TEXTURE_IMAGE_UNITS, &m_features.maxTextures },
+        { GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &m_features.maxCombined },
+        // max frame buffer attachaments
+        { GL_MAX_COLOR_ATTACHMENTS, &m_features.maxColorAttachments },
+        // max buffer bindings 
+        { GL_MAX_UNIFORM_BUFFER_BINDINGS, &m_features.maxUBOBindings },
+        { GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, &m_features.maxSSBOBindings },
+        { GL_MAX_ATOMIC_COUNTER_BUFFER_BINDINGS, &m_features.maxAtomicBindings },
+        { GL_MAX_TRANSFORM_FEEDBACK_BUFFERS, &m_features.maxTFBindings },
+        { GL_MAX_VERTEX_ATTRIB_BINDINGS, &m_features.maxVBOBindings },
+        // GL_ARB_viewport_array, max viewport/scizzor binding
+        { GL_MAX_VIEWPORTS, &m_features.maxViewports },
+        { GL_MAX_VERTEX_ATTRIBS, &m_features.maxVertexAttribs },
+        // GL_ARB_draw_buffers_blend
+        { GL_MAX_DRAW_BUFFERS, &m_features.maxDrawBuffers }
+    };
+
+    for ( const auto& limit : limits )
+        glGetIntegerv( limit.name, limit.value );
+
+    AllocateStateArrays();
+
+    clock::time_point end = clock::now();
+    m_startupStats.loadTime = static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( loaded - start ).count() );
+    m_startupStats.extensionTime = static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( parsed - loaded ).count() );
+    m_startupStats.queryTime = static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( end - parsed ).count() );
+    m_startupStats.totalTime = static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( end - start ).count() );
+    m_startupStats.functionsMissing = m_missingFunctions.Count();
 
-    // max texture units
-    glGetIntegerv( GL_MAX_TEXTURE_IMAGE_UNITS, &m_features.maxTextures );
-    glGetIntegerv( GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &m_features.maxCombined );
+    return true;
+}
 
-    // max frame buffer attachaments
-    glGetIntegerv( GL_MAX_COLOR_ATTACHMENTS, &m_features.maxColorAttachments );
+bool gl::Context::InitShared( const Context* in_parent )
+{
+    if ( in_parent == nullptr )
+        return false;
 
-    // max buffer bindings 
-    glGetIntegerv(GL_MAX_UNIFORM_BUFFER_BINDINGS, &m_features.maxUBOBindings );
-    glGetIntegerv(GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, &m_features.maxSSBOBindings );
-    glGetIntegerv(GL_MAX_ATOMIC_COUNTER_BUFFER_BINDINGS, &m_features.maxAtomicBindings );
-    glGetIntegerv(GL_MAX_TRANSFORM_FEEDBACK_BUFFERS, &m_features.maxTFBindings );
+    // Init is called whit the context current
+    SetCurrent( this );
 
-    glGetIntegerv(GL_MAX_VERTEX_ATTRIB_BINDINGS, &m_features.maxVBOBindings );
-    
-    // GL_ARB_viewport_array
-    // max viewport/scizzor binding
-    glGetIntegerv( GL_MAX_VIEWPORTS, &m_features.maxViewports );
+    // same driver, reuse the parent entry points and limits
+    m_dispatch = in_parent->m_dispatch;
+    m_extensions = in_parent->m_extensions;
+    m_missingFunctions = in_parent->m_missingFunctions;
+    m_features = in_parent->m_features;
+    m_startupStats = startupStats_t();
+    m_startupStats.functionsMissing = in_parent->m_startupStats.functionsMissing;
+    m_startupStats.extensions = in_parent->m_startupStats.extensions;
 
-    //
-    glGetIntegerv( GL_MAX_VERTEX_ATTRIBS, &m_features.maxVertexAttribs );
-    
-    // GL_ARB_draw_buffers_blend
-    glGetIntegerv( GL_MAX_DRAW_BUFFERS, &m_features.maxDrawBuffers );
+    // the shared objects are accounted on the parent
+    m_memoryTracker = in_parent->m_memoryTracker;
+    m_resourceListeners = in_parent->m_resourceListeners;
 
-    // create the binding array
-    m_state.textures.samplers = static_cast<GLuint*>( std::malloc( sizeof( GLuint ) * m_features.maxCombined ) );
-    m_state.textures.textures = static_cast<GLuint*>( std::malloc( sizeof( GLuint ) * m_features.maxCombined ) );
-    
-    // create the shader buffers binding arrays
-    m_state.programs.uniformBuffers = static_cast<GLuint*>( std::malloc( sizeof( GLuint ) * m_features.maxUBOBindings ) );
-    m_state.programs.shaderStorageBuffers = static_cast<GLuint*>( std::malloc( sizeof( GLuint ) * m_features.maxUBOBindings ) );
+    // no extra logger thread for each shared context, report inline
+    m_debugConfig = in_parent->m_debugConfig;
+    if ( m_debugConfig.mode == DEBUG_ASYNC )
+        m_debugConfig.mode = DEBUG_SYNCHRONOUS;
 
-    // max render buffers
-    m_state.drawBuffers = static_cast<drawbuffer_t*>( std::malloc( sizeof(drawbuffer_t) * m_features.maxDrawBuffers ) );
+    InitDebugOutput();
+    AllocateStateArrays();
+
+    return true;
+}
+
+void gl::Context::AllocateStateArrays( void )
+{
+    size_t size = 0;
+
+    // carve all the binding arrays from a single allocation
+    auto reserve = [&size]( const size_t in_count, const size_t in_size, const size_t in_align ) 
+    {
+        size = ( size + in_align - 1 ) & ~( in_align - 1 );
+        size_t arrayOffset = size;
+        size += in_count * in_size;
+        return arrayOffset;
+    };
+
+    size_t viewports = reserve( m_features.maxViewports, sizeof( viewport_t ), alignof( viewport_t ) );
+    size_t drawBuffers = reserve( m_features.maxDrawBuffers, sizeof( drawbuffer_t ), alignof( drawbuffer_t ) );
+    size_t samplers = reserve( m_features.maxCombined, sizeof( GLuint ), alignof( GLuint ) );
+    size_t textures = reserve( m_features.maxCombined, sizeof( GLuint ), alignof( GLuint ) );
+    size_t uniformBuffers = reserve( m_features.maxUBOBindings, sizeof( GLuint ), alignof( GLuint ) );
+    size_t storageBuffers = reserve( m_features.maxSSBOBindings, sizeof( GLuint ), alignof( GLuint ) );
+
+    std::free( m_stateArrays );
+    m_stateArrays = std::calloc( 1, std::max<size_t>( size, 1 ) );
+    uint8_t* base = static_cast<uint8_t*>( m_stateArrays );
 
     // create the viewport array
-    m_state.viewports = static_cast<viewport_t*>( std::malloc( sizeof( viewport_t ) * m_features.maxViewports ) );
+    m_state.viewports = reinterpret_cast<viewport_t*>( base + viewports );
+    for ( GLint i = 0; i < m_features.maxViewports; i++ )
+        new ( &m_state.viewports[i] ) viewport_t();
 
-    return true;
+    // max render buffers
+    m_state.drawBuffers = reinterpret_cast<drawbuffer_t*>( base + drawBuffers );
+    for ( GLint i = 0; i < m_features.maxDrawBuffers; i++ )
+        new ( &m_state.drawBuffers[i] ) drawbuffer_t();
+
+    // create the binding array
+    m_state.textures.samplers = reinterpret_cast<GLuint*>( base + samplers );
+    m_state.textures.textures = reinterpret_cast<GLuint*>( base + textures );
+    
+    // create the shader buffers binding arrays
+    m_state.programs.uniformBuffers = reinterpret_cast<GLuint*>( base + uniformBuffers );
+    m_state.programs.shaderStorageBuffers = reinterpret_cast<GLuint*>( base + storageBuffers );
 }
 
 void gl::Context::Finalize( void )
 {   
-    std::free( m_state.viewports );
-    m_state.viewports = nullptr;
+    // flush pending debug messages
+    m_debugLogger.Stop();
 
-    std::free( m_state.drawBuffers );
+    // the binding arrays live in m_stateArrays
+    m_state.viewports = nullptr;
     m_state.drawBuffers = nullptr;
-
-    std::free( m_state.programs.uniformBuffers );
     m_state.programs.uniformBuffers = nullptr;
-    
-    std::free( m_state.programs.shaderStorageBuffers );
     m_state.programs.shaderStorageBuffers = nullptr;
-
-    std::free( m_state.textures.samplers );
     m_state.textures.samplers = nullptr;
-    
-    std::free( m_state.textures.textures );
     m_state.textures.textures = nullptr;   
+
+    std::free( m_stateArrays );
+    m_stateArrays = nullptr;
+}
+
+void gl::Context::InitDebugOutput( void )
+{
+    const GLenum severities[4] = { GL_DEBUG_SEVERITY_NOTIFICATION, GL_DEBUG_SEVERITY_LOW, GL_DEBUG_SEVERITY_MEDIUM, GL_DEBUG_SEVERITY_HIGH };
+
+    m_debugLogger.Stop();
+
+    if ( m_debugConfig.mode == DEBUG_OFF )
+    {
+        glDebugMessageCallback( nullptr, nullptr );
+        glDisable( GL_DEBUG_OUTPUT );
+        return;
+    }
+
+    // the logger thread must be running before the driver can call us
+    if ( m_debugConfig.mode == DEBUG_ASYNC && !m_debugLogger.Start( this, &m_debugConfig ) )
+        m_debugConfig.mode = DEBUG_SYNCHRONOUS;
+
+    glEnable( GL_DEBUG_OUTPUT );
+
+    // To lock on error (synchronized debug), only when asked, this serialize the driver
+    if ( m_debugConfig.mode == DEBUG_SYNCHRONOUS )
+        glEnable( GL_DEBUG_OUTPUT_SYNCHRONOUS );
+    else
+        glDisable( GL_DEBUG_OUTPUT_SYNCHRONOUS );
+
+    glDebugMessageCallback( DebugOutputCall, this ); // set callback
+
+    // let the driver filter the severities we don't want, so it don't even generate it
+    for ( GLuint i = 0; i < 4; i++ )
+    {
+        GLboolean enabled = DebugLogger::Accept( severities[i], m_debugConfig.minSeverity ) ? GL_TRUE : GL_FALSE;
+        glDebugMessageControl( GL_DONT_CARE, GL_DONT_CARE, severities[i], 0, nullptr, enabled );
+    }
 }
 
 void gl::Context::Clear( void )
@@ -184,13 +316,16 @@ gl::faceCull_t gl::Context::SetFaceCulling(const faceCull_t &in_cullState)
 {
     faceCull_t current = m_state.cullingState;
 
-    if ( current.enable != in_cullState.enable )
+    if ( CountState( current.enable != in_cullState.enable ) )
     {
         if ( in_cullState.enable )
             glEnable( CULL_FACE );
         else
             glDisable( CULL_FACE );
     }
+
+    if ( CountState( current.face != in_cullState.face ) )
+        glCullFace( in_cullState.face );
     
     /// update culling state 
     m_state.cullingState = in_cullState;
@@ -200,7 +335,7 @@ gl::faceCull_t gl::Context::SetFaceCulling(const faceCull_t &in_cullState)
 gl::blendingState_t gl::Context::SetBlendState( const GLuint in_drawBuffer, const blendingState_t in_state )
 {
 #if !defined( NDEBUG ) // we don't check on releases  
-    if ( in_drawBuffer >= m_features.maxDrawBuffers )
+    if ( in_drawBuffer >= static_cast<GLuint>( m_features.maxDrawBuffers ) )
     {
         glDebugMessageInsert( GL_DEBUG_SOURCE_THIRD_PARTY, GL_DEBUG_TYPE_ERROR, 0, GL_DEBUG_SEVERITY_HIGH, 58, k_INVALID_BLEND_DRAW_BUFFER_INDEX );
         return {};
@@ -208,7 +343,7 @@ gl::blendingState_t gl::Context::SetBlendState( const GLuint in_drawBuffer, cons
 #endif // !NDEBUG
     
     blendingState_t current = m_state.drawBuffers[in_drawBuffer].blending;
-    if ( current.blend != in_state.blend )
+    if ( CountState( current.blend != in_state.blend ) )
     {
         if ( in_state.blend )
             glEnablei( BLEND, in_drawBuffer );
@@ -217,11 +352,11 @@ gl::blendingState_t gl::Context::SetBlendState( const GLuint in_drawBuffer, cons
     }
 
     // update function
-    if ( current.function != in_state.function )
+    if ( CountState( current.function != in_state.function ) )
         glBlendFuncSeparatei( in_drawBuffer, in_state.function.srcRGB, in_state.function.dstRGB, in_state.function.srcAlpha, in_state.function.dstAlpha );
 
     // update equation
-    if ( current.equation != in_state.equation )
+    if ( CountState( current.equation != in_state.equation ) )
         glBlendEquationSeparatei( in_drawBuffer, in_state.equation.modeRGB, in_state.equation.modeAlpha );
 
     // update blending state
@@ -229,11 +364,31 @@ gl::blendingState_t gl::Context::SetBlendState( const GLuint in_drawBuffer, cons
     return current;
 }
 
+gl::colorMask_t gl::Context::SetColorMask( const GLuint in_drawBuffer, const colorMask_t in_mask )
+{
+#if !defined( NDEBUG ) // we don't check on releases  
+    if ( in_drawBuffer >= static_cast<GLuint>( m_features.maxDrawBuffers ) )
+    {
+        glDebugMessageInsert( GL_DEBUG_SOURCE_THIRD_PARTY, GL_DEBUG_TYPE_ERROR, 0, GL_DEBUG_SEVERITY_HIGH, 57, k_INVALID_COLOR_MASK_DRAW_BUFFER_INDEX );
+        return {};
+    }
+#endif // !NDEBUG
+
+    colorMask_t current = m_state.drawBuffers[in_drawBuffer].colorMask;
+    if ( CountState( current != in_mask ) )
+    {
+        glColorMaski( in_drawBuffer, in_mask.red, in_mask.green, in_mask.blue, in_mask.alpha );
+        m_state.drawBuffers[in_drawBuffer].colorMask = in_mask;
+    }
+
+    return current;
+}
+
 gl::stencilState_t gl::Context::SetStencilState(const stencilState_t in_state)
 {
     stencilState_t current = m_state.stencilState;
 
-    if ( current.testing != in_state.testing )
+    if ( CountState( current.testing != in_state.testing ) )
     {
         if ( in_state.testing == GL_TRUE )
             glEnable( STENCIL_TEST );
@@ -242,34 +397,34 @@ gl::stencilState_t gl::Context::SetStencilState(const stencilState_t in_state)
     }
     
     // stencil clear value
-    if ( current.clear != in_state.clear )
+    if ( CountState( current.clear != in_state.clear ) )
         glClearStencil( in_state.clear );
 
     // front face mask
-    if ( current.maskFront != in_state.maskFront )
+    if ( CountState( current.maskFront != in_state.maskFront ) )
         glStencilMaskSeparate( FRONT, in_state.maskFront );
     
     // back face mask
-    if ( current.maskBack != in_state.maskBack )
+    if ( CountState( current.maskBack != in_state.maskBack ) )
         glStencilMaskSeparate( BACK, in_state.maskBack );
     
     // front face state
-    if ( current.funcFront != in_state.funcFront )
+    if ( CountState( current.funcFront != in_state.funcFront ) )
         glStencilFuncSeparate( FRONT, in_state.funcFront.func, in_state.funcFront.ref, in_state.funcFront.mask );
     
     // back face state
-    if ( current.funcBack != in_state.funcBack )
+    if ( CountState( current.funcBack != in_state.funcBack ) )
         glStencilFuncSeparate( BACK, in_state.funcBack.func, in_state.funcBack.ref, in_state.funcBack.mask );
 
     // front face operation
-    if ( current.opFront != in_state.opFront )
+    if ( CountState( current.opFront != in_state.opFront ) )
         glStencilOpSeparate( FRONT, in_state.opFront.sfail, in_state.opFront.dpfail, in_state.opFront.dppass );
 
     // back face operation
-    if ( current.opFront != in_state.opFront )
-        glStencilOpSeparate( BACK, in_state.opFront.sfail, in_state.opFront.dpfail, in_state.opFront.dppass );
+    if ( CountState( current.opBack != in_state.opBack ) )
+        glStencilOpSeparate( BACK, in_state.opBack.sfail, in_state.opBack.dpfail, in_state.opBack.dppass );
 
-    current = in_state;
+    m_state.stencilState = in_state;
     return current;
 }
 
@@ -277,7 +432,7 @@ gl::depthState_t gl::Context::SetDepthState( const depthState_t in_state )
 {
     depthState_t current = m_state.depthState;
 
-    if ( current.testing != in_state.testing )
+    if ( CountState( current.testing != in_state.testing ) )
     {
         if ( in_state.testing )
             glEnable( DEPTH_TEST  );
@@ -285,7 +440,7 @@ gl::depthState_t gl::Context::SetDepthState( const depthState_t in_state )
             glDisable( DEPTH_TEST );        
     }
 
-    if ( current.clamp != in_state.clamp )
+    if ( CountState( current.clamp != in_state.clamp ) )
     {
         if ( in_state.clamp )
             glEnable( DEPTH_CLAMP  );
@@ -294,17 +449,17 @@ gl::depthState_t gl::Context::SetDepthState( const depthState_t in_state )
     }
 
     // update clear alpha color
-    if ( current.clear != in_state.clear )
+    if ( CountState( current.clear != in_state.clear ) )
         glClearDepth( in_state.clear );
     
-    if ( current.mask != in_state.mask )
+    if ( CountState( current.mask != in_state.mask ) )
         glDepthMask( in_state.mask );
     
-    if ( current.func != in_state.func )
+    if ( CountState( current.func != in_state.func ) )
         glDepthFunc( in_state.func );
     
     // TODO: move to poligon properties
-    if ( current.factor != in_state.factor && current.units != in_state.units )
+    if ( CountState( current.factor != in_state.factor || current.units != in_state.units ) )
         glPolygonOffset( in_state.factor, in_state.units );
 
     m_state.depthState = in_state;
@@ -313,38 +468,62 @@ gl::depthState_t gl::Context::SetDepthState( const depthState_t in_state )
 
 gl::viewport_t gl::Context::SetViewportState(const GLuint in_viewport, const viewport_t in_state )
 {
-    viewport_t current = m_state.viewports[in_viewport]; 
-
     if ( in_viewport >= static_cast<GLuint>( m_features.maxViewports ) )
     {
         // todo append a error
         return {};
     }
     
-    if (    current.left != in_state.left || 
-            current.bottom != in_state.bottom || 
-            current.width != in_state.width ||
-            current.height != in_state.height )
+    viewport_t current = m_state.viewports[in_viewport]; 
+
+    if ( CountState(    current.left != in_state.left || 
+                        current.bottom != in_state.bottom || 
+                        current.width != in_state.width ||
+                        current.height != in_state.height ) )
 
         glViewportIndexedf( in_viewport, in_state.left, in_state.bottom, in_state.width, in_state.height );
     
     // update depth range
-    if ( current.near != in_state.near && current.far != in_state.far )
+    if ( CountState( current.near != in_state.near || current.far != in_state.far ) )
         glDepthRangeIndexed( in_viewport, in_state.near, in_state.far );
     
     m_state.viewports[in_viewport] = in_state;
     return current;
 }
 
+gl::scissorState_t gl::Context::SetScissorState( const scissorState_t in_state )
+{
+    scissorState_t current = m_state.scissorState;
+
+    if ( CountState( current.testing != in_state.testing ) )
+    {
+        if ( in_state.testing )
+            glEnable( SCISSOR_TEST );
+        else
+            glDisable( SCISSOR_TEST );
+    }
+
+    if ( CountState(    current.x != in_state.x || 
+                        current.y != in_state.y || 
+                        current.width != in_state.width || 
+                        current.height != in_state.height ) )
+        glScissor( in_state.x, in_state.y, in_state.width, in_state.height );
+
+    m_state.scissorState = in_state;
+    return current;
+}
+
 GLboolean gl::Context::Multisample(const GLboolean in_enable)
 {
     GLboolean current = m_state.multisampling;
-    if ( in_enable != current )
+    if ( CountState( in_enable != current ) )
      {
         if ( in_enable == GL_TRUE )
             glEnable( GL_MULTISAMPLE );
         else
             glDisable( GL_MULTISAMPLE );    
+
+        m_state.multisampling = static_cast<boolean>( in_enable );
     }
 
     return current;
@@ -353,12 +532,14 @@ GLboolean gl::Context::Multisample(const GLboolean in_enable)
 GLboolean gl::Context::DiscardRaster(const GLboolean in_enable)
 {
     GLboolean current = m_state.discardRaster; 
-    if ( in_enable != current )
+    if ( CountState( in_enable != current ) )
     {
         if ( in_enable == GL_TRUE )
             glEnable( GL_RASTERIZER_DISCARD );
         else
             glDisable( GL_RASTERIZER_DISCARD );    
+
+        m_state.discardRaster = static_cast<boolean>( in_enable );
     }
 
     return current;
@@ -373,13 +554,15 @@ GLuint gl::Context::BindProgram(const GLuint in_program)
     {
         glBindProgramPipeline( 0 );
         m_state.programs.pipeline = 0;
+        m_stats.stateChanges++;
     }
 
-    if ( current != in_program )
+    if ( CountState( current != in_program ) )
     {
         // bind the program 
         glUseProgram( in_program );
         m_state.programs.program = in_program;
+        m_stats.programBinds++;
     }
     
     return current;
@@ -387,20 +570,22 @@ GLuint gl::Context::BindProgram(const GLuint in_program)
 
 GLuint gl::Context::BindPipeline(const GLuint in_pipeline)
 {
-    GLuint current = m_state.programs.program;
+    GLuint current = m_state.programs.pipeline;
 
     // disble program 
     if ( m_state.programs.program != 0 )
     {
         glUseProgram( 0 );
         m_state.programs.program = 0;
+        m_stats.stateChanges++;
     }
 
-    if ( current != in_pipeline )
+    if ( CountState( current != in_pipeline ) )
     {
         // bind the program 
         glBindProgramPipeline( in_pipeline );
         m_state.programs.pipeline = in_pipeline;
+        m_stats.programBinds++;
     }
 
     return current;
@@ -419,7 +604,7 @@ GLuint gl::Context::BindVertexArray( const GLuint in_vertexArray )
     }
 #endif // !NDEBUG
 
-    if ( current != in_vertexArray )
+    if ( CountState( current != in_vertexArray ) )
     {
         glBindVertexArray( in_vertexArray );
         m_state.vertexArray = in_vertexArray;
@@ -441,7 +626,7 @@ GLuint gl::Context::BindFrameBuffer(const GLuint in_framebuffer)
     }
 #endif // !NDEBUG
 
-    if ( current != in_framebuffer )
+    if ( CountState( current != in_framebuffer ) )
     {
         glBindFramebuffer( GL_FRAMEBUFFER, in_framebuffer );
         m_state.frameBuffer = in_framebuffer;
@@ -453,7 +638,7 @@ GLuint gl::Context::BindFrameBuffer(const GLuint in_framebuffer)
 GLuint gl::Context::BindIndirectBuffer( const GLuint in_buffer )
 {
     GLuint current = m_state.indirectDrawBuffer;
-    if ( current != in_buffer )
+    if ( CountState( current != in_buffer ) )
     {
         glBindBuffer( GL_DRAW_INDIRECT_BUFFER, in_buffer );
         m_state.indirectDrawBuffer = in_buffer;
@@ -469,6 +654,7 @@ GLuint gl::Context::BindUniformBuffers(const GLuint *in_buffers, const GLintptr
     // todo clamp to the max suported buffers
     std::memcpy( &m_state.programs.uniformBuffers[in_first], in_buffers, sizeof( GLuint ) * in_count );
     glBindBuffersRange( GL_UNIFORM_BUFFER, in_first, in_count, in_buffers, in_offsets, in_sizes );
+    m_stats.stateChanges++;
     return 0; //TODO: change
 }
 
@@ -477,6 +663,7 @@ GLuint gl::Context::BindShaderStorageBuffers(const GLuint *in_buffers, const GLi
     // todo clamp to the max suported buffers
     std::memcpy( &m_state.programs.shaderStorageBuffers[in_first], in_buffers, sizeof( GLuint ) * in_count );
     glBindBuffersRange( GL_SHADER_STORAGE_BUFFER, in_first, in_count, in_buffers, in_offsets, in_sizes );
+    m_stats.stateChanges++;
     return 0; //TODO:
 }
 
@@ -488,6 +675,11 @@ GLuint gl::Context::BindTextures(const GLuint *in_textures, const GLuint *in_sam
         return std::numeric_limits<GLuint>::max();
     }
 
+    // skip the driver call if the whole range is already bound
+    if ( !CountState(   std::memcmp( &m_state.textures.textures[in_first], in_textures, sizeof( GLuint ) * in_count ) != 0 ||
+                        std::memcmp( &m_state.textures.samplers[in_first], in_samplers, sizeof( GLuint ) * in_count ) != 0 ) )
+        return GLuint();
+
     std::memcpy( &m_state.textures.textures[in_first], in_textures, sizeof( GLuint ) * in_count );    
     std::memcpy( &m_state.textures.samplers[in_first], in_samplers, sizeof( GLuint ) * in_count );
 
@@ -521,107 +713,119 @@ void gl::Context::BlitToCurrentFrameBuffer(const GLuint in_source, const rect_t
 
 }
 
-void APIENTRY gl::Context::DebugOutputCall( GLenum in_source, GLenum in_type, GLuint in_id, GLenum in_severity, GLsizei in_length, const GLchar *in_message, const void *in_userParam )
+void gl::Context::DrawArrays( const GLenum in_mode, const GLint in_first, const GLsizei in_count, const GLsizei in_instances, const GLuint in_baseInstance )
 {
-    const char * source = nullptr;
-    const char * type = nullptr;
-    const char * severity = nullptr;
-    char message[512];
-    const Context *ctx = static_cast<const Context*>( in_userParam );
+    if ( in_instances == 1 && in_baseInstance == 0 )
+        glDrawArrays( in_mode, in_first, in_count );
+    else
+        glDrawArraysInstancedBaseInstance( in_mode, in_first, in_count, in_instances, in_baseInstance );
+
+    m_stats.drawCalls++;
+    m_stats.indices += static_cast<uint64_t>( in_count ) * in_instances;
+    m_stats.instances += in_instances;
+}
 
-    switch ( in_source )
-    {
-    case GL_DEBUG_SOURCE_API:
-        source = "Source: API";
-        break;
+void gl::Context::DrawElements( const GLenum in_mode, const GLsizei in_count, const GLenum in_type, const GLintptr in_offset, const GLsizei in_instances, const GLint in_baseVertex, const GLuint in_baseInstance )
+{
+    const void* offset = reinterpret_cast<const void*>( in_offset );
 
-    case GL_DEBUG_SOURCE_WINDOW_SYSTEM:
-        source = "Source: Window System";
-        break;
+    if ( in_instances == 1 && in_baseInstance == 0 )
+        glDrawElementsBaseVertex( in_mode, in_count, in_type, offset, in_baseVertex );
+    else
+        glDrawElementsInstancedBaseVertexBaseInstance( in_mode, in_count, in_type, offset, in_instances, in_baseVertex, in_baseInstance );
 
-    case GL_DEBUG_SOURCE_SHADER_COMPILER:
-        source = "Source Shader Compiler";
-        break;
+    m_stats.drawCalls++;
+    m_stats.indices += static_cast<uint64_t>( in_count ) * in_instances;
+    m_stats.instances += in_instances;
+}
 
-    case GL_DEBUG_SOURCE_THIRD_PARTY:
-        source = "Source Third Party";
-        break;
+void gl::Context::DrawElementsIndirect( const GLenum in_mode, const GLenum in_type, const GLintptr in_offset, const GLsizei in_drawCount, const GLsizei in_stride )
+{
+    glMultiDrawElementsIndirect( in_mode, in_type, reinterpret_cast<const void*>( in_offset ), in_drawCount, in_stride );
+    m_stats.drawCalls += in_drawCount;
+}
 
-    case GL_DEBUG_SOURCE_APPLICATION:
-        source = "Source Application";
-        break;
+gl::frameStats_t gl::Context::EndFrame( void )
+{
+    m_lastFrameStats = m_stats;
 
-    case GL_DEBUG_SOURCE_OTHER:
-        source = "Source Other";
-        break;
-    
-    default:
-        source = "Source Unknow";
-        break;
-    }
+    // start a new frame
+    m_stats = frameStats_t();
+    m_stats.frame = m_lastFrameStats.frame + 1;
+    return m_lastFrameStats;
+}
 
-    switch ( in_type )
-    {
-    case GL_DEBUG_TYPE_ERROR:
-        type = "Type ERROR";
-        break;
+bool gl::Context::AddResourceListener( ResourceListener* in_listener )
+{
+    glCoreResourceListeners_t* listeners = m_resourceListeners;
+    std::lock_guard<std::mutex> lock( listeners->lock );
+    if ( in_listener == nullptr || listeners->count >= k_MAX_RESOURCE_LISTENERS )
+        return false;
 
-    case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR:
-        type = "Type Deprecated Behaviour";
-        break;
+    listeners->listeners[listeners->count++] = in_listener;
+    return true;
+}
 
-    case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:
-        type = "Type Undefined Behaviour";
-        break;
+void gl::Context::RemoveResourceListener( ResourceListener* in_listener )
+{
+    glCoreResourceListeners_t* listeners = m_resourceListeners;
+    std::lock_guard<std::mutex> lock( listeners->lock );
+    for ( GLuint i = 0; i < listeners->count; i++ )
+    {
+        if ( listeners->listeners[i] != in_listener )
+            continue;
 
-    case GL_DEBUG_TYPE_PORTABILITY:
-        type = "Type Portability";
-        break;
+        listeners->listeners[i] = listeners->listeners[--listeners->count];
+        listeners->listeners[listeners->count] = nullptr;
+        return;
+    }
+}
 
-    case GL_DEBUG_TYPE_PERFORMANCE:
-        type = "Type Performance";
-        break;
+void gl::Context::NotifyResourceDestroyed( const memoryResource_t in_resource, const GLuint in_name )
+{
+    // a deleted texture revert its units to 0, the name can be reused by the next glCreateTextures
+    if ( in_resource == MEMORY_TEXTURE && m_state.textures.textures != nullptr )
+    {
+        for ( GLint i = 0; i < m_features.maxCombined; i++ )
+        {
+            if ( m_state.textures.textures[i] == in_name )
+                m_state.textures.textures[i] = 0;
+        }
+    }
 
-    case GL_DEBUG_TYPE_MARKER:
-        type = "Type Marker";
-        break;
+    glCoreResourceListeners_t* listeners = m_resourceListeners;
+    std::lock_guard<std::mutex> lock( listeners->lock );
+    for ( GLuint i = 0; i < listeners->count; i++ )
+        listeners->listeners[i]->ResourceDestroyed( in_resource, in_name );
+}
 
-    case GL_DEBUG_TYPE_PUSH_GROUP:
-        type = "Type Push Group";
-        break;
+gl::Context* gl::Context::Current( void )
+{
+    return s_currentContext;
+}
 
-    case GL_DEBUG_TYPE_POP_GROUP:
-        type = "Type Pop Group";
-        break;
+void gl::Context::SetCurrent( Context* in_context )
+{
+    s_currentContext = in_context;
+    CurrentDispatch() = ( in_context != nullptr ) ? &in_context->m_dispatch : &k_NO_CONTEXT_DISPATCH;
+}
 
-    case GL_DEBUG_TYPE_OTHER:
-        type = "Type Other";
-        break;
+void APIENTRY gl::Context::DebugOutputCall( GLenum in_source, GLenum in_type, GLuint in_id, GLenum in_severity, GLsizei in_length, const GLchar *in_message, const void *in_userParam )
+{
+    char message[512];
+    const Context *ctx = static_cast<const Context*>( in_userParam );
 
-    default:
-        break;
-    }
+    // filter before any work
+    if ( !DebugLogger::Accept( in_severity, ctx->m_debugConfig.minSeverity ) )
+        return;
 
-    switch ( in_severity )
-    {
-    case GL_DEBUG_SEVERITY_HIGH:
-        severity = "High Severity";
-        break;
-    case GL_DEBUG_SEVERITY_MEDIUM:
-        severity = "Medium Severity";
-        break;
-    case GL_DEBUG_SEVERITY_LOW:
-        severity = "Low Severity";
-        break;
-    case GL_DEBUG_SEVERITY_NOTIFICATION:
-        severity = "Low Severity";
-        break;
-    default:
-        severity = "Unknow Severity level";
-        break;
+    // out of the driver thread, the logger will format it
+    if ( ctx->m_debugConfig.mode == DEBUG_ASYNC )
+    {
+        ctx->m_debugLogger.Push( in_source, in_type, in_id, in_severity, in_length, in_message );
+        return;
     }
 
-    std::snprintf( message, 512, " * OpenGL Info: %s %s, from %s :\n * %s\n", type, severity, source, in_message );
-
+    DebugLogger::Format( in_source, in_type, in_id, in_severity, in_message, message, 512 );
     ctx->DebugOuput( message );
 }
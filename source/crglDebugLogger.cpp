@@ -0,0 +1,506 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#include "crglPrecompiled.hpp"
+#include "crglDebugLogger.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+// raw driver text are truncated to this size, formating happen on the logger thread
+static const size_t k_DEBUG_MESSAGE_LENGTH = 256;
+static const size_t k_DEBUG_FORMATED_LENGTH = 512;
+
+typedef std::chrono::steady_clock   debugClock_t;
+
+typedef struct debugMessage_t
+{
+    GLenum  source = GL_NONE;
+    GLenum  type = GL_NONE;
+    GLuint  id = 0;
+    GLenum  severity = GL_NONE;
+    GLchar  text[k_DEBUG_MESSAGE_LENGTH];
+} debugMessage_t;
+
+// bounded multi producer / single consumer ring, the driver can call the debug callback
+// from more than one thread when GL_DEBUG_OUTPUT_SYNCHRONOUS is disabled
+typedef struct debugSlot_t
+{
+    std::atomic<size_t> sequence;
+    debugMessage_t      message;
+} debugSlot_t;
+
+typedef struct debugRepeat_t
+{
+    GLuint                      id = 0;
+    std::string                 text;           // drivers reuse a id for different messages, the text tell them apart
+    uint64_t                    total = 0;      // times the message was received
+    uint64_t                    pending = 0;    // repetitions not yet reported
+    debugClock_t::time_point    lastReport;
+} debugRepeat_t;
+
+typedef struct glCoreDebugLogger_t
+{
+    const gl::Context*                          context = nullptr;
+    debugSlot_t*                                slots = nullptr;
+    size_t                                      mask = 0;
+    std::chrono::milliseconds                   repeatInterval{ 1000 };
+    std::atomic<bool>                           running{ false };
+    std::atomic<GLuint>                         pushing{ 0 };   // Push calls in flight, Stop wait them
+    std::atomic<size_t>                         enqueuePos{ 0 };
+    size_t                                      dequeuePos = 0;
+    std::atomic<uint64_t>                       dropped{ 0 };
+    uint64_t                                    droppedReported = 0;
+    std::unordered_map<uint64_t, debugRepeat_t> repeats;
+    std::thread                                 thread;
+
+    // the logger thread sleep here when the ring is empty, Push wake it only if it is sleeping
+    std::mutex                                  wakeLock;
+    std::condition_variable                     wake;
+    std::atomic<bool>                           sleeping{ false };
+} glCoreDebugLogger_t;
+
+static GLuint SeverityRank( const GLenum in_severity )
+{
+    switch ( in_severity )
+    {
+    case GL_DEBUG_SEVERITY_NOTIFICATION:
+        return 0;
+    case GL_DEBUG_SEVERITY_LOW:
+        return 1;
+    case GL_DEBUG_SEVERITY_MEDIUM:
+        return 2;
+    case GL_DEBUG_SEVERITY_HIGH:
+        return 3;
+    default:
+        return 3; // unknow, never filter it
+    }
+}
+
+static uint64_t MessageKey( const debugMessage_t* in_message )
+{
+    // FNV-1a of source, type, id and text
+    const uint64_t values[3] = { in_message->source, in_message->type, in_message->id };
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for ( uint64_t value : values )
+    {
+        hash ^= value;
+        hash *= 0x100000001B3ull;
+    }
+
+    for ( const GLchar* c = in_message->text; *c != '\0'; c++ )
+    {
+        hash ^= static_cast<uint8_t>( *c );
+        hash *= 0x100000001B3ull;
+    }
+
+    return hash;
+}
+
+static bool HasMessage( const glCoreDebugLogger_t* in_logger )
+{
+    const debugSlot_t* slot = &in_logger->slots[in_logger->dequeuePos & in_logger->mask];
+    return slot->sequence.load( std::memory_order_acquire ) == in_logger->dequeuePos + 1;
+}
+
+static void WakeLogger( glCoreDebugLogger_t* in_logger )
+{
+    // pair whit the fence in LoggerThread, or the logger see the message or we see it sleeping
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    if ( !in_logger->sleeping.load( std::memory_order_relaxed ) )
+        return;
+
+    // taken so the notify can't land between the logger check and its wait
+    {
+        std::lock_guard<std::mutex> lock( in_logger->wakeLock );
+    }
+    in_logger->wake.notify_one();
+}
+
+static bool PopMessage( glCoreDebugLogger_t* in_logger, debugMessage_t* in_message )
+{
+    debugSlot_t* slot = &in_logger->slots[in_logger->dequeuePos & in_logger->mask];
+    size_t sequence = slot->sequence.load( std::memory_order_acquire );
+
+    // producer not finished this slot yet
+    if ( sequence != in_logger->dequeuePos + 1 )
+        return false;
+
+    *in_message = slot->message;
+
+    // release the slot for the next lap
+    slot->sequence.store( in_logger->dequeuePos + in_logger->mask + 1, std::memory_order_release );
+    in_logger->dequeuePos++;
+    return true;
+}
+
+static bool PushMessage( glCoreDebugLogger_t* in_logger, const GLenum in_source, const GLenum in_type, const GLuint in_id, const GLenum in_severity, const GLsizei in_length, const GLchar* in_message )
+{
+    debugSlot_t* slot = nullptr;
+    size_t position = 0;
+    size_t length = 0;
+
+    position = in_logger->enqueuePos.load( std::memory_order_relaxed );
+    for (;;)
+    {
+        slot = &in_logger->slots[position & in_logger->mask];
+        size_t sequence = slot->sequence.load( std::memory_order_acquire );
+        intptr_t diff = static_cast<intptr_t>( sequence ) - static_cast<intptr_t>( position );
+
+        if ( diff == 0 )
+        {
+            // slot is free, try to claim it
+            if ( in_logger->enqueuePos.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) )
+                break;
+        }
+        else if ( diff < 0 )
+        {
+            // consumer is a full lap behind
+            in_logger->dropped.fetch_add( 1, std::memory_order_relaxed );
+            return false;
+        }
+        else
+            position = in_logger->enqueuePos.load( std::memory_order_relaxed );
+    }
+
+    // just copy the raw message, no formating here
+    length = ( in_length < 0 ) ? std::strlen( in_message ) : static_cast<size_t>( in_length );
+    length = std::min( length, k_DEBUG_MESSAGE_LENGTH - 1 );
+
+    slot->message.source = in_source;
+    slot->message.type = in_type;
+    slot->message.id = in_id;
+    slot->message.severity = in_severity;
+    std::memcpy( slot->message.text, in_message, length );
+    slot->message.text[length] = '\0';
+
+    // publish
+    slot->sequence.store( position + 1, std::memory_order_release );
+    return true;
+}
+
+static void ReportRepeat( glCoreDebugLogger_t* in_logger, debugRepeat_t* in_repeat, const debugClock_t::time_point in_now )
+{
+    char message[k_DEBUG_FORMATED_LENGTH];
+
+    std::snprintf( message, k_DEBUG_FORMATED_LENGTH, " * OpenGL Info: message id %u repeated %llu times ( %llu total ): %.128s\n",
+        in_repeat->id,
+        static_cast<unsigned long long>( in_repeat->pending ),
+        static_cast<unsigned long long>( in_repeat->total ),
+        in_repeat->text.c_str() );
+
+    in_logger->context->DebugOuput( message );
+    in_repeat->pending = 0;
+    in_repeat->lastReport = in_now;
+}
+
+static void ProcessMessage( glCoreDebugLogger_t* in_logger, const debugMessage_t* in_message )
+{
+    char message[k_DEBUG_FORMATED_LENGTH];
+    debugClock_t::time_point now = debugClock_t::now();
+    uint64_t key = MessageKey( in_message );
+    debugRepeat_t& repeat = in_logger->repeats[key];
+
+    repeat.total++;
+
+    // first time we see it, report the full message
+    if ( repeat.total == 1 )
+    {
+        repeat.id = in_message->id;
+        repeat.text = in_message->text;
+        gl::DebugLogger::Format( in_message->source, in_message->type, in_message->id, in_message->severity, in_message->text, message, k_DEBUG_FORMATED_LENGTH );
+        in_logger->context->DebugOuput( message );
+        repeat.lastReport = now;
+        return;
+    }
+
+    // just count, the summary is rate limited
+    repeat.pending++;
+    if ( now - repeat.lastReport >= in_logger->repeatInterval )
+        ReportRepeat( in_logger, &repeat, now );
+}
+
+/// @return true if some repetitions are still waiting they interval
+static bool FlushRepeats( glCoreDebugLogger_t* in_logger, const bool in_force )
+{
+    char message[k_DEBUG_FORMATED_LENGTH];
+    debugClock_t::time_point now = debugClock_t::now();
+    uint64_t dropped = in_logger->dropped.load( std::memory_order_relaxed );
+    bool waiting = false;
+
+    for ( auto& repeat : in_logger->repeats )
+    {
+        if ( repeat.second.pending == 0 )
+            continue;
+
+        if ( in_force || ( now - repeat.second.lastReport >= in_logger->repeatInterval ) )
+            ReportRepeat( in_logger, &repeat.second, now );
+        else
+            waiting = true;
+    }
+
+    if ( dropped != in_logger->droppedReported )
+    {
+        std::snprintf( message, k_DEBUG_FORMATED_LENGTH, " * OpenGL Info: %llu debug messages dropped, debug queue is full\n",
+            static_cast<unsigned long long>( dropped - in_logger->droppedReported ) );
+        in_logger->context->DebugOuput( message );
+        in_logger->droppedReported = dropped;
+    }
+
+    return waiting;
+}
+
+static void LoggerThread( glCoreDebugLogger_t* in_logger )
+{
+    debugMessage_t message{};
+    const auto wakeUp = [in_logger]( void ) { return !in_logger->running.load() || HasMessage( in_logger ); };
+
+    while ( in_logger->running.load( std::memory_order_acquire ) )
+    {
+        if ( PopMessage( in_logger, &message ) )
+        {
+            ProcessMessage( in_logger, &message );
+            continue;
+        }
+
+        // ring is empty, report the pending repeats and sleep until a Push, Stop or the next repeat report
+        const bool waiting = FlushRepeats( in_logger, false );
+
+        std::unique_lock<std::mutex> lock( in_logger->wakeLock );
+        in_logger->sleeping.store( true, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        if ( waiting )
+            in_logger->wake.wait_for( lock, std::max( in_logger->repeatInterval, std::chrono::milliseconds( 1 ) ), wakeUp );
+        else
+            in_logger->wake.wait( lock, wakeUp );
+
+        in_logger->sleeping.store( false, std::memory_order_relaxed );
+    }
+
+    // drain what remain
+    while ( PopMessage( in_logger, &message ) )
+        ProcessMessage( in_logger, &message );
+
+    FlushRepeats( in_logger, true );
+}
+
+gl::DebugLogger::DebugLogger( void ) : m_logger( nullptr )
+{
+}
+
+gl::DebugLogger::~DebugLogger( void )
+{
+    Stop();
+    delete m_logger;
+}
+
+bool gl::DebugLogger::Start( const Context* in_context, const debugConfig_t* in_config )
+{
+    size_t capacity = 1;
+
+    Stop();
+
+    if ( in_context == nullptr || in_config == nullptr )
+        return false;
+
+    // power of two capacity, so we can mask the position
+    while ( capacity < std::max<size_t>( in_config->queueSize, 2 ) )
+        capacity <<= 1;
+
+    // the logger is kept until the destructor, a driver thread can still be in Push after a Stop
+    if ( m_logger == nullptr )
+        m_logger = new glCoreDebugLogger_t();
+
+    m_logger->context = in_context;
+    m_logger->repeatInterval = std::chrono::milliseconds( in_config->repeatInterval );
+    m_logger->enqueuePos.store( 0, std::memory_order_relaxed );
+    m_logger->dequeuePos = 0;
+    m_logger->dropped.store( 0, std::memory_order_relaxed );
+    m_logger->droppedReported = 0;
+    m_logger->repeats.clear();
+    m_logger->mask = capacity - 1;
+    m_logger->slots = new debugSlot_t[capacity];
+    for ( size_t i = 0; i < capacity; i++ )
+        m_logger->slots[i].sequence.store( i, std::memory_order_relaxed );
+
+    m_logger->running.store( true, std::memory_order_release );
+    m_logger->thread = std::thread( LoggerThread, m_logger );
+    return true;
+}
+
+void gl::DebugLogger::Stop( void )
+{
+    if ( m_logger == nullptr || !m_logger->running.load() )
+        return;
+
+    // the new Push calls see running false, wait the ones already writing in the ring
+    m_logger->running.store( false );
+    while ( m_logger->pushing.load() != 0 )
+        std::this_thread::yield();
+
+    {
+        std::lock_guard<std::mutex> lock( m_logger->wakeLock );
+    }
+    m_logger->wake.notify_all();
+
+    if ( m_logger->thread.joinable() )
+        m_logger->thread.join();
+
+    delete[] m_logger->slots;
+    m_logger->slots = nullptr;
+}
+
+bool gl::DebugLogger::Push( const GLenum in_source, const GLenum in_type, const GLuint in_id, const GLenum in_severity, const GLsizei in_length, const GLchar* in_message ) const
+{
+    if ( m_logger == nullptr )
+        return false;
+
+    // sequentially consistent whit Stop, or Stop see this push or this push see the logger stopped
+    m_logger->pushing.fetch_add( 1 );
+    bool pushed = m_logger->running.load() && PushMessage( m_logger, in_source, in_type, in_id, in_severity, in_length, in_message );
+    if ( pushed )
+        WakeLogger( m_logger );
+
+    m_logger->pushing.fetch_sub( 1 );
+    return pushed;
+}
+
+uint64_t gl::DebugLogger::Dropped( void ) const
+{
+    if ( m_logger == nullptr )
+        return 0;
+
+    return m_logger->dropped.load( std::memory_order_relaxed );
+}
+
+bool gl::DebugLogger::Accept( const GLenum in_severity, const GLenum in_minSeverity )
+{
+    return SeverityRank( in_severity ) >= SeverityRank( in_minSeverity );
+}
+
+void gl::DebugLogger::Format( const GLenum in_source, const GLenum in_type, const GLuint in_id, const GLenum in_severity, const GLchar* in_message, char* in_buffer, const GLsizei in_size )
+{
+    const char * source = nullptr;
+    const char * type = nullptr;
+    const char * severity = nullptr;
+
+    switch ( in_source )
+    {
+    case GL_DEBUG_SOURCE_API:
+        source = "Source: API";
+        break;
+
+    case GL_DEBUG_SOURCE_WINDOW_SYSTEM:
+        source = "Source: Window System";
+        break;
+
+    case GL_DEBUG_SOURCE_SHADER_COMPILER:
+        source = "Source Shader Compiler";
+        break;
+
+    case GL_DEBUG_SOURCE_THIRD_PARTY:
+        source = "Source Third Party";
+        break;
+
+    case GL_DEBUG_SOURCE_APPLICATION:
+        source = "Source Application";
+        break;
+
+    case GL_DEBUG_SOURCE_OTHER:
+        source = "Source Other";
+        break;
+
+    default:
+        source = "Source Unknow";
+        break;
+    }
+
+    switch ( in_type )
+    {
+    case GL_DEBUG_TYPE_ERROR:
+        type = "Type ERROR";
+        break;
+
+    case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR:
+        type = "Type Deprecated Behaviour";
+        break;
+
+    case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:
+        type = "Type Undefined Behaviour";
+        break;
+
+    case GL_DEBUG_TYPE_PORTABILITY:
+        type = "Type Portability";
+        break;
+
+    case GL_DEBUG_TYPE_PERFORMANCE:
+        type = "Type Performance";
+        break;
+
+    case GL_DEBUG_TYPE_MARKER:
+        type = "Type Marker";
+        break;
+
+    case GL_DEBUG_TYPE_PUSH_GROUP:
+        type = "Type Push Group";
+        break;
+
+    case GL_DEBUG_TYPE_POP_GROUP:
+        type = "Type Pop Group";
+        break;
+
+    case GL_DEBUG_TYPE_OTHER:
+        type = "Type Other";
+        break;
+
+    default:
+        type = "Type Unknow";
+        break;
+    }
+
+    switch ( in_severity )
+    {
+    case GL_DEBUG_SEVERITY_HIGH:
+        severity = "High Severity";
+        break;
+    case GL_DEBUG_SEVERITY_MEDIUM:
+        severity = "Medium Severity";
+        break;
+    case GL_DEBUG_SEVERITY_LOW:
+        severity = "Low Severity";
+        break;
+    case GL_DEBUG_SEVERITY_NOTIFICATION:
+        severity = "Notification";
+        break;
+    default:
+        severity = "Unknow Severity level";
+        break;
+    }
+
+    std::snprintf( in_buffer, in_size, " * OpenGL Info: %s %s ( id %u ), from %s :\n * %s\n", type, severity, in_id, source, in_message );
+}
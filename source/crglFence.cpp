@@ -22,6 +22,8 @@
 #include "crglPrecompiled.hpp"
 #include "crglFence.hpp"
 
+#include <chrono>
+
 
 gl::Fence::Fence( void )
 {
@@ -52,7 +54,13 @@ bool gl::Fence::IsSync(void) const
 
 GLenum gl::Fence::ClientWait( const GLbitfield in_flags, const GLuint64 in_timeout ) const
 {
-    return glClientWaitSync( m_sync, in_flags, in_timeout );
+    auto start = std::chrono::steady_clock::now();
+    GLenum result = glClientWaitSync( m_sync, in_flags, in_timeout );
+
+    if ( Context* context = Context::Current() )
+        context->RecordFenceWait( std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - start ).count() );
+
+    return result;
 }
 
 void gl::Fence::Wait( const GLbitfield in_flags, const GLuint64 in_timeout ) const
@@ -22,351 +22,304 @@
 #include "crglPrecompiled.hpp"
 #include "crglFormat.hpp"
 
+// uncompressed format, 1x1 pixel blocks
+#define FORMAT_PIXEL( in_format, in_channels, in_inverse, in_type, in_components, in_bytes, in_flags ) \
+    { in_format, in_channels, in_inverse, in_type, in_components, in_bytes, 1, 1, in_bytes, in_flags, in_bytes }
 
-GLuint gl::Format::BytesPerPixel(void) const
+// uncompressed format the drivers store wider than it is transfered
+#define FORMAT_PADDED( in_format, in_channels, in_inverse, in_type, in_components, in_bytes, in_storage, in_flags ) \
+    { in_format, in_channels, in_inverse, in_type, in_components, in_bytes, 1, 1, in_bytes, in_flags, in_storage }
+
+// 4x4 block compressed format, transfered as raw bytes
+#define FORMAT_BLOCK( in_format, in_channels, in_components, in_blockBytes, in_flags ) \
+    { in_format, in_channels, in_channels, GL_UNSIGNED_BYTE, in_components, 0, 4, 4, in_blockBytes, gl::FORMAT_COMPRESSED | in_flags, 0 }
+
+static constexpr GLubyte k_SRGB = gl::FORMAT_SRGB;
+static constexpr GLubyte k_INT = gl::FORMAT_INTEGER;
+static constexpr GLubyte k_DEPTH = gl::FORMAT_DEPTH;
+static constexpr GLubyte k_STENCIL = gl::FORMAT_STENCIL;
+static constexpr GLubyte k_GENERIC = gl::FORMAT_GENERIC;
+
+static constexpr gl::formatInfo_t k_FORMAT_TABLE[] =
+{
+    // 1 color component
+    FORMAT_PIXEL( GL_R8,                GL_RED,             GL_RED,             GL_UNSIGNED_BYTE,   1, 1, 0 ),
+    FORMAT_PIXEL( GL_R8_SNORM,          GL_RED,             GL_RED,             GL_BYTE,            1, 1, 0 ),
+    FORMAT_PIXEL( GL_R8I,               GL_RED_INTEGER,     GL_RED_INTEGER,     GL_BYTE,            1, 1, k_INT ),
+    FORMAT_PIXEL( GL_R8UI,              GL_RED_INTEGER,     GL_RED_INTEGER,     GL_UNSIGNED_BYTE,   1, 1, k_INT ),
+    FORMAT_PIXEL( GL_R16,               GL_RED,             GL_RED,             GL_UNSIGNED_SHORT,  1, 2, 0 ),
+    FORMAT_PIXEL( GL_R16_SNORM,         GL_RED,             GL_RED,             GL_SHORT,           1, 2, 0 ),
+    FORMAT_PIXEL( GL_R16I,              GL_RED_INTEGER,     GL_RED_INTEGER,     GL_SHORT,           1, 2, k_INT ),
+    FORMAT_PIXEL( GL_R16UI,             GL_RED_INTEGER,     GL_RED_INTEGER,     GL_UNSIGNED_SHORT,  1, 2, k_INT ),
+    FORMAT_PIXEL( GL_R16F,              GL_RED,             GL_RED,             GL_HALF_FLOAT,      1, 2, 0 ),
+    FORMAT_PIXEL( GL_R32F,              GL_RED,             GL_RED,             GL_FLOAT,           1, 4, 0 ),
+    FORMAT_PIXEL( GL_R32I,              GL_RED_INTEGER,     GL_RED_INTEGER,     GL_INT,             1, 4, k_INT ),
+    FORMAT_PIXEL( GL_R32UI,             GL_RED_INTEGER,     GL_RED_INTEGER,     GL_UNSIGNED_INT,    1, 4, k_INT ),
+
+    // two color components
+    FORMAT_PIXEL( GL_RG8,               GL_RG,              GL_RG,              GL_UNSIGNED_BYTE,   2, 2, 0 ),
+    FORMAT_PIXEL( GL_RG8_SNORM,         GL_RG,              GL_RG,              GL_BYTE,            2, 2, 0 ),
+    FORMAT_PIXEL( GL_RG8I,              GL_RG_INTEGER,      GL_RG_INTEGER,      GL_BYTE,            2, 2, k_INT ),
+    FORMAT_PIXEL( GL_RG8UI,             GL_RG_INTEGER,      GL_RG_INTEGER,      GL_UNSIGNED_BYTE,   2, 2, k_INT ),
+    FORMAT_PIXEL( GL_RG16,              GL_RG,              GL_RG,              GL_UNSIGNED_SHORT,  2, 4, 0 ),
+    FORMAT_PIXEL( GL_RG16_SNORM,        GL_RG,              GL_RG,              GL_SHORT,           2, 4, 0 ),
+    FORMAT_PIXEL( GL_RG16I,             GL_RG_INTEGER,      GL_RG_INTEGER,      GL_SHORT,           2, 4, k_INT ),
+    FORMAT_PIXEL( GL_RG16UI,            GL_RG_INTEGER,      GL_RG_INTEGER,      GL_UNSIGNED_SHORT,  2, 4, k_INT ),
+    FORMAT_PIXEL( GL_RG16F,             GL_RG,              GL_RG,              GL_HALF_FLOAT,      2, 4, 0 ),
+    FORMAT_PIXEL( GL_RG32F,             GL_RG,              GL_RG,              GL_FLOAT,           2, 8, 0 ),
+    FORMAT_PIXEL( GL_RG32I,             GL_RG_INTEGER,      GL_RG_INTEGER,      GL_INT,             2, 8, k_INT ),
+    FORMAT_PIXEL( GL_RG32UI,            GL_RG_INTEGER,      GL_RG_INTEGER,      GL_UNSIGNED_INT,    2, 8, k_INT ),
+
+    // 3 color components
+    FORMAT_PADDED( GL_RGB8,             GL_RGB,             GL_BGR,             GL_UNSIGNED_BYTE,   3, 3, 4, 0 ),
+    FORMAT_PADDED( GL_RGB8_SNORM,       GL_RGB,             GL_BGR,             GL_BYTE,            3, 3, 4, 0 ),
+    FORMAT_PADDED( GL_RGB8I,            GL_RGB_INTEGER,     GL_BGR_INTEGER,     GL_BYTE,            3, 3, 4, k_INT ),
+    FORMAT_PADDED( GL_RGB8UI,           GL_RGB_INTEGER,     GL_BGR_INTEGER,     GL_UNSIGNED_BYTE,   3, 3, 4, k_INT ),
+    FORMAT_PADDED( GL_SRGB8,            GL_RGB,             GL_BGR,             GL_UNSIGNED_BYTE,   3, 3, 4, k_SRGB ),
+    FORMAT_PADDED( GL_RGB16,            GL_RGB,             GL_BGR,             GL_UNSIGNED_SHORT,  3, 6, 8, 0 ),
+    FORMAT_PADDED( GL_RGB16_SNORM,      GL_RGB,             GL_BGR,             GL_SHORT,           3, 6, 8, 0 ),
+    FORMAT_PADDED( GL_RGB16I,           GL_RGB_INTEGER,     GL_BGR_INTEGER,     GL_SHORT,           3, 6, 8, k_INT ),
+    FORMAT_PADDED( GL_RGB16UI,          GL_RGB_INTEGER,     GL_BGR_INTEGER,     GL_UNSIGNED_SHORT,  3, 6, 8, k_INT ),
+    FORMAT_PADDED( GL_RGB16F,           GL_RGB,             GL_BGR,             GL_HALF_FLOAT,      3, 6, 8, 0 ),
+    FORMAT_PIXEL( GL_RGB32F,            GL_RGB,             GL_BGR,             GL_FLOAT,           3, 12, 0 ),
+    FORMAT_PIXEL( GL_RGB32I,            GL_RGB_INTEGER,     GL_BGR_INTEGER,     GL_INT,             3, 12, k_INT ),
+    FORMAT_PIXEL( GL_RGB32UI,           GL_RGB_INTEGER,     GL_BGR_INTEGER,     GL_UNSIGNED_INT,    3, 12, k_INT ),
+    // packed types only accept the RGB order
+    FORMAT_PIXEL( GL_R3_G3_B2,          GL_RGB,             GL_RGB,             GL_UNSIGNED_BYTE_3_3_2, 3, 1, 0 ),
+    FORMAT_PIXEL( GL_RGB565,            GL_RGB,             GL_RGB,             GL_UNSIGNED_SHORT_5_6_5, 3, 2, 0 ),
+    FORMAT_PIXEL( GL_R11F_G11F_B10F,    GL_RGB,             GL_RGB,             GL_UNSIGNED_INT_10F_11F_11F_REV, 3, 4, 0 ),
+    FORMAT_PIXEL( GL_RGB9_E5,           GL_RGB,             GL_RGB,             GL_UNSIGNED_INT_5_9_9_9_REV, 3, 4, 0 ),
+    // no matching packed type, the driver convert from the next wider one
+    FORMAT_PADDED( GL_RGB4,             GL_RGB,             GL_BGR,             GL_UNSIGNED_BYTE,   3, 3, 2, 0 ),
+    FORMAT_PADDED( GL_RGB5,             GL_RGB,             GL_BGR,             GL_UNSIGNED_BYTE,   3, 3, 2, 0 ),
+    FORMAT_PADDED( GL_RGB10,            GL_RGB,             GL_BGR,             GL_UNSIGNED_SHORT,  3, 6, 4, 0 ),
+    FORMAT_PADDED( GL_RGB12,            GL_RGB,             GL_BGR,             GL_UNSIGNED_SHORT,  3, 6, 8, 0 ),
+
+    // 4 color components
+    FORMAT_PIXEL( GL_RGBA8,             GL_RGBA,            GL_BGRA,            GL_UNSIGNED_BYTE,   4, 4, 0 ),
+    FORMAT_PIXEL( GL_RGBA8_SNORM,       GL_RGBA,            GL_BGRA,            GL_BYTE,            4, 4, 0 ),
+    FORMAT_PIXEL( GL_RGBA8I,            GL_RGBA_INTEGER,    GL_BGRA_INTEGER,    GL_BYTE,            4, 4, k_INT ),
+    FORMAT_PIXEL( GL_RGBA8UI,           GL_RGBA_INTEGER,    GL_BGRA_INTEGER,    GL_UNSIGNED_BYTE,   4, 4, k_INT ),
+    FORMAT_PIXEL( GL_SRGB8_ALPHA8,      GL_RGBA,            GL_BGRA,            GL_UNSIGNED_BYTE,   4, 4, k_SRGB ),
+    FORMAT_PIXEL( GL_RGBA16,            GL_RGBA,            GL_BGRA,            GL_UNSIGNED_SHORT,  4, 8, 0 ),
+    FORMAT_PIXEL( GL_RGBA16_SNORM,      GL_RGBA,            GL_BGRA,            GL_SHORT,           4, 8, 0 ),
+    FORMAT_PIXEL( GL_RGBA16I,           GL_RGBA_INTEGER,    GL_BGRA_INTEGER,    GL_SHORT,           4, 8, k_INT ),
+    FORMAT_PIXEL( GL_RGBA16UI,          GL_RGBA_INTEGER,    GL_BGRA_INTEGER,    GL_UNSIGNED_SHORT,  4, 8, k_INT ),
+    FORMAT_PIXEL( GL_RGBA16F,           GL_RGBA,            GL_BGRA,            GL_HALF_FLOAT,      4, 8, 0 ),
+    FORMAT_PIXEL( GL_RGBA32F,           GL_RGBA,            GL_BGRA,            GL_FLOAT,           4, 16, 0 ),
+    FORMAT_PIXEL( GL_RGBA32I,           GL_RGBA_INTEGER,    GL_BGRA_INTEGER,    GL_INT,             4, 16, k_INT ),
+    FORMAT_PIXEL( GL_RGBA32UI,          GL_RGBA_INTEGER,    GL_BGRA_INTEGER,    GL_UNSIGNED_INT,    4, 16, k_INT ),
+    FORMAT_PIXEL( GL_RGBA4,             GL_RGBA,            GL_BGRA,            GL_UNSIGNED_SHORT_4_4_4_4, 4, 2, 0 ),
+    FORMAT_PIXEL( GL_RGB5_A1,           GL_RGBA,            GL_BGRA,            GL_UNSIGNED_SHORT_5_5_5_1, 4, 2, 0 ),
+    FORMAT_PIXEL( GL_RGB10_A2,          GL_RGBA,            GL_BGRA,            GL_UNSIGNED_INT_2_10_10_10_REV, 4, 4, 0 ),
+    FORMAT_PIXEL( GL_RGB10_A2UI,        GL_RGBA_INTEGER,    GL_BGRA_INTEGER,    GL_UNSIGNED_INT_2_10_10_10_REV, 4, 4, k_INT ),
+    FORMAT_PADDED( GL_RGBA2,            GL_RGBA,            GL_BGRA,            GL_UNSIGNED_BYTE,   4, 4, 2, 0 ),
+    FORMAT_PIXEL( GL_RGBA12,            GL_RGBA,            GL_BGRA,            GL_UNSIGNED_SHORT,  4, 8, 0 ),
+
+    // depth and stencil
+    FORMAT_PIXEL( GL_DEPTH_COMPONENT16,     GL_DEPTH_COMPONENT, GL_DEPTH_COMPONENT, GL_UNSIGNED_SHORT,  1, 2, k_DEPTH ),
+    FORMAT_PIXEL( GL_DEPTH_COMPONENT24,     GL_DEPTH_COMPONENT, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT,    1, 4, k_DEPTH ),
+    FORMAT_PIXEL( GL_DEPTH_COMPONENT32,     GL_DEPTH_COMPONENT, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT,    1, 4, k_DEPTH ),
+    FORMAT_PIXEL( GL_DEPTH_COMPONENT32F,    GL_DEPTH_COMPONENT, GL_DEPTH_COMPONENT, GL_FLOAT,           1, 4, k_DEPTH ),
+    FORMAT_PIXEL( GL_DEPTH24_STENCIL8,      GL_DEPTH_STENCIL,   GL_DEPTH_STENCIL,   GL_UNSIGNED_INT_24_8, 2, 4, k_DEPTH | k_STENCIL ),
+    FORMAT_PIXEL( GL_DEPTH32F_STENCIL8,     GL_DEPTH_STENCIL,   GL_DEPTH_STENCIL,   GL_FLOAT_32_UNSIGNED_INT_24_8_REV, 2, 8, k_DEPTH | k_STENCIL ),
+    FORMAT_PIXEL( GL_STENCIL_INDEX1,        GL_STENCIL_INDEX,   GL_STENCIL_INDEX,   GL_UNSIGNED_BYTE,   1, 1, k_STENCIL ),
+    FORMAT_PIXEL( GL_STENCIL_INDEX4,        GL_STENCIL_INDEX,   GL_STENCIL_INDEX,   GL_UNSIGNED_BYTE,   1, 1, k_STENCIL ),
+    FORMAT_PIXEL( GL_STENCIL_INDEX8,        GL_STENCIL_INDEX,   GL_STENCIL_INDEX,   GL_UNSIGNED_BYTE,   1, 1, k_STENCIL ),
+    FORMAT_PIXEL( GL_STENCIL_INDEX16,       GL_STENCIL_INDEX,   GL_STENCIL_INDEX,   GL_UNSIGNED_SHORT,  1, 2, k_STENCIL ),
+
+    // generic compressed, the driver choose the storage
+    FORMAT_BLOCK( GL_COMPRESSED_RED,                            GL_RED,     1, 0, k_GENERIC ),
+    FORMAT_BLOCK( GL_COMPRESSED_RG,                             GL_RG,      2, 0, k_GENERIC ),
+    FORMAT_BLOCK( GL_COMPRESSED_RGB,                            GL_RGB,     3, 0, k_GENERIC ),
+    FORMAT_BLOCK( GL_COMPRESSED_RGBA,                           GL_RGBA,    4, 0, k_GENERIC ),
+    FORMAT_BLOCK( GL_COMPRESSED_SRGB,                           GL_RGB,     3, 0, k_GENERIC | k_SRGB ),
+    FORMAT_BLOCK( GL_COMPRESSED_SRGB_ALPHA,                     GL_RGBA,    4, 0, k_GENERIC | k_SRGB ),
+
+    // RGTC ( BC4 / BC5 )
+    FORMAT_BLOCK( GL_COMPRESSED_RED_RGTC1,                      GL_RED,     1, 8, 0 ),
+    FORMAT_BLOCK( GL_COMPRESSED_SIGNED_RED_RGTC1,               GL_RED,     1, 8, 0 ),
+    FORMAT_BLOCK( GL_COMPRESSED_RG_RGTC2,                       GL_RG,      2, 16, 0 ),
+    FORMAT_BLOCK( GL_COMPRESSED_SIGNED_RG_RGTC2,                GL_RG,      2, 16, 0 ),
+
+    // BPTC ( BC6H / BC7 )
+    FORMAT_BLOCK( GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT,          GL_RGB,     3, 16, 0 ),
+    FORMAT_BLOCK( GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT,        GL_RGB,     3, 16, 0 ),
+    FORMAT_BLOCK( GL_COMPRESSED_RGBA_BPTC_UNORM,                GL_RGBA,    4, 16, 0 ),
+    FORMAT_BLOCK( GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM,          GL_RGBA,    4, 16, k_SRGB ),
+
+    // ETC2 / EAC
+    FORMAT_BLOCK( GL_COMPRESSED_R11_EAC,                        GL_RED,     1, 8, 0 ),
+    FORMAT_BLOCK( GL_COMPRESSED_SIGNED_R11_EAC,                 GL_RED,     1, 8, 0 ),
+    FORMAT_BLOCK( GL_COMPRESSED_RG11_EAC,                       GL_RG,      2, 16, 0 ),
+    FORMAT_BLOCK( GL_COMPRESSED_SIGNED_RG11_EAC,                GL_RG,      2, 16, 0 ),
+    FORMAT_BLOCK( GL_COMPRESSED_RGB8_ETC2,                      GL_RGB,     3, 8, 0 ),
+    FORMAT_BLOCK( GL_COMPRESSED_SRGB8_ETC2,                     GL_RGB,     3, 8, k_SRGB ),
+    FORMAT_BLOCK( GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2,  GL_RGBA,    4, 8, 0 ),
+    FORMAT_BLOCK( GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2, GL_RGBA,    4, 8, k_SRGB ),
+    FORMAT_BLOCK( GL_COMPRESSED_RGBA8_ETC2_EAC,                 GL_RGBA,    4, 16, 0 ),
+    FORMAT_BLOCK( GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,          GL_RGBA,    4, 16, k_SRGB ),
+
+    // S3TC ( BC1 / BC2 / BC3 )
+    FORMAT_BLOCK( GL_COMPRESSED_RGB_S3TC_DXT1_EXT,              GL_RGB,     3, 8, 0 ),
+    FORMAT_BLOCK( GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,             GL_RGBA,    4, 8, 0 ),
+    FORMAT_BLOCK( GL_COMPRESSED_RGBA_S3TC_DXT3_EXT,             GL_RGBA,    4, 16, 0 ),
+    FORMAT_BLOCK( GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,             GL_RGBA,    4, 16, 0 ),
+    FORMAT_BLOCK( GL_COMPRESSED_SRGB_S3TC_DXT1_EXT,             GL_RGB,     3, 8, k_SRGB ),
+    FORMAT_BLOCK( GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT,       GL_RGBA,    4, 8, k_SRGB ),
+    FORMAT_BLOCK( GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT,       GL_RGBA,    4, 16, k_SRGB ),
+    FORMAT_BLOCK( GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT,       GL_RGBA,    4, 16, k_SRGB ),
+};
+
+#undef FORMAT_PIXEL
+#undef FORMAT_PADDED
+#undef FORMAT_BLOCK
+
+static constexpr GLuint k_FORMAT_COUNT = sizeof( k_FORMAT_TABLE ) / sizeof( k_FORMAT_TABLE[0] );
+
+// open addressing hash of the table, built at compile time, slot store table index + 1, 0 for empty
+static constexpr GLuint k_FORMAT_HASH_SIZE = 256;
+static_assert( k_FORMAT_COUNT < k_FORMAT_HASH_SIZE / 2, "format hash load factor too high" );
+
+typedef struct formatHash_t
 {
-    
+    GLubyte slots[k_FORMAT_HASH_SIZE];
+} formatHash_t;
 
-    return 0;
+static constexpr GLuint FormatHash( const GLenum in_internalFormat )
+{
+    // fibonacci hashing, keep the top 8 bits
+    return static_cast<GLuint>( ( static_cast<uint32_t>( in_internalFormat ) * 2654435769u ) >> 24 );
 }
 
-GLenum gl::Format::ColorChanels( const bool in_inverse ) const
+static constexpr formatHash_t BuildFormatHash( void )
 {
-    GLenum format = GL_NONE;
-    switch ( internalFormat )
+    formatHash_t hash{};
+    for ( GLuint i = 0; i < k_FORMAT_COUNT; i++ )
     {
-    // 1 color component only 
-    case GL_R8:
-    case GL_R8I:
-    case GL_R8UI:
-    case GL_R16:
-    case GL_R16I:
-    case GL_R16UI:
-    case GL_R16_SNORM:
-    case GL_R16F:
-    case GL_R32F:
-    case GL_R32I:
-    case GL_R32UI:    
-        format = GL_RED;
-        break;
-    
-    // two color components 
-    case GL_RG8:
-    case GL_RG8I:
-    case GL_RG8UI:
-    case GL_RG8_SNORM:
-    case GL_RG16:
-    case GL_RG16I:
-    case GL_RG16UI:
-    case GL_RG16_SNORM:
-    case GL_RG16F:
-    case GL_RG32F:
-    case GL_RG32I:
-    case GL_RG32UI:
-        format = GL_RG;
-        break;
-    
-    // 3 color components
-    case GL_RGB8:
-    case GL_RGB8I:
-    case GL_RGB8UI:
-    case GL_RGB8_SNORM:
-    case GL_SRGB8:
-    case GL_RGB16:
-    case GL_RGB16I:
-    case GL_RGB16UI:
-    case GL_RGB16_SNORM:
-    case GL_RGB16F:
-    case GL_RGB32I:
-    case GL_RGB32UI:
-    case GL_RGB32F:
-    case GL_R3_G3_B2:
-    case GL_R11F_G11F_B10F:
-    case GL_RGB9_E5:
-    case GL_RGB4:
-    case GL_RGB5:
-    case GL_RGB565:
-    case GL_RGB10:
-    case GL_RGB12:
-        format = ( in_inverse ) ? GL_BGR : GL_RGB;
-        break;
-
-    case GL_RGBA8:
-    case GL_RGBA8I:
-    case GL_RGBA8UI:
-    case GL_RGBA8_SNORM:
-    case GL_SRGB8_ALPHA8:
-    case GL_RGBA16:
-    case GL_RGBA16I:
-    case GL_RGBA16UI:
-    case GL_RGBA16_SNORM:
-    case GL_RGBA16F:
-    case GL_RGBA32I:
-    case GL_RGBA32UI:
-    case GL_RGBA32F:
-    case GL_RGBA2:
-    case GL_RGBA4:
-    case GL_RGB5_A1:
-    case GL_RGB10_A2:
-    case GL_RGB10_A2UI:
-    case GL_RGBA12:
-        format = ( in_inverse ) ? GL_BGRA : GL_RGBA;
-        break;
+        GLuint slot = FormatHash( k_FORMAT_TABLE[i].internalFormat );
+        while ( hash.slots[slot] != 0 )
+            slot = ( slot + 1 ) & ( k_FORMAT_HASH_SIZE - 1 );
         
-    case GL_DEPTH_COMPONENT16:
-    case GL_DEPTH_COMPONENT24:
-    case GL_DEPTH_COMPONENT32:
-    case GL_DEPTH_COMPONENT32F:
-        format = GL_DEPTH_COMPONENT;
-        break;
-
-    case GL_DEPTH24_STENCIL8:
-    case GL_DEPTH32F_STENCIL8:
-        format = GL_DEPTH_STENCIL;
-        break;
-    
-    case GL_STENCIL_INDEX1:
-    case GL_STENCIL_INDEX4:
-    case GL_STENCIL_INDEX8:
-    case GL_STENCIL_INDEX16: 
-        format = GL_STENCIL_INDEX;
-        break;
-    
-    // compressed
-    case GL_COMPRESSED_RED:
-    case GL_COMPRESSED_RED_RGTC1:
-    case GL_COMPRESSED_SIGNED_RED_RGTC1:
-    case GL_COMPRESSED_R11_EAC:
-    case GL_COMPRESSED_SIGNED_R11_EAC:
-    case GL_COMPRESSED_RG11_EAC:
-        format = GL_RED;
-        break;
-
-    case GL_COMPRESSED_RG:
-    case GL_COMPRESSED_RG_RGTC2:
-    case GL_COMPRESSED_SIGNED_RG_RGTC2:
-    case GL_COMPRESSED_SIGNED_RG11_EAC:
-        format = GL_RG;
-        break;
-
-    case GL_COMPRESSED_RGB:
-    case GL_COMPRESSED_SRGB:
-    case GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT:
-    case GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT:
-    case GL_COMPRESSED_RGB8_ETC2:
-    case GL_COMPRESSED_SRGB8_ETC2:
-    case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
-        format = GL_RGB;
-        break;
-
-    case GL_COMPRESSED_RGBA:
-    case GL_COMPRESSED_SRGB_ALPHA:
-    case GL_COMPRESSED_RGBA_BPTC_UNORM:
-    case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
-    case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:
-    case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2:
-    case GL_COMPRESSED_RGBA8_ETC2_EAC:
-    case GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC:
-    case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
-    case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
-    case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
-        format = GL_RGBA;
-        break;
-
-    default:
-        // TODO: call a error here
-        break;
+        hash.slots[slot] = static_cast<GLubyte>( i + 1 );
     }
-
-    return format;
+    return hash;
 }
 
-GLenum gl::Format::DataType(void) const
-{
-    GLenum type = GL_NONE;
+static constexpr formatHash_t k_FORMAT_HASH = BuildFormatHash();
 
-    switch ( internalFormat )
+const gl::formatInfo_t* gl::Format::Find( const GLenum in_internalFormat )
+{
+    GLuint slot = FormatHash( in_internalFormat );
+    while ( k_FORMAT_HASH.slots[slot] != 0 )
     {
-    case GL_RG8I:
-    case GL_RGB8I:
-    case GL_RGBA8I:
-    case GL_R8_SNORM:
-    case GL_RG8_SNORM:
-    case GL_RGB8_SNORM:
-    case GL_RGBA8_SNORM:
-    case GL_R3_G3_B2:
-    type = GL_BYTE; 
-    break;
-    
-    case GL_R8:
-    case GL_RG8:
-    case GL_RGB8:
-    case GL_RGBA8:
-    case GL_SRGB8:
-    case GL_SRGB8_ALPHA8:
-    case GL_R8UI:
-    case GL_RG8UI:
-    case GL_RGB8UI:
-    case GL_RGBA8UI:
-        type = GL_UNSIGNED_BYTE; 
-        break;
-
-    case GL_R16I:
-    case GL_RG16I:
-    case GL_RGB16I:
-    case GL_RGBA16I:
-    case GL_R16_SNORM:
-    case GL_RG16_SNORM:
-    case GL_RGB16_SNORM:
-    case GL_RGBA16_SNORM:
-        type = GL_SHORT; 
-        break;
-    
-    case GL_R16:
-    case GL_RG16:
-    case GL_RGB16:
-    case GL_RGBA16:
-    case GL_R16UI:
-    case GL_RG16UI:
-    case GL_RGB16UI:
-    case GL_RGBA16UI:   
-        type = GL_UNSIGNED_SHORT; 
-        break;
-        
-    case GL_R16F:
-    case GL_RG16F:
-    case GL_RGB16F:
-    case GL_RGBA16F:
-        type = GL_HALF_FLOAT; 
-        break;
-        
-    case GL_R32I:
-    case GL_RG32I:
-    case GL_RGB32I:
-    case GL_RGBA32I:
-        type = GL_INT; 
-        break;
-    
-    case GL_R32UI:    
-    case GL_RG32UI:
-    case GL_RGB32UI:
-    case GL_RGBA32UI:
-        type = GL_UNSIGNED_INT; 
-        break;
-    
-    case GL_R32F:
-    case GL_RG32F:
-    case GL_RGB32F:
-    case GL_RGBA32F:
-        type = GL_FLOAT; 
-        break;
-
-    case GL_R11F_G11F_B10F:
-        type = GL_UNSIGNED_INT_10F_11F_11F_REV;
-        break;
-
-    case GL_RGB9_E5:
-        type = GL_UNSIGNED_INT_5_9_9_9_REV;
-        break;
-
-    case GL_RGB565:
-        type = GL_UNSIGNED_SHORT_5_6_5;
-        break;
-
-    case GL_RGB4:
-        type = GL_UNSIGNED_SHORT_4_4_4_4;
-        break;
-
-    case GL_RGB5:
-        type = GL_UNSIGNED_SHORT_5_5_5_1;
-        break;
-
-    case GL_RGB5_A1:
-        type = GL_UNSIGNED_SHORT_5_5_5_1;
-        break;
-    
-    case GL_RGB10:
-    case GL_RGB10_A2:
-    case GL_RGB10_A2UI:
-        type = GL_UNSIGNED_INT_10_10_10_2;
-        break;
-
-    case GL_RGB12:
-    case GL_RGBA12:
-        type = GL_UNSIGNED_SHORT;
-        break;
-
-    case GL_RGBA2:
-    case GL_RGBA4:
-        type = GL_BYTE;
-        break;
-
-    case GL_DEPTH_COMPONENT16:
-        type = GL_HALF_FLOAT;
-        break;
-
-    case GL_DEPTH_COMPONENT24:
-        type = GL_UNSIGNED_BYTE; 
-        break;
-
-    case GL_DEPTH_COMPONENT32:
-        type = GL_UNSIGNED_INT;
-        break;
-
-    case GL_DEPTH_COMPONENT32F:
-        type = GL_FLOAT;
-        break;
-    
-    case GL_DEPTH24_STENCIL8:
-    case GL_DEPTH32F_STENCIL8:    
-        type= GL_UNSIGNED_INT_24_8;
-        break;
-
-    case GL_STENCIL_INDEX1:
-    case GL_STENCIL_INDEX4:
-    case GL_STENCIL_INDEX8:
-        type = GL_UNSIGNED_BYTE;
-        break;
-
-    case GL_STENCIL_INDEX16: 
-        type = GL_UNSIGNED_SHORT;
-        break;
-    
-    // we not assume a specific type for compressed formats, only raw bytes
-    case GL_COMPRESSED_RED:
-    case GL_COMPRESSED_RED_RGTC1:
-    case GL_COMPRESSED_SIGNED_RED_RGTC1:
-    case GL_COMPRESSED_R11_EAC:
-    case GL_COMPRESSED_SIGNED_R11_EAC:
-    case GL_COMPRESSED_RG11_EAC:
-    case GL_COMPRESSED_RG:
-    case GL_COMPRESSED_RG_RGTC2:
-    case GL_COMPRESSED_SIGNED_RG_RGTC2:
-    case GL_COMPRESSED_SIGNED_RG11_EAC:
-    case GL_COMPRESSED_RGB:
-    case GL_COMPRESSED_SRGB:
-    case GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT:
-    case GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT:
-    case GL_COMPRESSED_RGB8_ETC2:
-    case GL_COMPRESSED_SRGB8_ETC2:
-    case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
-    case GL_COMPRESSED_RGBA:
-    case GL_COMPRESSED_SRGB_ALPHA:
-    case GL_COMPRESSED_RGBA_BPTC_UNORM:
-    case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
-    case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:
-    case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2:
-    case GL_COMPRESSED_RGBA8_ETC2_EAC:
-    case GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC:
-    case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
-    case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
-    case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
-        return GL_UNSIGNED_BYTE;
-
-    default:
-        // TODO: call a error here
-        break;
+        const formatInfo_t* info = &k_FORMAT_TABLE[k_FORMAT_HASH.slots[slot] - 1];
+        if ( info->internalFormat == in_internalFormat )
+            return info;
+
+        slot = ( slot + 1 ) & ( k_FORMAT_HASH_SIZE - 1 );
     }
 
-    return type;
+    return nullptr;
+}
+
+GLuint gl::Format::BytesPerPixel( void ) const
+{
+    const formatInfo_t* info = Info();
+    return ( info != nullptr ) ? info->bytesPerPixel : 0;
+}
+
+GLuint gl::Format::BytesPerTexel( void ) const
+{
+    const formatInfo_t* info = Info();
+    return ( info != nullptr ) ? info->bytesPerTexel : 0;
+}
+
+GLenum gl::Format::ColorChanels( const bool in_inverse ) const
+{
+    const formatInfo_t* info = Info();
+    if ( info == nullptr )
+        return GL_NONE;
+
+    return in_inverse ? info->inverse : info->channels;
+}
+
+GLenum gl::Format::DataType( void ) const
+{
+    const formatInfo_t* info = Info();
+    return ( info != nullptr ) ? info->type : GL_NONE;
+}
+
+GLuint gl::Format::Components( void ) const
+{
+    const formatInfo_t* info = Info();
+    return ( info != nullptr ) ? info->components : 0;
+}
+
+GLuint gl::Format::BlockWidth( void ) const
+{
+    const formatInfo_t* info = Info();
+    return ( info != nullptr ) ? info->blockWidth : 1;
+}
+
+GLuint gl::Format::BlockHeight( void ) const
+{
+    const formatInfo_t* info = Info();
+    return ( info != nullptr ) ? info->blockHeight : 1;
+}
+
+GLuint gl::Format::BytesPerBlock( void ) const
+{
+    const formatInfo_t* info = Info();
+    return ( info != nullptr ) ? info->bytesPerBlock : 0;
+}
+
+bool gl::Format::HasFlags( const GLuint in_flags ) const
+{
+    const formatInfo_t* info = Info();
+    return ( info != nullptr ) && ( info->flags & in_flags ) == in_flags;
+}
+
+uint64_t gl::Format::ImageSize( const GLsizei in_width, const GLsizei in_height, const GLsizei in_depth ) const
+{
+    uint64_t blocksX = 0;
+    uint64_t blocksY = 0;
+    const formatInfo_t* info = Info();
+    if ( info == nullptr )
+        return 0;
+
+    blocksX = ( static_cast<uint64_t>( std::max( in_width, 1 ) ) + info->blockWidth - 1 ) / info->blockWidth;
+    blocksY = ( static_cast<uint64_t>( std::max( in_height, 1 ) ) + info->blockHeight - 1 ) / info->blockHeight;
+    return blocksX * blocksY * static_cast<uint64_t>( std::max( in_depth, 1 ) ) * info->bytesPerBlock;
+}
+
+uint64_t gl::Format::StorageSize( const GLsizei in_width, const GLsizei in_height, const GLsizei in_depth ) const
+{
+    const formatInfo_t* info = Info();
+    if ( info == nullptr )
+        return 0;
+
+    // compressed blocks are stored as they are transfered
+    if ( info->bytesPerTexel == 0 )
+        return ImageSize( in_width, in_height, in_depth );
+
+    return  static_cast<uint64_t>( std::max( in_width, 1 ) ) * 
+            static_cast<uint64_t>( std::max( in_height, 1 ) ) * 
+            static_cast<uint64_t>( std::max( in_depth, 1 ) ) * info->bytesPerTexel;
+}
+
+uint64_t gl::Format::LevelSize( const GLsizei in_width, const GLsizei in_height, const GLsizei in_depth, const GLint in_level ) const
+{
+    return ImageSize(   std::max( in_width >> in_level, 1 ), 
+                        std::max( in_height >> in_level, 1 ), 
+                        std::max( in_depth >> in_level, 1 ) );
+}
+
+uint64_t gl::Format::TotalSize( const GLsizei in_width, const GLsizei in_height, const GLsizei in_depth, const GLsizei in_levels, const GLsizei in_layers ) const
+{
+    uint64_t size = 0;
+    for ( GLint level = 0; level < std::max( in_levels, 1 ); level++ )
+        size += LevelSize( in_width, in_height, in_depth, level );
+
+    return size * static_cast<uint64_t>( std::max( in_layers, 1 ) );
 }
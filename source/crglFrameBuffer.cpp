@@ -26,7 +26,10 @@ typedef struct  glCoreRenderbuffer_t
 {
     GLenum format = GL_NONE;
     GLuint samples = 0;
+    GLuint width = 0;
+    GLuint height = 0;
     GLuint renderBuffer = 0;
+    gl::memoryOwner_t memory;
 } glCoreRenderbuffer_t;
 
 typedef struct glCoreFramebuffer_t
@@ -54,22 +57,36 @@ bool gl::RenderBuffer::Create( const GLuint in_width, const GLuint in_height, co
 
     m_renderBufferHandle->format = in_format;
     m_renderBufferHandle->samples = in_samples;
+    m_renderBufferHandle->width = in_width;
+    m_renderBufferHandle->height = in_height;
     
     if ( m_renderBufferHandle->samples > 0 )
         glNamedRenderbufferStorageMultisample( m_renderBufferHandle->renderBuffer, in_samples, in_format, in_width, in_height );
     else
         glNamedRenderbufferStorage( m_renderBufferHandle->renderBuffer, in_format, in_width, in_height );   
 
+    if ( Context* context = Context::Current() )
+    {
+        bool estimated = false;
+        uint64_t size = MemoryTracker::RenderBufferSize( in_width, in_height, in_samples, in_format, &estimated );
+        m_renderBufferHandle->memory = context->Memory().Track( MEMORY_RENDERBUFFER, m_renderBufferHandle->renderBuffer, size, estimated );
+    }
+
     return m_renderBufferHandle->renderBuffer != 0 && glIsRenderbuffer( m_renderBufferHandle->renderBuffer ) == GL_TRUE;
 }
 
 void gl::RenderBuffer::Destroy( void )
 {
-    if ( m_renderBufferHandle != nullptr )
+    if ( m_renderBufferHandle == nullptr )
         return;
 
     if ( m_renderBufferHandle->renderBuffer != 0 )
     {
+        if ( Context* context = Context::Current() )
+            context->NotifyResourceDestroyed( MEMORY_RENDERBUFFER, m_renderBufferHandle->renderBuffer );
+
+        MemoryTracker::Untrack( m_renderBufferHandle->memory, MEMORY_RENDERBUFFER, m_renderBufferHandle->renderBuffer );
+
         glDeleteRenderbuffers( 1, &m_renderBufferHandle->renderBuffer );
         m_renderBufferHandle->renderBuffer = 0;
     }
@@ -83,6 +100,26 @@ GLuint gl::RenderBuffer::GetHandle( void ) const
     return m_renderBufferHandle != nullptr ? m_renderBufferHandle->renderBuffer : 0;
 }
 
+GLenum gl::RenderBuffer::InternalFormat( void ) const
+{
+    return m_renderBufferHandle != nullptr ? m_renderBufferHandle->format : GL_NONE;
+}
+
+GLuint gl::RenderBuffer::Width( void ) const
+{
+    return m_renderBufferHandle != nullptr ? m_renderBufferHandle->width : 0;
+}
+
+GLuint gl::RenderBuffer::Height( void ) const
+{
+    return m_renderBufferHandle != nullptr ? m_renderBufferHandle->height : 0;
+}
+
+GLuint gl::RenderBuffer::Samples( void ) const
+{
+    return m_renderBufferHandle != nullptr ? m_renderBufferHandle->samples : 0;
+}
+
 gl::RenderBuffer::operator GLuint( void ) const
 {
     return m_renderBufferHandle != nullptr ? m_renderBufferHandle->renderBuffer : 0;
@@ -137,6 +174,8 @@ bool gl::FrameBuffer::Attach(const attachament_t *in_attachaments, const GLuint
         } break;
         case GL_TEXTURE_1D:
         case GL_TEXTURE_2D:
+        case GL_TEXTURE_RECTANGLE:
+        case GL_TEXTURE_2D_MULTISAMPLE:
         {
             glNamedFramebufferTexture( m_frameBufferHandle->frameBuffer, attch.attachament, attch.handle, 0 );
         } break;
@@ -176,6 +215,101 @@ void gl::FrameBuffer::Blit( const GLuint in_dstFrameBuffer, const rect_t in_srcR
 }
 
 
+void gl::FrameBuffer::Clear( const clearInfo_t* in_clear ) const
+{
+    if ( m_frameBufferHandle == nullptr )
+        return;
+
+    Clear( m_frameBufferHandle->frameBuffer, in_clear );
+}
+
+void gl::FrameBuffer::Clear( const GLuint in_frameBuffer, const clearInfo_t* in_clear )
+{
+    scissorState_t scissor;
+    depthState_t depth;
+    stencilState_t stencil;
+    colorMask_t colorMasks[32];
+
+    // the masks and scissor are changed trought the context state cache
+    Context* context = Context::Current();
+    if ( in_clear == nullptr || context == nullptr )
+        return;
+
+    const GLuint colorCount = std::min<GLuint>( in_clear->colorCount, 32 );
+    if ( in_clear->area != nullptr )
+    {
+        scissorState_t area;
+        area.testing = TRUE;
+        area.x = in_clear->area->X0;
+        area.y = in_clear->area->Y0;
+        area.width = in_clear->area->X1 - in_clear->area->X0;
+        area.height = in_clear->area->Y1 - in_clear->area->Y0;
+        scissor = context->SetScissorState( area );
+    }
+
+    if ( in_clear->ignoreMasks )
+    {
+        for ( GLuint i = 0; i < colorCount; i++ )
+            colorMasks[i] = context->SetColorMask( static_cast<GLuint>( in_clear->colors[i].drawBuffer ), colorMask_t() );
+
+        if ( in_clear->depth )
+        {
+            depthState_t write = depth = context->CurrentDepthStatus();
+            write.mask = TRUE;
+            context->SetDepthState( write );
+        }
+
+        if ( in_clear->stencil )
+        {
+            stencilState_t write = stencil = context->CurrentStencilStatus();
+            write.maskFront = ~0u;
+            write.maskBack = ~0u;
+            context->SetStencilState( write );
+        }
+    }
+
+    for ( GLuint i = 0; i < colorCount; i++ )
+    {
+        const clearColor_t& color = in_clear->colors[i];
+        switch ( color.type )
+        {
+        case GL_INT:
+            glClearNamedFramebufferiv( in_frameBuffer, GL_COLOR, color.drawBuffer, color.colorInt );
+            break;
+        case GL_UNSIGNED_INT:
+            glClearNamedFramebufferuiv( in_frameBuffer, GL_COLOR, color.drawBuffer, color.colorUint );
+            break;
+        default:
+            glClearNamedFramebufferfv( in_frameBuffer, GL_COLOR, color.drawBuffer, color.color );
+            break;
+        }
+    }
+
+    // a single call for packed depth stencil
+    if ( in_clear->depth && in_clear->stencil )
+        glClearNamedFramebufferfi( in_frameBuffer, GL_DEPTH_STENCIL, 0, in_clear->depthValue, in_clear->stencilValue );
+    else if ( in_clear->depth )
+        glClearNamedFramebufferfv( in_frameBuffer, GL_DEPTH, 0, &in_clear->depthValue );
+    else if ( in_clear->stencil )
+        glClearNamedFramebufferiv( in_frameBuffer, GL_STENCIL, 0, &in_clear->stencilValue );
+
+    // back to the previous state, the cache filter what didn't change
+    if ( in_clear->ignoreMasks )
+    {
+        for ( GLuint i = 0; i < colorCount; i++ )
+            context->SetColorMask( static_cast<GLuint>( in_clear->colors[i].drawBuffer ), colorMasks[i] );
+
+        if ( in_clear->depth )
+            context->SetDepthState( depth );
+
+        if ( in_clear->stencil )
+            context->SetStencilState( stencil );
+    }
+
+    if ( in_clear->area != nullptr )
+        context->SetScissorState( scissor );
+}
+
 GLuint gl::FrameBuffer::Handler(void) const
 {
     return m_frameBufferHandle->frameBuffer;
@@ -0,0 +1,320 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#include "crglPrecompiled.hpp"
+#include "crglFrameBufferCache.hpp"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+typedef struct fboEntry_t
+{
+    std::vector<gl::fboAttachment_t>    attachments;
+    uint64_t                            hash = 0;
+    GLuint                              frameBuffer = 0;    // 0 when incomplete
+} fboEntry_t;
+
+typedef std::list<fboEntry_t>   fboList_t;
+
+typedef struct fboDestroyed_t
+{
+    gl::memoryResource_t    resource;
+    GLuint                  name;
+} fboDestroyed_t;
+
+typedef struct glCoreFrameBufferCache_t
+{
+    gl::FrameBufferCache::createInfo_t                      createInfo;
+    gl::Context*                                            context = nullptr;
+    fboList_t                                               entries;        // most recent first
+    std::unordered_multimap<uint64_t, fboList_t::iterator>  lookup;
+    std::mutex                                              destroyedLock;
+    std::vector<fboDestroyed_t>                             destroyed;      // notified, maybe from other threads
+    gl::frameBufferCacheStats_t                             stats;
+} glCoreFrameBufferCache_t;
+
+static bool AttachmentLess( const gl::fboAttachment_t& in_a, const gl::fboAttachment_t& in_b )
+{
+    return in_a.attachment < in_b.attachment;
+}
+
+static bool AttachmentEqual( const gl::fboAttachment_t& in_a, const gl::fboAttachment_t& in_b )
+{
+    return in_a.attachment == in_b.attachment && in_a.target == in_b.target && in_a.handle == in_b.handle && 
+           in_a.level == in_b.level && in_a.layer == in_b.layer;
+}
+
+static uint64_t HashAttachments( const std::vector<gl::fboAttachment_t>& in_attachments )
+{
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for ( const gl::fboAttachment_t& attachment : in_attachments )
+    {
+        const uint64_t values[4] = { attachment.attachment, attachment.handle, static_cast<uint64_t>( attachment.level ), static_cast<uint64_t>( attachment.layer ) };
+        for ( uint64_t value : values )
+        {
+            hash ^= value;
+            hash *= 0x100000001B3ull;
+        }
+    }
+
+    return hash;
+}
+
+static void EraseEntry( glCoreFrameBufferCache_t* in_cache, fboList_t::iterator in_entry )
+{
+    auto range = in_cache->lookup.equal_range( in_entry->hash );
+    for ( auto it = range.first; it != range.second; ++it )
+    {
+        if ( it->second == in_entry )
+        {
+            in_cache->lookup.erase( it );
+            break;
+        }
+    }
+
+    if ( in_entry->frameBuffer != 0 )
+        glDeleteFramebuffers( 1, &in_entry->frameBuffer );
+
+    in_cache->entries.erase( in_entry );
+}
+
+// drop the entries of the objects destroyed since the last call
+static void EvictDestroyed( glCoreFrameBufferCache_t* in_cache )
+{
+    std::vector<fboDestroyed_t> destroyed;
+    {
+        std::lock_guard<std::mutex> lock( in_cache->destroyedLock );
+        if ( in_cache->destroyed.empty() )
+            return;
+
+        destroyed.swap( in_cache->destroyed );
+    }
+
+    for ( auto entry = in_cache->entries.begin(); entry != in_cache->entries.end(); )
+    {
+        bool uses = false;
+        for ( const gl::fboAttachment_t& attachment : entry->attachments )
+        {
+            const gl::memoryResource_t resource = ( attachment.target == GL_RENDERBUFFER ) ? gl::MEMORY_RENDERBUFFER : gl::MEMORY_TEXTURE;
+            for ( const fboDestroyed_t& object : destroyed )
+                uses = uses || ( object.resource == resource && object.name == attachment.handle );
+        }
+
+        if ( uses )
+        {
+            auto next = std::next( entry );
+            EraseEntry( in_cache, entry );
+            in_cache->stats.evictions++;
+            entry = next;
+        }
+        else
+            ++entry;
+    }
+}
+
+static GLuint CreateFrameBuffer( const std::vector<gl::fboAttachment_t>& in_attachments )
+{
+    GLuint frameBuffer = 0;
+    std::vector<GLenum> drawBuffers;
+
+    glCreateFramebuffers( 1, &frameBuffer );
+    for ( const gl::fboAttachment_t& attachment : in_attachments )
+    {
+        if ( attachment.target == GL_RENDERBUFFER )
+            glNamedFramebufferRenderbuffer( frameBuffer, attachment.attachment, GL_RENDERBUFFER, attachment.handle );
+        else if ( attachment.layer >= 0 )
+            glNamedFramebufferTextureLayer( frameBuffer, attachment.attachment, attachment.handle, attachment.level, attachment.layer );
+        else
+            glNamedFramebufferTexture( frameBuffer, attachment.attachment, attachment.handle, attachment.level );
+
+        if ( attachment.attachment >= GL_COLOR_ATTACHMENT0 && attachment.attachment <= GL_COLOR_ATTACHMENT31 )
+            drawBuffers.push_back( attachment.attachment );
+    }
+
+    if ( drawBuffers.empty() )
+    {
+        glNamedFramebufferDrawBuffer( frameBuffer, GL_NONE );
+        glNamedFramebufferReadBuffer( frameBuffer, GL_NONE );
+    }
+    else
+    {
+        glNamedFramebufferDrawBuffers( frameBuffer, static_cast<GLsizei>( drawBuffers.size() ), drawBuffers.data() );
+        glNamedFramebufferReadBuffer( frameBuffer, drawBuffers[0] );
+    }
+
+    if ( glCheckNamedFramebufferStatus( frameBuffer, GL_FRAMEBUFFER ) != GL_FRAMEBUFFER_COMPLETE )
+    {
+        glDeleteFramebuffers( 1, &frameBuffer );
+        return 0;
+    }
+
+    return frameBuffer;
+}
+
+gl::FrameBufferCache::FrameBufferCache( void ) : m_cache( nullptr )
+{
+}
+
+gl::FrameBufferCache::~FrameBufferCache( void )
+{
+    Destroy();
+}
+
+bool gl::FrameBufferCache::Create( const createInfo_t* in_createInfo )
+{
+    if ( in_createInfo == nullptr )
+        return false;
+
+    Destroy();
+
+    Context* context = Context::Current();
+    if ( context == nullptr )
+        return false;
+
+    m_cache = new glCoreFrameBufferCache_t();
+    m_cache->createInfo = *in_createInfo;
+    m_cache->createInfo.maxEntries = std::max<GLuint>( in_createInfo->maxEntries, 1 );
+    m_cache->context = context;
+    if ( !context->AddResourceListener( this ) )
+    {
+        Destroy();
+        return false;
+    }
+
+    return true;
+}
+
+void gl::FrameBufferCache::Destroy( void )
+{
+    if ( m_cache == nullptr )
+        return;
+
+    if ( m_cache->context != nullptr )
+        m_cache->context->RemoveResourceListener( this );
+
+    Clear();
+    delete m_cache;
+    m_cache = nullptr;
+}
+
+GLuint gl::FrameBufferCache::Get( const fboAttachment_t* in_attachments, const GLuint in_count )
+{
+    if ( m_cache == nullptr || in_attachments == nullptr || in_count == 0 )
+        return 0;
+
+    EvictDestroyed( m_cache );
+
+    std::vector<fboAttachment_t> attachments( in_attachments, in_attachments + in_count );
+    std::sort( attachments.begin(), attachments.end(), AttachmentLess );
+    const uint64_t hash = HashAttachments( attachments );
+
+    auto range = m_cache->lookup.equal_range( hash );
+    for ( auto it = range.first; it != range.second; ++it )
+    {
+        fboList_t::iterator entry = it->second;
+        if ( !std::equal( attachments.begin(), attachments.end(), entry->attachments.begin(), entry->attachments.end(), AttachmentEqual ) )
+            continue;
+
+        m_cache->entries.splice( m_cache->entries.begin(), m_cache->entries, entry );
+        m_cache->stats.hits++;
+        return entry->frameBuffer;
+    }
+
+    // first time for this combination, check it once
+    fboEntry_t entry;
+    entry.attachments = attachments;
+    entry.hash = hash;
+    entry.frameBuffer = CreateFrameBuffer( attachments );
+    m_cache->stats.misses++;
+    if ( entry.frameBuffer == 0 )
+        m_cache->stats.incomplete++;
+
+    m_cache->entries.push_front( entry );
+    m_cache->lookup.emplace( hash, m_cache->entries.begin() );
+
+    while ( m_cache->entries.size() > m_cache->createInfo.maxEntries )
+    {
+        EraseEntry( m_cache, std::prev( m_cache->entries.end() ) );
+        m_cache->stats.evictions++;
+    }
+
+    return m_cache->entries.front().frameBuffer;
+}
+
+void gl::FrameBufferCache::Clear( void )
+{
+    if ( m_cache == nullptr )
+        return;
+
+    for ( fboEntry_t& entry : m_cache->entries )
+    {
+        if ( entry.frameBuffer != 0 )
+            glDeleteFramebuffers( 1, &entry.frameBuffer );
+    }
+
+    m_cache->entries.clear();
+    m_cache->lookup.clear();
+
+    std::lock_guard<std::mutex> lock( m_cache->destroyedLock );
+    m_cache->destroyed.clear();
+}
+
+gl::frameBufferCacheStats_t gl::FrameBufferCache::Stats( void ) const
+{
+    if ( m_cache == nullptr )
+        return frameBufferCacheStats_t();
+
+    frameBufferCacheStats_t stats = m_cache->stats;
+    stats.entries = static_cast<GLuint>( m_cache->entries.size() );
+    return stats;
+}
+
+gl::fboAttachment_t gl::FrameBufferCache::Attachment( const Texture* in_texture, const GLenum in_attachment, const GLint in_level, const GLint in_layer )
+{
+    fboAttachment_t attachment;
+    attachment.attachment = in_attachment;
+    attachment.target = in_texture->Target();
+    attachment.handle = in_texture->Handle();
+    attachment.level = in_level;
+    attachment.layer = in_layer;
+    return attachment;
+}
+
+gl::fboAttachment_t gl::FrameBufferCache::Attachment( const RenderBuffer* in_renderBuffer, const GLenum in_attachment )
+{
+    fboAttachment_t attachment;
+    attachment.attachment = in_attachment;
+    attachment.target = GL_RENDERBUFFER;
+    attachment.handle = in_renderBuffer->GetHandle();
+    return attachment;
+}
+
+void gl::FrameBufferCache::ResourceDestroyed( const memoryResource_t in_resource, const GLuint in_name )
+{
+    if ( in_resource != MEMORY_TEXTURE && in_resource != MEMORY_RENDERBUFFER )
+        return;
+
+    // the framebuffers are deleted on the cache context, in the next Get
+    std::lock_guard<std::mutex> lock( m_cache->destroyedLock );
+    m_cache->destroyed.push_back( { in_resource, in_name } );
+}
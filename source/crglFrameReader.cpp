@@ -0,0 +1,389 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#include "crglPrecompiled.hpp"
+#include "crglFrameReader.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+typedef std::chrono::steady_clock   readerClock_t;
+
+enum readerSlotState_t
+{
+    READER_SLOT_FREE = 0,   // can receive a capture
+    READER_SLOT_GPU,        // readback in flight
+    READER_SLOT_QUEUED      // waiting or being consumed
+};
+
+typedef struct readerSlot_t
+{
+    gl::Buffer                  buffer;
+    const void*                 mapped = nullptr;   // persistent mapping
+    GLsync                      fence = nullptr;
+    uint64_t                    index = 0;
+    readerClock_t::time_point   captured;
+    readerSlotState_t           state = READER_SLOT_FREE;   // guarded by glCoreFrameReader_t::lock
+} readerSlot_t;
+
+typedef struct glCoreFrameReader_t
+{
+    gl::FrameReader::createInfo_t       createInfo;
+    GLsizeiptr                          size = 0;           // bytes per frame
+    std::unique_ptr<readerSlot_t[]>     slots;
+    GLuint                              next = 0;           // next slot to capture
+    GLuint                              oldest = 0;         // oldest readback in flight
+    GLuint                              inFlight = 0;
+    uint64_t                            captures = 0;       // Capture calls, the dropped ones too
+
+    // converter source
+    gl::Texture                         copy;
+    gl::FrameBuffer                     copyFrameBuffer;
+
+    std::thread                         thread;
+    std::mutex                          lock;
+    std::condition_variable             wake;               // consumer thread
+    std::condition_variable             freed;              // a slot was consumed
+    std::deque<GLuint>                  queue;
+    bool                                quit = false;
+
+    mutable std::mutex                  statsLock;
+    gl::frameReaderStats_t              stats;
+    uint64_t                            latencySum = 0;
+} glCoreFrameReader_t;
+
+static void ConsumerLoop( glCoreFrameReader_t* in_reader )
+{
+    for ( ;; )
+    {
+        GLuint index = 0;
+        {
+            std::unique_lock<std::mutex> lock( in_reader->lock );
+            in_reader->wake.wait( lock, [in_reader]( void ) { return in_reader->quit || !in_reader->queue.empty(); } );
+            if ( in_reader->queue.empty() )
+                break;
+
+            index = in_reader->queue.front();
+            in_reader->queue.pop_front();
+        }
+
+        readerSlot_t& slot = in_reader->slots[index];
+        gl::frame_t frame;
+        frame.pixels = slot.mapped;
+        frame.size = in_reader->size;
+        frame.width = in_reader->createInfo.width;
+        frame.height = in_reader->createInfo.height;
+        frame.index = slot.index;
+        frame.latency = static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::microseconds>( readerClock_t::now() - slot.captured ).count() );
+
+        {
+            std::lock_guard<std::mutex> lock( in_reader->statsLock );
+            gl::frameReaderStats_t& stats = in_reader->stats;
+            stats.minLatency = ( stats.delivered == 0 ) ? frame.latency : std::min( stats.minLatency, frame.latency );
+            stats.maxLatency = std::max( stats.maxLatency, frame.latency );
+            stats.delivered++;
+            in_reader->latencySum += frame.latency;
+        }
+
+        in_reader->createInfo.consumer( &frame, in_reader->createInfo.userData );
+
+        std::lock_guard<std::mutex> lock( in_reader->lock );
+        slot.state = READER_SLOT_FREE;
+        in_reader->freed.notify_all();
+    }
+}
+
+static void HandOver( glCoreFrameReader_t* in_reader )
+{
+    readerSlot_t& slot = in_reader->slots[in_reader->oldest];
+
+    glDeleteSync( slot.fence );
+    slot.fence = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock( in_reader->lock );
+        slot.state = READER_SLOT_QUEUED;
+        in_reader->queue.push_back( in_reader->oldest );
+    }
+    in_reader->wake.notify_one();
+
+    in_reader->oldest = ( in_reader->oldest + 1 ) % in_reader->createInfo.depth;
+    in_reader->inFlight--;
+}
+
+gl::FrameReader::FrameReader( void ) : m_reader( nullptr )
+{
+}
+
+gl::FrameReader::~FrameReader( void )
+{
+    Destroy();
+}
+
+bool gl::FrameReader::Create( const createInfo_t* in_createInfo )
+{
+    if ( in_createInfo == nullptr || in_createInfo->consumer == nullptr || in_createInfo->width == 0 || in_createInfo->height == 0 )
+        return false;
+
+    Destroy();
+
+    m_reader = new glCoreFrameReader_t();
+    m_reader->createInfo = *in_createInfo;
+    m_reader->createInfo.depth = std::max<GLuint>( in_createInfo->depth, 1 );
+
+    const GLuint width = in_createInfo->width;
+    const GLuint height = in_createInfo->height;
+    if ( in_createInfo->converter != nullptr )
+    {
+        // the converter read a texture, the frame is blited to it
+        Texture::createInfo_t copyInfo;
+        copyInfo.target = texture::TEXTURE_2D;
+        copyInfo.format = in_createInfo->format;
+        copyInfo.dimensions.width = static_cast<GLsizei>( width );
+        copyInfo.dimensions.height = static_cast<GLsizei>( height );
+        
+        FrameBuffer::attachament_t attachament = { GL_TEXTURE_2D, GL_COLOR_ATTACHMENT0, 0 };
+        if ( !m_reader->copy.Create( &copyInfo ) )
+        {
+            Destroy();
+            return false;
+        }
+
+        attachament.handle = m_reader->copy.Handle();
+        m_reader->copyFrameBuffer.Create();
+        if ( !m_reader->copyFrameBuffer.Attach( &attachament, 0, 1 ) )
+        {
+            Destroy();
+            return false;
+        }
+
+        m_reader->size = in_createInfo->converter->OutputSize( width, height );
+    }
+    else
+        m_reader->size = static_cast<GLsizeiptr>( in_createInfo->format.ImageSize( width, height, 1 ) );
+
+    // persistent coherent mapping, the consumer thread read it whitout GL calls
+    const GLbitfield flags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    m_reader->slots.reset( new readerSlot_t[m_reader->createInfo.depth] );
+    for ( GLuint i = 0; i < m_reader->createInfo.depth; i++ )
+    {
+        readerSlot_t& slot = m_reader->slots[i];
+        slot.buffer.Create( GL_PIXEL_PACK_BUFFER, m_reader->size, nullptr, flags );
+        slot.mapped = slot.buffer.Map( 0, m_reader->size, flags );
+        if ( slot.mapped == nullptr )
+        {
+            Destroy();
+            return false;
+        }
+    }
+
+    m_reader->thread = std::thread( ConsumerLoop, m_reader );
+    return true;
+}
+
+void gl::FrameReader::Destroy( void )
+{
+    if ( m_reader == nullptr )
+        return;
+
+    if ( m_reader->thread.joinable() )
+    {
+        Flush();
+
+        {
+            std::lock_guard<std::mutex> lock( m_reader->lock );
+            m_reader->quit = true;
+        }
+        m_reader->wake.notify_all();
+        m_reader->thread.join();
+    }
+
+    if ( m_reader->slots != nullptr )
+    {
+        for ( GLuint i = 0; i < m_reader->createInfo.depth; i++ )
+        {
+            readerSlot_t& slot = m_reader->slots[i];
+            if ( slot.mapped != nullptr )
+                slot.buffer.Unmap();
+            slot.buffer.Destroy();
+        }
+    }
+
+    m_reader->copyFrameBuffer.Destroy();
+    m_reader->copy.Destroy();
+
+    delete m_reader;
+    m_reader = nullptr;
+}
+
+bool gl::FrameReader::Capture( const GLuint in_framebuffer, const GLenum in_readBuffer )
+{
+    Context* context = Context::Current();
+    if ( m_reader == nullptr || context == nullptr )
+        return false;
+
+    // counted before the drop, the consumer see the gaps in the sequence
+    const uint64_t index = m_reader->captures++;
+    const GLenum readBuffer = ( in_readBuffer != GL_NONE ) ? in_readBuffer : ( in_framebuffer == 0 ) ? GL_BACK : GL_COLOR_ATTACHMENT0;
+
+    Poll();
+
+    readerSlot_t& slot = m_reader->slots[m_reader->next];
+    const createInfo_t& createInfo = m_reader->createInfo;
+    const GLsizei width = static_cast<GLsizei>( createInfo.width );
+    const GLsizei height = static_cast<GLsizei>( createInfo.height );
+    {
+        std::unique_lock<std::mutex> lock( m_reader->lock );
+        if ( slot.state != READER_SLOT_FREE )
+        {
+            if ( createInfo.dropWhenFull )
+            {
+                std::lock_guard<std::mutex> statsLock( m_reader->statsLock );
+                m_reader->stats.dropped++;
+                return false;
+            }
+
+            // the ring is in order, this slot hold the oldest readback
+            if ( slot.state == READER_SLOT_GPU )
+            {
+                lock.unlock();
+                glClientWaitSync( slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED );
+                HandOver( m_reader );
+                lock.lock();
+            }
+
+            m_reader->freed.wait( lock, [&slot]( void ) { return slot.state == READER_SLOT_FREE; } );
+        }
+    }
+
+    glNamedFramebufferReadBuffer( in_framebuffer, readBuffer );
+    if ( createInfo.converter != nullptr )
+    {
+        glBlitNamedFramebuffer( in_framebuffer, m_reader->copyFrameBuffer.Handler(), 0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_NEAREST );
+        createInfo.converter->Convert( m_reader->copy.Handle(), createInfo.width, createInfo.height, slot.buffer.GetHandle() );
+        
+        // shader writes to a persistent mapping
+        glMemoryBarrier( GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT );
+    }
+    else
+    {
+        GLint alignment = 4;
+        GLuint previous = context->BindFrameBuffer( in_framebuffer );
+        
+        glGetIntegerv( GL_PACK_ALIGNMENT, &alignment );
+        glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+        glBindBuffer( GL_PIXEL_PACK_BUFFER, slot.buffer.GetHandle() );
+        glReadPixels( 0, 0, width, height, createInfo.format.ColorChanels( false ), createInfo.format.DataType(), nullptr );
+        glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 );
+        glPixelStorei( GL_PACK_ALIGNMENT, alignment );
+        
+        context->BindFrameBuffer( previous );
+    }
+
+    slot.fence = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+    slot.index = index;
+    slot.captured = readerClock_t::now();
+    {
+        std::lock_guard<std::mutex> lock( m_reader->lock );
+        slot.state = READER_SLOT_GPU;
+    }
+
+    // get the readback going
+    glFlush();
+
+    m_reader->next = ( m_reader->next + 1 ) % createInfo.depth;
+    m_reader->inFlight++;
+
+    std::lock_guard<std::mutex> statsLock( m_reader->statsLock );
+    m_reader->stats.captured++;
+    return true;
+}
+
+GLuint gl::FrameReader::Poll( void )
+{
+    GLuint count = 0;
+
+    if ( m_reader == nullptr )
+        return 0;
+
+    // finished in capture order
+    while ( m_reader->inFlight > 0 )
+    {
+        readerSlot_t& slot = m_reader->slots[m_reader->oldest];
+        if ( glClientWaitSync( slot.fence, 0, 0 ) == GL_TIMEOUT_EXPIRED )
+            break;
+
+        HandOver( m_reader );
+        count++;
+    }
+
+    return count;
+}
+
+void gl::FrameReader::Flush( void )
+{
+    if ( m_reader == nullptr )
+        return;
+
+    while ( m_reader->inFlight > 0 )
+    {
+        glClientWaitSync( m_reader->slots[m_reader->oldest].fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED );
+        HandOver( m_reader );
+    }
+
+    std::unique_lock<std::mutex> lock( m_reader->lock );
+    m_reader->freed.wait( lock, [this]( void ) 
+    { 
+        for ( GLuint i = 0; i < m_reader->createInfo.depth; i++ )
+        {
+            if ( m_reader->slots[i].state != READER_SLOT_FREE )
+                return false;
+        }
+        return true;
+    } );
+}
+
+gl::frameReaderStats_t gl::FrameReader::Stats( void ) const
+{
+    frameReaderStats_t stats;
+    if ( m_reader == nullptr )
+        return stats;
+
+    std::lock_guard<std::mutex> lock( m_reader->statsLock );
+    stats = m_reader->stats;
+    stats.meanLatency = ( stats.delivered > 0 ) ? m_reader->latencySum / stats.delivered : 0;
+    return stats;
+}
+
+void gl::FrameReader::ResetStats( void )
+{
+    if ( m_reader == nullptr )
+        return;
+
+    std::lock_guard<std::mutex> lock( m_reader->statsLock );
+    m_reader->stats = frameReaderStats_t();
+    m_reader->latencySum = 0;
+}
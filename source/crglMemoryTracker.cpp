@@ -0,0 +1,396 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#include "crglPrecompiled.hpp"
+#include "crglMemoryTracker.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+static const char* k_MEMORY_RESOURCE_NAMES[gl::MEMORY_RESOURCE_COUNT] = { "buffers", "textures", "renderbuffers" };
+
+typedef struct memoryCategory_t
+{
+    std::string         name;
+    gl::memoryUsage_t   usage;
+} memoryCategory_t;
+
+typedef struct glCoreMemoryTracker_t
+{
+    mutable std::mutex                                      lock;
+    gl::memoryUsage_t                                       total;
+    gl::memoryUsage_t                                       resources[gl::MEMORY_RESOURCE_COUNT];
+    std::unordered_map<GLuint, memoryCategory_t>            categories;
+    std::unordered_map<uint64_t, gl::memoryAllocation_t>    allocations;
+    std::vector<GLuint>                                     categoryStack;
+    uint64_t                                                serial = 0;
+} glCoreMemoryTracker_t;
+
+// live trackers, so a resource can untrack after its tracker context is gone
+static std::mutex                                               s_trackersLock;
+static std::unordered_map<const gl::MemoryTracker*, uint64_t>   s_trackers;
+static std::atomic<uint64_t>                                    s_trackerSerial{ 0 };
+
+static uint64_t AllocationKey( const gl::memoryResource_t in_resource, const GLuint in_name )
+{
+    return ( static_cast<uint64_t>( in_resource ) << 32 ) | in_name;
+}
+
+static void AddUsage( gl::memoryUsage_t* in_usage, const uint64_t in_bytes )
+{
+    in_usage->bytes += in_bytes;
+    in_usage->allocations++;
+    in_usage->highWater = std::max( in_usage->highWater, in_usage->bytes );
+}
+
+static void RemoveUsage( gl::memoryUsage_t* in_usage, const uint64_t in_bytes )
+{
+    in_usage->bytes -= std::min( in_usage->bytes, in_bytes );
+    if ( in_usage->allocations > 0 )
+        in_usage->allocations--;
+}
+
+static uint64_t StorageSize( const gl::Format in_format, const GLsizei in_width, const GLsizei in_height, const GLsizei in_depth, bool* in_estimated )
+{
+    // generic compressed, assume the driver keep it at 4:1 ( DXT5 like )
+    if ( in_format.IsGeneric() )
+    {
+        *in_estimated = true;
+        return gl::Format( GL_COMPRESSED_RGBA_S3TC_DXT5_EXT ).StorageSize( in_width, in_height, in_depth );
+    }
+
+    // unknow format, assume RGBA8
+    if ( in_format.Info() == nullptr )
+    {
+        *in_estimated = true;
+        return gl::Format( GL_RGBA8 ).StorageSize( in_width, in_height, in_depth );
+    }
+
+    return in_format.StorageSize( in_width, in_height, in_depth );
+}
+
+gl::MemoryTracker::MemoryTracker( void ) : m_tracker( new glCoreMemoryTracker_t() )
+{
+    m_tracker->serial = ++s_trackerSerial;
+
+    std::lock_guard<std::mutex> lock( s_trackersLock );
+    s_trackers[this] = m_tracker->serial;
+}
+
+gl::MemoryTracker::~MemoryTracker( void )
+{
+    {
+        std::lock_guard<std::mutex> lock( s_trackersLock );
+        s_trackers.erase( this );
+    }
+
+    delete m_tracker;
+    m_tracker = nullptr;
+}
+
+gl::memoryOwner_t gl::MemoryTracker::Track( const memoryResource_t in_resource, const GLuint in_name, const uint64_t in_bytes, const bool in_estimated )
+{
+    memoryAllocation_t allocation{};
+    memoryOwner_t owner;
+    std::lock_guard<std::mutex> lock( m_tracker->lock );
+
+    owner.tracker = this;
+    owner.serial = m_tracker->serial;
+
+    allocation.resource = in_resource;
+    allocation.name = in_name;
+    allocation.category = m_tracker->categoryStack.empty() ? k_MEMORY_CATEGORY_DEFAULT : m_tracker->categoryStack.back();
+    allocation.bytes = in_bytes;
+    allocation.estimated = in_estimated;
+
+    // the name was reused whitout a untrack, drop the old one
+    auto old = m_tracker->allocations.find( AllocationKey( in_resource, in_name ) );
+    if ( old != m_tracker->allocations.end() )
+    {
+        RemoveUsage( &m_tracker->total, old->second.bytes );
+        RemoveUsage( &m_tracker->resources[in_resource], old->second.bytes );
+        RemoveUsage( &m_tracker->categories[old->second.category].usage, old->second.bytes );
+    }
+
+    m_tracker->allocations[AllocationKey( in_resource, in_name )] = allocation;
+    AddUsage( &m_tracker->total, in_bytes );
+    AddUsage( &m_tracker->resources[in_resource], in_bytes );
+    AddUsage( &m_tracker->categories[allocation.category].usage, in_bytes );
+    return owner;
+}
+
+void gl::MemoryTracker::Untrack( const memoryResource_t in_resource, const GLuint in_name )
+{
+    std::lock_guard<std::mutex> lock( m_tracker->lock );
+
+    auto allocation = m_tracker->allocations.find( AllocationKey( in_resource, in_name ) );
+    if ( allocation == m_tracker->allocations.end() )
+        return;
+
+    RemoveUsage( &m_tracker->total, allocation->second.bytes );
+    RemoveUsage( &m_tracker->resources[in_resource], allocation->second.bytes );
+    RemoveUsage( &m_tracker->categories[allocation->second.category].usage, allocation->second.bytes );
+    m_tracker->allocations.erase( allocation );
+}
+
+void gl::MemoryTracker::Untrack( const memoryOwner_t& in_owner, const memoryResource_t in_resource, const GLuint in_name )
+{
+    if ( in_owner.tracker == nullptr )
+        return;
+
+    // held during the untrack, the tracker can't be destroyed under us
+    std::lock_guard<std::mutex> lock( s_trackersLock );
+    auto tracker = s_trackers.find( in_owner.tracker );
+    if ( tracker == s_trackers.end() || tracker->second != in_owner.serial )
+        return;
+
+    in_owner.tracker->Untrack( in_resource, in_name );
+}
+
+void gl::MemoryTracker::PushCategory( const GLuint in_category )
+{
+    std::lock_guard<std::mutex> lock( m_tracker->lock );
+    m_tracker->categoryStack.push_back( in_category );
+}
+
+void gl::MemoryTracker::PopCategory( void )
+{
+    std::lock_guard<std::mutex> lock( m_tracker->lock );
+    if ( !m_tracker->categoryStack.empty() )
+        m_tracker->categoryStack.pop_back();
+}
+
+void gl::MemoryTracker::SetCategoryName( const GLuint in_category, const char* in_name )
+{
+    std::lock_guard<std::mutex> lock( m_tracker->lock );
+    m_tracker->categories[in_category].name = ( in_name != nullptr ) ? in_name : "";
+}
+
+const char* gl::MemoryTracker::CategoryName( const GLuint in_category ) const
+{
+    std::lock_guard<std::mutex> lock( m_tracker->lock );
+    auto category = m_tracker->categories.find( in_category );
+    if ( category == m_tracker->categories.end() || category->second.name.empty() )
+        return nullptr;
+
+    return category->second.name.c_str();
+}
+
+void gl::MemoryTracker::SetBudget( const GLuint in_category, const uint64_t in_bytes )
+{
+    std::lock_guard<std::mutex> lock( m_tracker->lock );
+    m_tracker->categories[in_category].usage.budget = in_bytes;
+}
+
+bool gl::MemoryTracker::IsOverBudget( const GLuint in_category ) const
+{
+    memoryUsage_t usage = Category( in_category );
+    return usage.budget != 0 && usage.bytes > usage.budget;
+}
+
+gl::memoryUsage_t gl::MemoryTracker::Total( void ) const
+{
+    std::lock_guard<std::mutex> lock( m_tracker->lock );
+    return m_tracker->total;
+}
+
+gl::memoryUsage_t gl::MemoryTracker::Resource( const memoryResource_t in_resource ) const
+{
+    std::lock_guard<std::mutex> lock( m_tracker->lock );
+    if ( in_resource >= MEMORY_RESOURCE_COUNT )
+        return {};
+
+    return m_tracker->resources[in_resource];
+}
+
+gl::memoryUsage_t gl::MemoryTracker::Category( const GLuint in_category ) const
+{
+    std::lock_guard<std::mutex> lock( m_tracker->lock );
+    auto category = m_tracker->categories.find( in_category );
+    if ( category == m_tracker->categories.end() )
+        return {};
+
+    return category->second.usage;
+}
+
+GLuint gl::MemoryTracker::Largest( memoryAllocation_t* in_allocations, const GLuint in_count ) const
+{
+    std::vector<memoryAllocation_t> sorted;
+    GLuint count = 0;
+
+    if ( in_allocations == nullptr || in_count == 0 )
+        return 0;
+
+    {
+        std::lock_guard<std::mutex> lock( m_tracker->lock );
+        sorted.reserve( m_tracker->allocations.size() );
+        for ( const auto& allocation : m_tracker->allocations )
+            sorted.push_back( allocation.second );
+    }
+
+    count = static_cast<GLuint>( std::min<size_t>( in_count, sorted.size() ) );
+    std::partial_sort( sorted.begin(), sorted.begin() + count, sorted.end(), 
+        []( const memoryAllocation_t& a, const memoryAllocation_t& b ) { return a.bytes > b.bytes; } );
+
+    std::memcpy( in_allocations, sorted.data(), sizeof( memoryAllocation_t ) * count );
+    return count;
+}
+
+void gl::MemoryTracker::Report( const Context* in_context ) const
+{
+    char line[256];
+    memoryAllocation_t largest[8];
+    GLuint numLargest = 0;
+    memoryUsage_t total = Total();
+
+    if ( in_context == nullptr )
+        return;
+
+    std::snprintf( line, 256, " * GPU memory: %llu bytes in %llu allocations, high water %llu bytes\n", 
+        static_cast<unsigned long long>( total.bytes ),
+        static_cast<unsigned long long>( total.allocations ),
+        static_cast<unsigned long long>( total.highWater ) );
+    in_context->DebugOuput( line );
+
+    for ( GLuint i = 0; i < MEMORY_RESOURCE_COUNT; i++ )
+    {
+        memoryUsage_t usage = Resource( static_cast<memoryResource_t>( i ) );
+        std::snprintf( line, 256, " *   %s: %llu bytes in %llu allocations, high water %llu bytes\n", 
+            k_MEMORY_RESOURCE_NAMES[i],
+            static_cast<unsigned long long>( usage.bytes ),
+            static_cast<unsigned long long>( usage.allocations ),
+            static_cast<unsigned long long>( usage.highWater ) );
+        in_context->DebugOuput( line );
+    }
+
+    {
+        std::lock_guard<std::mutex> lock( m_tracker->lock );
+        for ( const auto& category : m_tracker->categories )
+        {
+            std::snprintf( line, 256, " *   category %u %s: %llu bytes, high water %llu bytes%s\n", 
+                category.first,
+                category.second.name.c_str(),
+                static_cast<unsigned long long>( category.second.usage.bytes ),
+                static_cast<unsigned long long>( category.second.usage.highWater ),
+                ( category.second.usage.budget != 0 && category.second.usage.bytes > category.second.usage.budget ) ? " ( OVER BUDGET )" : "" );
+            in_context->DebugOuput( line );
+        }
+    }
+
+    numLargest = Largest( largest, 8 );
+    for ( GLuint i = 0; i < numLargest; i++ )
+    {
+        std::snprintf( line, 256, " *   %s %u: %llu bytes%s\n", 
+            k_MEMORY_RESOURCE_NAMES[largest[i].resource],
+            largest[i].name,
+            static_cast<unsigned long long>( largest[i].bytes ),
+            largest[i].estimated ? " ( estimated )" : "" );
+        in_context->DebugOuput( line );
+    }
+}
+
+uint64_t gl::MemoryTracker::TextureSize( const Texture::createInfo_t* in_createInfo, bool* in_estimated )
+{
+    uint64_t size = 0;
+    bool estimated = false;
+    GLsizei width = 0;
+    GLsizei height = 0;
+    GLsizei depth = 0;
+    GLsizei layers = 1;
+    GLsizei levels = 1;
+    GLsizei samples = 1;
+
+    if ( in_createInfo == nullptr )
+        return 0;
+
+    width = in_createInfo->dimensions.width;
+    height = std::max( in_createInfo->dimensions.height, 1 );
+    depth = 1;
+    levels = std::max( in_createInfo->levels, 1 );
+    
+    switch ( in_createInfo->target )
+    {
+    case texture::TEXTURE_1D:
+        height = 1;
+        break;
+    case texture::TEXTURE_1D_ARRAY:
+        height = 1;
+        layers = in_createInfo->layers;
+        break;
+    case texture::TEXTURE_2D:
+    case texture::TEXTURE_RECTANGLE:
+        break;
+    case texture::TEXTURE_3D:
+        depth = in_createInfo->dimensions.depth;
+        break;
+    case texture::TEXTURE_2D_ARRAY:
+        layers = in_createInfo->layers;
+        break;
+    case texture::TEXTURE_CUBE_MAP:
+        layers = 6;
+        break;
+    case texture::TEXTURE_CUBE_MAP_ARRAY:
+        layers = in_createInfo->layers * 6;
+        break;
+    case texture::TEXTURE_2D_MULTISAMPLE:
+        levels = 1;
+        samples = in_createInfo->samples;
+        break;
+    case texture::TEXTURE_2D_MULTISAMPLE_ARRAY:
+        levels = 1;
+        samples = in_createInfo->samples;
+        layers = in_createInfo->dimensions.depth;
+        break;
+    default:
+        return 0;
+    }
+
+    for ( GLsizei level = 0; level < levels; level++ )
+    {
+        size += StorageSize( in_createInfo->format, 
+                             std::max( width >> level, 1 ), 
+                             std::max( height >> level, 1 ), 
+                             std::max( depth >> level, 1 ), 
+                             &estimated );
+    }
+
+    size *= static_cast<uint64_t>( std::max( layers, 1 ) ) * static_cast<uint64_t>( std::max( samples, 1 ) );
+
+    if ( in_estimated != nullptr )
+        *in_estimated = estimated;
+
+    return size;
+}
+
+uint64_t gl::MemoryTracker::RenderBufferSize( const GLuint in_width, const GLuint in_height, const GLuint in_samples, const Format in_format, bool* in_estimated )
+{
+    bool estimated = false;
+    uint64_t size = StorageSize( in_format, static_cast<GLsizei>( in_width ), static_cast<GLsizei>( in_height ), 1, &estimated );
+    
+    if ( in_estimated != nullptr )
+        *in_estimated = estimated;
+
+    return size * std::max<GLuint>( in_samples, 1 );
+}
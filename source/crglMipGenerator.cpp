@@ -0,0 +1,1324 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#include "crglPrecompiled.hpp"
+#include "crglMipGenerator.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined( __x86_64__ ) || defined( _M_X64 ) || defined( __i386__ ) || defined( _M_IX86 )
+#define CRGL_MIP_X86 1
+#include <immintrin.h>
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#define CRGL_MIP_NEON 1
+#include <arm_neon.h>
+#endif
+
+// the AVX2 kernels are built whit the target attribute and selected at runtime,
+// the library itself keep the baseline instruction set
+#if defined( __GNUC__ ) || defined( __clang__ )
+#define CRGL_MIP_TARGET( x )    __attribute__( ( target( x ) ) )
+#else
+#define CRGL_MIP_TARGET( x )
+#endif
+
+typedef std::chrono::steady_clock   mipClock_t;
+
+/// @brief filter weights of a axis, every destine pixel use the same number of taps
+typedef struct mipTaps_t
+{
+    GLuint                  taps = 0;
+    std::vector<GLuint>     indices;    // source pixel of each tap, destine size * taps
+    std::vector<float>      weights;
+} mipTaps_t;
+
+/// @brief one output pixel, RGBA float, from in_width pixels
+typedef void ( *horizontalKernel_t )( const float* in_source, const mipTaps_t* in_taps, float* in_destine, const GLuint in_width );
+
+/// @brief in_count floats, weighted sum of in_taps rows
+typedef void ( *verticalKernel_t )( const float* const* in_rows, const float* in_weights, const GLuint in_taps, float* in_destine, const GLuint in_count );
+
+struct glCoreMipGenerator_t;
+typedef void ( *mipJob_t )( glCoreMipGenerator_t* in_generator, const GLuint in_begin, const GLuint in_end );
+
+/// @brief the level in progress, shared whit the workers
+typedef struct mipPass_t
+{
+    const gl::formatInfo_t*     format = nullptr;
+    bool                        srgb = false;
+    const uint8_t*              source = nullptr;   // encoded level 0
+    const float*                input = nullptr;    // linear source level
+    GLuint                      inputWidth = 0;
+    GLuint                      inputHeight = 0;
+    float*                      scratch = nullptr;  // horizontal pass, output width * input height
+    float*                      output = nullptr;   // linear destine level
+    GLuint                      outputWidth = 0;
+    GLuint                      outputHeight = 0;
+    uint8_t*                    encoded = nullptr;  // destine level in the format
+    float                       alphaScale = 1.0f;
+    float                       alphaReference = 0.0f;  // 0 when the coverage is not kept
+    std::atomic<uint64_t>       covered{ 0 };           // base level pixels above the reference
+    mipTaps_t                   tapsX;
+    mipTaps_t                   tapsY;
+} mipPass_t;
+
+typedef struct glCoreMipGenerator_t
+{
+    gl::MipGenerator::createInfo_t      createInfo;
+    gl::mipSimd_t                       simd = gl::MIP_SIMD_NONE;
+    horizontalKernel_t                  horizontal = nullptr;
+    verticalKernel_t                    vertical = nullptr;
+
+    // parallel for
+    std::vector<std::thread>            threads;
+    std::mutex                          lock;
+    std::condition_variable             wake;
+    std::condition_variable             finished;
+    uint64_t                            generation = 0;
+    bool                                quit = false;
+    mipJob_t                            job = nullptr;
+    GLuint                              jobCount = 0;
+    GLuint                              jobChunk = 1;
+    std::atomic<GLuint>                 jobNext{ 0 };
+    GLuint                              busy = 0;
+
+    // last image
+    mipPass_t                           pass;
+    std::vector<float>                  linear[2];      // previous and current levels
+    std::vector<float>                  scratch;
+    std::vector<std::vector<uint8_t>>   levels;         // encoded levels, from 1
+    gl::mipLevel_t                      base;
+    gl::mipGeneratorStats_t             stats;
+} glCoreMipGenerator_t;
+
+// ============================================================================================
+// number conversions
+// ============================================================================================
+
+static float HalfToFloat( const uint16_t in_half )
+{
+    const uint32_t sign = static_cast<uint32_t>( in_half & 0x8000 ) << 16;
+    const uint32_t exponent = ( in_half >> 10 ) & 0x1f;
+    const uint32_t mantissa = in_half & 0x3ff;
+    uint32_t bits = 0;
+    float value = 0.0f;
+
+    if ( exponent == 0 )
+    {
+        value = static_cast<float>( mantissa ) * ( 1.0f / 16777216.0f );
+        return ( sign != 0 ) ? -value : value;
+    }
+
+    if ( exponent == 31 )
+        bits = sign | 0x7f800000 | ( mantissa << 13 );
+    else
+        bits = sign | ( ( exponent + 112 ) << 23 ) | ( mantissa << 13 );
+
+    std::memcpy( &value, &bits, sizeof( value ) );
+    return value;
+}
+
+/// @brief round to nearest even
+static uint16_t FloatToHalf( const float in_value )
+{
+    uint32_t bits = 0;
+    std::memcpy( &bits, &in_value, sizeof( bits ) );
+    const uint32_t sign = ( bits >> 16 ) & 0x8000;
+    const uint32_t magnitude = bits & 0x7fffffff;
+
+    // inf and nan
+    if ( magnitude >= 0x7f800000 )
+        return static_cast<uint16_t>( sign | ( ( magnitude > 0x7f800000 ) ? 0x7e00 : 0x7c00 ) );
+
+    // overflow, rounds to infinity
+    if ( magnitude >= 0x477ff000 )
+        return static_cast<uint16_t>( sign | 0x7c00 );
+
+    // subnormal, in units of 2^-24
+    if ( magnitude < 0x38800000 )
+    {
+        float absolute = 0.0f;
+        std::memcpy( &absolute, &magnitude, sizeof( absolute ) );
+        return static_cast<uint16_t>( sign | static_cast<uint32_t>( std::nearbyint( absolute * 16777216.0f ) ) );
+    }
+
+    uint32_t half = ( magnitude - 0x38000000 ) >> 13;
+    const uint32_t rest = magnitude & 0x1fff;
+    if ( rest > 0x1000 || ( rest == 0x1000 && ( half & 1 ) != 0 ) )
+        half++;
+
+    return static_cast<uint16_t>( sign | half );
+}
+
+/// @brief unsigned 5 bits exponent floats of the R11F_G11F_B10F format
+static float SmallFloatToFloat( const uint32_t in_value, const GLuint in_mantissaBits )
+{
+    const uint32_t mantissa = in_value & ( ( 1u << in_mantissaBits ) - 1 );
+    const uint32_t exponent = in_value >> in_mantissaBits;
+    return HalfToFloat( static_cast<uint16_t>( ( exponent << 10 ) | ( mantissa << ( 10 - in_mantissaBits ) ) ) );
+}
+
+static uint32_t FloatToSmallFloat( const float in_value, const GLuint in_mantissaBits )
+{
+    const uint32_t largest = ( 30u << in_mantissaBits ) | ( ( 1u << in_mantissaBits ) - 1 );
+    if ( !( in_value > 0.0f ) )
+        return 0;
+
+    const uint32_t half = FloatToHalf( in_value );
+    if ( half >= 0x7c00 )
+        return largest;
+
+    // round the half mantissa to the shorter one
+    const GLuint shift = 10 - in_mantissaBits;
+    uint32_t result = half >> shift;
+    const uint32_t rest = half & ( ( 1u << shift ) - 1 );
+    const uint32_t middle = 1u << ( shift - 1 );
+    if ( rest > middle || ( rest == middle && ( result & 1 ) != 0 ) )
+        result++;
+
+    return std::min( result, largest );
+}
+
+static void DecodeRgb9e5( const uint32_t in_value, float* in_rgb )
+{
+    const int exponent = static_cast<int>( in_value >> 27 ) - 15 - 9;
+    const float scale = std::ldexp( 1.0f, exponent );
+    in_rgb[0] = static_cast<float>( in_value & 0x1ff ) * scale;
+    in_rgb[1] = static_cast<float>( ( in_value >> 9 ) & 0x1ff ) * scale;
+    in_rgb[2] = static_cast<float>( ( in_value >> 18 ) & 0x1ff ) * scale;
+}
+
+/// @brief shared exponent encoding from the EXT_texture_shared_exponent specification
+static uint32_t EncodeRgb9e5( const float* in_rgb )
+{
+    static const float k_MAX = 65408.0f;
+    float rgb[3];
+    for ( GLuint i = 0; i < 3; i++ )
+        rgb[i] = ( in_rgb[i] > 0.0f ) ? std::min( in_rgb[i], k_MAX ) : 0.0f;
+
+    const float largest = std::max( rgb[0], std::max( rgb[1], rgb[2] ) );
+    if ( largest < 1.0f / 16777216.0f )
+        return 0;
+
+    int exponent = std::max( -16, static_cast<int>( std::floor( std::log2( largest ) ) ) ) + 1 + 15;
+    float denominator = std::ldexp( 1.0f, exponent - 15 - 9 );
+    if ( std::floor( largest / denominator + 0.5f ) == 512.0f )
+    {
+        denominator *= 2.0f;
+        exponent++;
+    }
+
+    uint32_t result = static_cast<uint32_t>( exponent ) << 27;
+    for ( GLuint i = 0; i < 3; i++ )
+        result |= std::min( static_cast<uint32_t>( std::floor( rgb[i] / denominator + 0.5f ) ), 511u ) << ( i * 9 );
+
+    return result;
+}
+
+/// @brief sRGB decode table and the encode rounding thresholds
+typedef struct srgbTables_t
+{
+    static constexpr GLuint k_COARSE_SIZE = 4096;
+
+    float   decode[256];
+    float   thresholds[255];                // linear value between two consecutive codes
+    uint8_t coarse[k_COARSE_SIZE];          // code at the start of each linear interval, at most one code below the exact one
+
+    srgbTables_t( void )
+    {
+        for ( GLuint i = 0; i < 256; i++ )
+            decode[i] = ToLinear( static_cast<float>( i ) / 255.0f );
+
+        for ( GLuint i = 0; i < 255; i++ )
+            thresholds[i] = ToLinear( ( static_cast<float>( i ) + 0.5f ) / 255.0f );
+
+        for ( GLuint i = 0; i < k_COARSE_SIZE; i++ )
+        {
+            const float value = static_cast<float>( i ) / static_cast<float>( k_COARSE_SIZE );
+            coarse[i] = static_cast<uint8_t>( std::upper_bound( thresholds, thresholds + 255, value ) - thresholds );
+        }
+    }
+
+    static float ToLinear( const float in_value )
+    {
+        return ( in_value <= 0.04045f ) ? in_value / 12.92f : std::pow( ( in_value + 0.055f ) / 1.055f, 2.4f );
+    }
+
+    uint8_t Encode( const float in_value ) const
+    {
+        if ( !( in_value > 0.0f ) )
+            return 0;
+
+        if ( in_value >= 1.0f )
+            return 255;
+
+        GLuint code = coarse[static_cast<GLuint>( in_value * static_cast<float>( k_COARSE_SIZE ) )];
+        while ( code < 255 && thresholds[code] <= in_value )
+            code++;
+
+        return static_cast<uint8_t>( code );
+    }
+} srgbTables_t;
+
+static const float* UnormTable( void )
+{
+    static const struct unormTable_t
+    {
+        float   values[256];
+        unormTable_t( void )
+        {
+            for ( GLuint i = 0; i < 256; i++ )
+                values[i] = static_cast<float>( i ) / 255.0f;
+        }
+    } table;
+
+    return table.values;
+}
+
+static const srgbTables_t& SrgbTables( void )
+{
+    static const srgbTables_t tables;
+    return tables;
+}
+
+// ============================================================================================
+// format decode / encode
+// ============================================================================================
+
+static bool IsPacked( const GLenum in_type )
+{
+    switch ( in_type )
+    {
+    case GL_UNSIGNED_BYTE_3_3_2:
+    case GL_UNSIGNED_SHORT_5_6_5:
+    case GL_UNSIGNED_SHORT_4_4_4_4:
+    case GL_UNSIGNED_SHORT_5_5_5_1:
+    case GL_UNSIGNED_INT_2_10_10_10_REV:
+    case GL_UNSIGNED_INT_10F_11F_11F_REV:
+    case GL_UNSIGNED_INT_5_9_9_9_REV:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/// @brief bits of the packed types, from the component 0 at the most significant ( or least for _REV ) bits
+static void PackedLayout( const GLenum in_type, GLuint* in_bits, GLuint* in_shifts )
+{
+    static const GLuint k_332[] = { 3, 3, 2 }, k_332_SHIFT[] = { 5, 2, 0 };
+    static const GLuint k_565[] = { 5, 6, 5 }, k_565_SHIFT[] = { 11, 5, 0 };
+    static const GLuint k_4444[] = { 4, 4, 4, 4 }, k_4444_SHIFT[] = { 12, 8, 4, 0 };
+    static const GLuint k_5551[] = { 5, 5, 5, 1 }, k_5551_SHIFT[] = { 11, 6, 1, 0 };
+    static const GLuint k_1010102[] = { 10, 10, 10, 2 }, k_1010102_SHIFT[] = { 0, 10, 20, 30 };
+
+    const GLuint* bits = nullptr;
+    const GLuint* shifts = nullptr;
+    GLuint count = 0;
+    switch ( in_type )
+    {
+    case GL_UNSIGNED_BYTE_3_3_2:            bits = k_332; shifts = k_332_SHIFT; count = 3; break;
+    case GL_UNSIGNED_SHORT_5_6_5:           bits = k_565; shifts = k_565_SHIFT; count = 3; break;
+    case GL_UNSIGNED_SHORT_4_4_4_4:         bits = k_4444; shifts = k_4444_SHIFT; count = 4; break;
+    case GL_UNSIGNED_SHORT_5_5_5_1:         bits = k_5551; shifts = k_5551_SHIFT; count = 4; break;
+    case GL_UNSIGNED_INT_2_10_10_10_REV:    bits = k_1010102; shifts = k_1010102_SHIFT; count = 4; break;
+    default: break;
+    }
+
+    for ( GLuint i = 0; i < count; i++ )
+    {
+        in_bits[i] = bits[i];
+        in_shifts[i] = shifts[i];
+    }
+}
+
+static uint32_t LoadPacked( const uint8_t* in_pixel, const GLuint in_size )
+{
+    uint8_t value8 = 0;
+    uint16_t value16 = 0;
+    uint32_t value32 = 0;
+    switch ( in_size )
+    {
+    case 1: std::memcpy( &value8, in_pixel, 1 ); return value8;
+    case 2: std::memcpy( &value16, in_pixel, 2 ); return value16;
+    default: std::memcpy( &value32, in_pixel, 4 ); return value32;
+    }
+}
+
+static void StorePacked( uint8_t* in_pixel, const GLuint in_size, const uint32_t in_value )
+{
+    const uint8_t value8 = static_cast<uint8_t>( in_value );
+    const uint16_t value16 = static_cast<uint16_t>( in_value );
+    switch ( in_size )
+    {
+    case 1: std::memcpy( in_pixel, &value8, 1 ); break;
+    case 2: std::memcpy( in_pixel, &value16, 2 ); break;
+    default: std::memcpy( in_pixel, &in_value, 4 ); break;
+    }
+}
+
+template<typename type_t>
+static float LoadComponent( const uint8_t* in_pixel, const GLuint in_component, const float in_scale, const float in_minimum )
+{
+    type_t value;
+    std::memcpy( &value, in_pixel + in_component * sizeof( type_t ), sizeof( type_t ) );
+    return std::max( static_cast<float>( value ) * in_scale, in_minimum );
+}
+
+template<typename type_t>
+static void StoreComponent( uint8_t* in_pixel, const GLuint in_component, const double in_value, const double in_minimum, const double in_maximum )
+{
+    const type_t value = static_cast<type_t>( std::nearbyint( std::min( std::max( in_value, in_minimum ), in_maximum ) ) );
+    std::memcpy( in_pixel + in_component * sizeof( type_t ), &value, sizeof( type_t ) );
+}
+
+static void DecodeRow( const mipPass_t* in_pass, const uint8_t* in_source, float* in_destine, const GLuint in_width )
+{
+    const gl::formatInfo_t* format = in_pass->format;
+    const GLenum type = format->type;
+    const GLuint components = format->components;
+    const GLuint size = format->bytesPerPixel;
+    const bool normalized = ( format->flags & gl::FORMAT_INTEGER ) == 0;
+    const float* srgb = in_pass->srgb ? SrgbTables().decode : nullptr;
+
+    // 8 bits normalized, the common case, straight from the tables
+    if ( type == GL_UNSIGNED_BYTE && normalized )
+    {
+        const float* unorm = UnormTable();
+        for ( GLuint x = 0; x < in_width; x++ )
+        {
+            const uint8_t* pixel = in_source + static_cast<size_t>( x ) * size;
+            float* color = in_destine + x * 4;
+            color[0] = 0.0f;
+            color[1] = 0.0f;
+            color[2] = 0.0f;
+            color[3] = 1.0f;
+            for ( GLuint c = 0; c < components; c++ )
+                color[c] = ( srgb != nullptr && c < 3 ) ? srgb[pixel[c]] : unorm[pixel[c]];
+        }
+        return;
+    }
+
+    for ( GLuint x = 0; x < in_width; x++ )
+    {
+        const uint8_t* pixel = in_source + static_cast<size_t>( x ) * size;
+        float* color = in_destine + x * 4;
+        color[0] = 0.0f;
+        color[1] = 0.0f;
+        color[2] = 0.0f;
+        color[3] = 1.0f;
+
+        if ( type == GL_UNSIGNED_INT_10F_11F_11F_REV )
+        {
+            const uint32_t value = LoadPacked( pixel, 4 );
+            color[0] = SmallFloatToFloat( value & 0x7ff, 6 );
+            color[1] = SmallFloatToFloat( ( value >> 11 ) & 0x7ff, 6 );
+            color[2] = SmallFloatToFloat( value >> 22, 5 );
+            continue;
+        }
+
+        if ( type == GL_UNSIGNED_INT_5_9_9_9_REV )
+        {
+            DecodeRgb9e5( LoadPacked( pixel, 4 ), color );
+            continue;
+        }
+
+        if ( IsPacked( type ) )
+        {
+            GLuint bits[4];
+            GLuint shifts[4];
+            PackedLayout( type, bits, shifts );
+            const uint32_t value = LoadPacked( pixel, size );
+            for ( GLuint c = 0; c < components; c++ )
+            {
+                const uint32_t maximum = ( 1u << bits[c] ) - 1;
+                const uint32_t field = ( value >> shifts[c] ) & maximum;
+                color[c] = normalized ? static_cast<float>( field ) / static_cast<float>( maximum ) : static_cast<float>( field );
+            }
+            continue;
+        }
+
+        for ( GLuint c = 0; c < components; c++ )
+        {
+            switch ( type )
+            {
+            case GL_UNSIGNED_BYTE:
+                color[c] = ( srgb != nullptr && c < 3 ) ? srgb[pixel[c]] : LoadComponent<uint8_t>( pixel, c, normalized ? 1.0f / 255.0f : 1.0f, 0.0f );
+                break;
+            case GL_BYTE:
+                color[c] = LoadComponent<int8_t>( pixel, c, normalized ? 1.0f / 127.0f : 1.0f, normalized ? -1.0f : -128.0f );
+                break;
+            case GL_UNSIGNED_SHORT:
+                color[c] = LoadComponent<uint16_t>( pixel, c, normalized ? 1.0f / 65535.0f : 1.0f, 0.0f );
+                break;
+            case GL_SHORT:
+                color[c] = LoadComponent<int16_t>( pixel, c, normalized ? 1.0f / 32767.0f : 1.0f, normalized ? -1.0f : -32768.0f );
+                break;
+            case GL_UNSIGNED_INT:
+                color[c] = LoadComponent<uint32_t>( pixel, c, 1.0f, 0.0f );
+                break;
+            case GL_INT:
+                color[c] = LoadComponent<int32_t>( pixel, c, 1.0f, -2147483648.0f );
+                break;
+            case GL_HALF_FLOAT:
+            {
+                uint16_t half = 0;
+                std::memcpy( &half, pixel + c * 2, 2 );
+                color[c] = HalfToFloat( half );
+            } break;
+            case GL_FLOAT:
+                std::memcpy( &color[c], pixel + c * 4, 4 );
+                break;
+            default:
+                break;
+            }
+        }
+    }
+}
+
+static void EncodeRow( const mipPass_t* in_pass, const float* in_source, uint8_t* in_destine, const GLuint in_width )
+{
+    const gl::formatInfo_t* format = in_pass->format;
+    const GLenum type = format->type;
+    const GLuint components = format->components;
+    const GLuint size = format->bytesPerPixel;
+    const bool normalized = ( format->flags & gl::FORMAT_INTEGER ) == 0;
+    const srgbTables_t* srgb = in_pass->srgb ? &SrgbTables() : nullptr;
+
+    if ( type == GL_UNSIGNED_BYTE && normalized )
+    {
+        for ( GLuint x = 0; x < in_width; x++ )
+        {
+            uint8_t* pixel = in_destine + static_cast<size_t>( x ) * size;
+            const float* color = in_source + x * 4;
+            for ( GLuint c = 0; c < components; c++ )
+            {
+                const float value = ( c == 3 ) ? color[c] * in_pass->alphaScale : color[c];
+                if ( srgb != nullptr && c < 3 )
+                    pixel[c] = srgb->Encode( value );
+                else
+                    pixel[c] = static_cast<uint8_t>( std::min( std::max( value, 0.0f ), 1.0f ) * 255.0f + 0.5f );
+            }
+        }
+        return;
+    }
+
+    for ( GLuint x = 0; x < in_width; x++ )
+    {
+        uint8_t* pixel = in_destine + static_cast<size_t>( x ) * size;
+        float color[4];
+        std::memcpy( color, in_source + x * 4, sizeof( color ) );
+        color[3] *= in_pass->alphaScale;
+
+        if ( type == GL_UNSIGNED_INT_10F_11F_11F_REV )
+        {
+            StorePacked( pixel, 4, FloatToSmallFloat( color[0], 6 ) | ( FloatToSmallFloat( color[1], 6 ) << 11 ) | ( FloatToSmallFloat( color[2], 5 ) << 22 ) );
+            continue;
+        }
+
+        if ( type == GL_UNSIGNED_INT_5_9_9_9_REV )
+        {
+            StorePacked( pixel, 4, EncodeRgb9e5( color ) );
+            continue;
+        }
+
+        if ( IsPacked( type ) )
+        {
+            GLuint bits[4];
+            GLuint shifts[4];
+            PackedLayout( type, bits, shifts );
+            uint32_t value = 0;
+            for ( GLuint c = 0; c < components; c++ )
+            {
+                const uint32_t maximum = ( 1u << bits[c] ) - 1;
+                const float scaled = normalized ? std::min( std::max( color[c], 0.0f ), 1.0f ) * static_cast<float>( maximum ) : std::min( std::max( color[c], 0.0f ), static_cast<float>( maximum ) );
+                value |= static_cast<uint32_t>( std::nearbyint( scaled ) ) << shifts[c];
+            }
+            StorePacked( pixel, size, value );
+            continue;
+        }
+
+        for ( GLuint c = 0; c < components; c++ )
+        {
+            const double value = color[c];
+            switch ( type )
+            {
+            case GL_UNSIGNED_BYTE:
+                if ( srgb != nullptr && c < 3 )
+                    pixel[c] = srgb->Encode( color[c] );
+                else
+                    StoreComponent<uint8_t>( pixel, c, normalized ? value * 255.0 : value, 0.0, 255.0 );
+                break;
+            case GL_BYTE:
+                StoreComponent<int8_t>( pixel, c, normalized ? value * 127.0 : value, normalized ? -127.0 : -128.0, 127.0 );
+                break;
+            case GL_UNSIGNED_SHORT:
+                StoreComponent<uint16_t>( pixel, c, normalized ? value * 65535.0 : value, 0.0, 65535.0 );
+                break;
+            case GL_SHORT:
+                StoreComponent<int16_t>( pixel, c, normalized ? value * 32767.0 : value, normalized ? -32767.0 : -32768.0, 32767.0 );
+                break;
+            case GL_UNSIGNED_INT:
+                StoreComponent<uint32_t>( pixel, c, value, 0.0, 4294967295.0 );
+                break;
+            case GL_INT:
+                StoreComponent<int32_t>( pixel, c, value, -2147483648.0, 2147483647.0 );
+                break;
+            case GL_HALF_FLOAT:
+            {
+                const uint16_t half = FloatToHalf( color[c] );
+                std::memcpy( pixel + c * 2, &half, 2 );
+            } break;
+            case GL_FLOAT:
+                std::memcpy( pixel + c * 4, &color[c], 4 );
+                break;
+            default:
+                break;
+            }
+        }
+    }
+}
+
+// ============================================================================================
+// filters
+// ============================================================================================
+
+static double Sinc( const double in_x )
+{
+    if ( std::fabs( in_x ) < 1e-6 )
+        return 1.0;
+
+    const double x = 3.14159265358979323846 * in_x;
+    return std::sin( x ) / x;
+}
+
+/// @brief modified Bessel function of the first kind, order 0
+static double BesselI0( const double in_x )
+{
+    double sum = 1.0;
+    double term = 1.0;
+    const double half = in_x * 0.5;
+    for ( GLuint k = 1; k < 32; k++ )
+    {
+        term *= ( half / k ) * ( half / k );
+        sum += term;
+        if ( term < sum * 1e-12 )
+            break;
+    }
+
+    return sum;
+}
+
+/// @brief filter radius, in source pixels at scale 1
+static double FilterRadius( const gl::mipFilter_t in_filter )
+{
+    return ( in_filter == gl::MIP_FILTER_BOX ) ? 0.5 : 3.0;
+}
+
+static double FilterWeight( const gl::mipFilter_t in_filter, const double in_x )
+{
+    static const double k_KAISER_ALPHA = 4.0;
+    static const double k_KAISER_WIDTH = 3.0;
+    const double x = std::fabs( in_x );
+    if ( x >= 3.0 )
+        return 0.0;
+
+    if ( in_filter == gl::MIP_FILTER_LANCZOS )
+        return Sinc( x ) * Sinc( x / 3.0 );
+
+    const double t = x / k_KAISER_WIDTH;
+    return Sinc( x ) * BesselI0( k_KAISER_ALPHA * std::sqrt( 1.0 - t * t ) ) / BesselI0( k_KAISER_ALPHA );
+}
+
+static GLuint TapIndex( const long in_index, const GLuint in_size, const bool in_wrap )
+{
+    const long size = static_cast<long>( in_size );
+    if ( in_wrap )
+        return static_cast<GLuint>( ( ( in_index % size ) + size ) % size );
+
+    return static_cast<GLuint>( std::min( std::max( in_index, 0l ), size - 1 ) );
+}
+
+static void BuildTaps( mipTaps_t* in_taps, const GLuint in_source, const GLuint in_destine, const gl::mipFilter_t in_filter, const bool in_wrap )
+{
+    const double scale = static_cast<double>( in_source ) / static_cast<double>( in_destine );
+    const double radius = FilterRadius( in_filter ) * scale;
+    std::vector<double> weights;
+
+    // the widest footprint
+    GLuint taps = 1;
+    for ( GLuint x = 0; x < in_destine; x++ )
+    {
+        const double center = ( x + 0.5 ) * scale;
+        const long first = static_cast<long>( std::floor( center - radius ) );
+        const long last = static_cast<long>( std::ceil( center + radius ) );
+        taps = std::max<GLuint>( taps, static_cast<GLuint>( last - first ) );
+    }
+
+    in_taps->taps = taps;
+    in_taps->indices.assign( static_cast<size_t>( in_destine ) * taps, 0 );
+    in_taps->weights.assign( static_cast<size_t>( in_destine ) * taps, 0.0f );
+    weights.resize( taps );
+
+    for ( GLuint x = 0; x < in_destine; x++ )
+    {
+        const double center = ( x + 0.5 ) * scale;
+        const long first = static_cast<long>( std::floor( center - radius ) );
+        double sum = 0.0;
+
+        for ( GLuint k = 0; k < taps; k++ )
+        {
+            const long index = first + static_cast<long>( k );
+            if ( in_filter == gl::MIP_FILTER_BOX )
+            {
+                // pixel area covered by the box
+                const double low = std::max( static_cast<double>( index ), center - radius );
+                const double high = std::min( static_cast<double>( index + 1 ), center + radius );
+                weights[k] = std::max( high - low, 0.0 );
+            }
+            else
+                weights[k] = FilterWeight( in_filter, ( index + 0.5 - center ) / scale );
+
+            sum += weights[k];
+        }
+
+        for ( GLuint k = 0; k < taps; k++ )
+        {
+            const size_t slot = static_cast<size_t>( x ) * taps + k;
+            in_taps->indices[slot] = TapIndex( first + static_cast<long>( k ), in_source, in_wrap );
+            in_taps->weights[slot] = static_cast<float>( ( sum != 0.0 ) ? weights[k] / sum : 0.0 );
+        }
+    }
+}
+
+// ============================================================================================
+// kernels
+// ============================================================================================
+
+static void HorizontalScalar( const float* in_source, const mipTaps_t* in_taps, float* in_destine, const GLuint in_width )
+{
+    const GLuint taps = in_taps->taps;
+    for ( GLuint x = 0; x < in_width; x++ )
+    {
+        const GLuint* indices = &in_taps->indices[static_cast<size_t>( x ) * taps];
+        const float* weights = &in_taps->weights[static_cast<size_t>( x ) * taps];
+        float color[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        for ( GLuint k = 0; k < taps; k++ )
+        {
+            const float* pixel = in_source + indices[k] * 4;
+            for ( GLuint c = 0; c < 4; c++ )
+                color[c] += pixel[c] * weights[k];
+        }
+
+        std::memcpy( in_destine + x * 4, color, sizeof( color ) );
+    }
+}
+
+/// @brief from in_first, the SIMD kernels finish the rows whit it
+static void VerticalTail( const float* const* in_rows, const float* in_weights, const GLuint in_taps, float* in_destine, const GLuint in_first, const GLuint in_count )
+{
+    for ( GLuint i = in_first; i < in_count; i++ )
+    {
+        float sum = 0.0f;
+        for ( GLuint k = 0; k < in_taps; k++ )
+            sum += in_rows[k][i] * in_weights[k];
+
+        in_destine[i] = sum;
+    }
+}
+
+static void VerticalScalar( const float* const* in_rows, const float* in_weights, const GLuint in_taps, float* in_destine, const GLuint in_count )
+{
+    VerticalTail( in_rows, in_weights, in_taps, in_destine, 0, in_count );
+}
+
+#if CRGL_MIP_X86
+CRGL_MIP_TARGET( "sse2" )
+static void HorizontalSse2( const float* in_source, const mipTaps_t* in_taps, float* in_destine, const GLuint in_width )
+{
+    const GLuint taps = in_taps->taps;
+    for ( GLuint x = 0; x < in_width; x++ )
+    {
+        const GLuint* indices = &in_taps->indices[static_cast<size_t>( x ) * taps];
+        const float* weights = &in_taps->weights[static_cast<size_t>( x ) * taps];
+        __m128 color = _mm_setzero_ps();
+        for ( GLuint k = 0; k < taps; k++ )
+            color = _mm_add_ps( color, _mm_mul_ps( _mm_loadu_ps( in_source + indices[k] * 4 ), _mm_set1_ps( weights[k] ) ) );
+
+        _mm_storeu_ps( in_destine + x * 4, color );
+    }
+}
+
+CRGL_MIP_TARGET( "sse2" )
+static void VerticalSse2( const float* const* in_rows, const float* in_weights, const GLuint in_taps, float* in_destine, const GLuint in_count )
+{
+    GLuint i = 0;
+    for ( ; i + 4 <= in_count; i += 4 )
+    {
+        __m128 sum = _mm_mul_ps( _mm_loadu_ps( in_rows[0] + i ), _mm_set1_ps( in_weights[0] ) );
+        for ( GLuint k = 1; k < in_taps; k++ )
+            sum = _mm_add_ps( sum, _mm_mul_ps( _mm_loadu_ps( in_rows[k] + i ), _mm_set1_ps( in_weights[k] ) ) );
+
+        _mm_storeu_ps( in_destine + i, sum );
+    }
+
+    VerticalTail( in_rows, in_weights, in_taps, in_destine, i, in_count );
+}
+
+/// @brief two output pixels per iteration, one per 128 bits lane
+CRGL_MIP_TARGET( "avx2,fma" )
+static void HorizontalAvx2( const float* in_source, const mipTaps_t* in_taps, float* in_destine, const GLuint in_width )
+{
+    const GLuint taps = in_taps->taps;
+    GLuint x = 0;
+    for ( ; x + 2 <= in_width; x += 2 )
+    {
+        const GLuint* indices = &in_taps->indices[static_cast<size_t>( x ) * taps];
+        const float* weights = &in_taps->weights[static_cast<size_t>( x ) * taps];
+        __m256 color = _mm256_setzero_ps();
+        for ( GLuint k = 0; k < taps; k++ )
+        {
+            const __m256 pixels = _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_loadu_ps( in_source + indices[k] * 4 ) ), _mm_loadu_ps( in_source + indices[taps + k] * 4 ), 1 );
+            const __m256 weight = _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_set1_ps( weights[k] ) ), _mm_set1_ps( weights[taps + k] ), 1 );
+            color = _mm256_fmadd_ps( pixels, weight, color );
+        }
+
+        _mm256_storeu_ps( in_destine + x * 4, color );
+    }
+
+    for ( ; x < in_width; x++ )
+    {
+        const GLuint* indices = &in_taps->indices[static_cast<size_t>( x ) * taps];
+        const float* weights = &in_taps->weights[static_cast<size_t>( x ) * taps];
+        __m128 color = _mm_setzero_ps();
+        for ( GLuint k = 0; k < taps; k++ )
+            color = _mm_fmadd_ps( _mm_loadu_ps( in_source + indices[k] * 4 ), _mm_set1_ps( weights[k] ), color );
+
+        _mm_storeu_ps( in_destine + x * 4, color );
+    }
+}
+
+CRGL_MIP_TARGET( "avx2,fma" )
+static void VerticalAvx2( const float* const* in_rows, const float* in_weights, const GLuint in_taps, float* in_destine, const GLuint in_count )
+{
+    GLuint i = 0;
+    for ( ; i + 8 <= in_count; i += 8 )
+    {
+        __m256 sum = _mm256_mul_ps( _mm256_loadu_ps( in_rows[0] + i ), _mm256_set1_ps( in_weights[0] ) );
+        for ( GLuint k = 1; k < in_taps; k++ )
+            sum = _mm256_fmadd_ps( _mm256_loadu_ps( in_rows[k] + i ), _mm256_set1_ps( in_weights[k] ), sum );
+
+        _mm256_storeu_ps( in_destine + i, sum );
+    }
+
+    VerticalTail( in_rows, in_weights, in_taps, in_destine, i, in_count );
+}
+#endif
+
+#if CRGL_MIP_NEON
+static void HorizontalNeon( const float* in_source, const mipTaps_t* in_taps, float* in_destine, const GLuint in_width )
+{
+    const GLuint taps = in_taps->taps;
+    for ( GLuint x = 0; x < in_width; x++ )
+    {
+        const GLuint* indices = &in_taps->indices[static_cast<size_t>( x ) * taps];
+        const float* weights = &in_taps->weights[static_cast<size_t>( x ) * taps];
+        float32x4_t color = vdupq_n_f32( 0.0f );
+        for ( GLuint k = 0; k < taps; k++ )
+            color = vmlaq_n_f32( color, vld1q_f32( in_source + indices[k] * 4 ), weights[k] );
+
+        vst1q_f32( in_destine + x * 4, color );
+    }
+}
+
+static void VerticalNeon( const float* const* in_rows, const float* in_weights, const GLuint in_taps, float* in_destine, const GLuint in_count )
+{
+    GLuint i = 0;
+    for ( ; i + 4 <= in_count; i += 4 )
+    {
+        float32x4_t sum = vmulq_n_f32( vld1q_f32( in_rows[0] + i ), in_weights[0] );
+        for ( GLuint k = 1; k < in_taps; k++ )
+            sum = vmlaq_n_f32( sum, vld1q_f32( in_rows[k] + i ), in_weights[k] );
+
+        vst1q_f32( in_destine + i, sum );
+    }
+
+    VerticalTail( in_rows, in_weights, in_taps, in_destine, i, in_count );
+}
+#endif
+
+static bool SimdSupported( const gl::mipSimd_t in_simd )
+{
+    switch ( in_simd )
+    {
+    case gl::MIP_SIMD_NONE:
+        return true;
+#if CRGL_MIP_X86
+#if defined( __GNUC__ ) || defined( __clang__ )
+    case gl::MIP_SIMD_SSE2:
+        return __builtin_cpu_supports( "sse2" );
+    case gl::MIP_SIMD_AVX2:
+        return __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" );
+#else
+    // x64 baseline, the AVX2 kernels need the GCC / Clang target attribute
+    case gl::MIP_SIMD_SSE2:
+        return true;
+#endif
+#endif
+#if CRGL_MIP_NEON
+    case gl::MIP_SIMD_NEON:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+static void SelectKernels( glCoreMipGenerator_t* in_generator, const gl::mipSimd_t in_simd )
+{
+    in_generator->simd = in_simd;
+    in_generator->horizontal = HorizontalScalar;
+    in_generator->vertical = VerticalScalar;
+    switch ( in_simd )
+    {
+#if CRGL_MIP_X86
+    case gl::MIP_SIMD_SSE2:
+        in_generator->horizontal = HorizontalSse2;
+        in_generator->vertical = VerticalSse2;
+        break;
+    case gl::MIP_SIMD_AVX2:
+        in_generator->horizontal = HorizontalAvx2;
+        in_generator->vertical = VerticalAvx2;
+        break;
+#endif
+#if CRGL_MIP_NEON
+    case gl::MIP_SIMD_NEON:
+        in_generator->horizontal = HorizontalNeon;
+        in_generator->vertical = VerticalNeon;
+        break;
+#endif
+    default:
+        in_generator->simd = gl::MIP_SIMD_NONE;
+        break;
+    }
+}
+
+// ============================================================================================
+// parallel for
+// ============================================================================================
+
+static void RunChunks( glCoreMipGenerator_t* in_generator )
+{
+    for ( ;; )
+    {
+        const GLuint begin = in_generator->jobNext.fetch_add( in_generator->jobChunk );
+        if ( begin >= in_generator->jobCount )
+            break;
+
+        in_generator->job( in_generator, begin, std::min( begin + in_generator->jobChunk, in_generator->jobCount ) );
+    }
+}
+
+static void WorkerLoop( glCoreMipGenerator_t* in_generator )
+{
+    uint64_t generation = 0;
+    for ( ;; )
+    {
+        {
+            std::unique_lock<std::mutex> lock( in_generator->lock );
+            in_generator->wake.wait( lock, [&]( void ) { return in_generator->quit || in_generator->generation != generation; } );
+            if ( in_generator->quit )
+                return;
+
+            generation = in_generator->generation;
+        }
+
+        RunChunks( in_generator );
+
+        std::lock_guard<std::mutex> lock( in_generator->lock );
+        if ( --in_generator->busy == 0 )
+            in_generator->finished.notify_all();
+    }
+}
+
+/// @brief run in_job over [0, in_count) rows on the workers and the calling thread
+static void ParallelFor( glCoreMipGenerator_t* in_generator, mipJob_t in_job, const GLuint in_count )
+{
+    const GLuint threads = static_cast<GLuint>( in_generator->threads.size() );
+    if ( threads == 0 || in_count < 2 )
+    {
+        in_job( in_generator, 0, in_count );
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock( in_generator->lock );
+        in_generator->job = in_job;
+        in_generator->jobCount = in_count;
+        in_generator->jobChunk = std::max<GLuint>( in_count / ( ( threads + 1 ) * 4 ), 1 );
+        in_generator->jobNext = 0;
+        in_generator->busy = threads;
+        in_generator->generation++;
+    }
+    in_generator->wake.notify_all();
+
+    RunChunks( in_generator );
+
+    std::unique_lock<std::mutex> lock( in_generator->lock );
+    in_generator->finished.wait( lock, [in_generator]( void ) { return in_generator->busy == 0; } );
+}
+
+// ============================================================================================
+// passes
+// ============================================================================================
+
+/// @brief the first level decode the source rows on the fly, the base level is never stored as float
+static void HorizontalJob( glCoreMipGenerator_t* in_generator, const GLuint in_begin, const GLuint in_end )
+{
+    mipPass_t& pass = in_generator->pass;
+    std::vector<float> decoded;
+    size_t covered = 0;
+
+    if ( pass.input == nullptr )
+        decoded.resize( static_cast<size_t>( pass.inputWidth ) * 4 );
+
+    for ( GLuint y = in_begin; y < in_end; y++ )
+    {
+        const float* row = pass.input + static_cast<size_t>( y ) * pass.inputWidth * 4;
+        if ( pass.input == nullptr )
+        {
+            const size_t pitch = static_cast<size_t>( pass.inputWidth ) * pass.format->bytesPerPixel;
+            DecodeRow( &pass, pass.source + y * pitch, decoded.data(), pass.inputWidth );
+            row = decoded.data();
+
+            if ( pass.alphaReference > 0.0f )
+            {
+                for ( GLuint x = 0; x < pass.inputWidth; x++ )
+                    covered += ( row[x * 4 + 3] > pass.alphaReference ) ? 1 : 0;
+            }
+        }
+
+        in_generator->horizontal( row, &pass.tapsX, pass.scratch + static_cast<size_t>( y ) * pass.outputWidth * 4, pass.outputWidth );
+    }
+
+    pass.covered += covered;
+}
+
+static void VerticalJob( glCoreMipGenerator_t* in_generator, const GLuint in_begin, const GLuint in_end )
+{
+    const mipPass_t& pass = in_generator->pass;
+    const GLuint taps = pass.tapsY.taps;
+    const size_t pitch = static_cast<size_t>( pass.outputWidth ) * 4;
+    std::vector<const float*> rows( taps );
+
+    for ( GLuint y = in_begin; y < in_end; y++ )
+    {
+        const GLuint* indices = &pass.tapsY.indices[static_cast<size_t>( y ) * taps];
+        for ( GLuint k = 0; k < taps; k++ )
+            rows[k] = pass.scratch + indices[k] * pitch;
+
+        in_generator->vertical( rows.data(), &pass.tapsY.weights[static_cast<size_t>( y ) * taps], taps, pass.output + y * pitch, static_cast<GLuint>( pitch ) );
+    }
+}
+
+static void EncodeJob( glCoreMipGenerator_t* in_generator, const GLuint in_begin, const GLuint in_end )
+{
+    const mipPass_t& pass = in_generator->pass;
+    const size_t pitch = static_cast<size_t>( pass.outputWidth ) * pass.format->bytesPerPixel;
+    for ( GLuint y = in_begin; y < in_end; y++ )
+        EncodeRow( &pass, pass.output + static_cast<size_t>( y ) * pass.outputWidth * 4, pass.encoded + y * pitch, pass.outputWidth );
+}
+
+static double AlphaCoverage( const float* in_pixels, const size_t in_count, const float in_reference, const float in_scale )
+{
+    size_t covered = 0;
+    for ( size_t i = 0; i < in_count; i++ )
+    {
+        if ( in_pixels[i * 4 + 3] * in_scale > in_reference )
+            covered++;
+    }
+
+    return static_cast<double>( covered ) / static_cast<double>( in_count );
+}
+
+/// @brief alpha scale that give the level the base coverage, by bisection
+static float CoverageScale( const float* in_pixels, const size_t in_count, const float in_reference, const double in_coverage )
+{
+    float low = 0.0f;
+    float high = 4.0f;
+    for ( GLuint i = 0; i < 16; i++ )
+    {
+        const float middle = ( low + high ) * 0.5f;
+        if ( AlphaCoverage( in_pixels, in_count, in_reference, middle ) < in_coverage )
+            low = middle;
+        else
+            high = middle;
+    }
+
+    return ( low + high ) * 0.5f;
+}
+
+gl::MipGenerator::MipGenerator( void ) : m_generator( nullptr )
+{
+}
+
+gl::MipGenerator::~MipGenerator( void )
+{
+    Destroy();
+}
+
+bool gl::MipGenerator::Create( const createInfo_t* in_createInfo )
+{
+    if ( in_createInfo == nullptr )
+        return false;
+
+    Destroy();
+
+    const mipSimd_t simd = ( in_createInfo->simd == MIP_SIMD_AUTO ) ? BestSimd() : in_createInfo->simd;
+    if ( !SimdSupported( simd ) )
+        return false;
+
+    m_generator = new glCoreMipGenerator_t();
+    m_generator->createInfo = *in_createInfo;
+    SelectKernels( m_generator, simd );
+    m_generator->stats.simd = m_generator->simd;
+
+    // the calling thread is the last worker
+    GLuint threads = in_createInfo->threads;
+    if ( threads == 0 )
+        threads = std::max<GLuint>( std::thread::hardware_concurrency(), 1 );
+
+    for ( GLuint i = 1; i < threads; i++ )
+        m_generator->threads.push_back( std::thread( WorkerLoop, m_generator ) );
+
+    return true;
+}
+
+void gl::MipGenerator::Destroy( void )
+{
+    if ( m_generator == nullptr )
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock( m_generator->lock );
+        m_generator->quit = true;
+    }
+    m_generator->wake.notify_all();
+
+    for ( auto& thread : m_generator->threads )
+        thread.join();
+
+    delete m_generator;
+    m_generator = nullptr;
+}
+
+bool gl::MipGenerator::Generate( const Format in_format, const GLuint in_width, const GLuint in_height, const void* in_pixels, const GLuint in_levels )
+{
+    if ( m_generator == nullptr || in_pixels == nullptr || in_width == 0 || in_height == 0 || !Supported( in_format ) )
+        return false;
+
+    const mipClock_t::time_point start = mipClock_t::now();
+    const createInfo_t& createInfo = m_generator->createInfo;
+    const formatInfo_t* format = in_format.Info();
+
+    GLuint levels = 1;
+    while ( ( std::max( in_width, in_height ) >> levels ) > 0 )
+        levels++;
+
+    if ( in_levels != 0 )
+        levels = std::min( levels, in_levels );
+
+    mipPass_t& pass = m_generator->pass;
+    pass.format = format;
+    pass.srgb = createInfo.gammaCorrect && in_format.IsSRGB();
+    pass.source = static_cast<const uint8_t*>( in_pixels );
+    pass.alphaScale = 1.0f;
+
+    m_generator->base.width = in_width;
+    m_generator->base.height = in_height;
+    m_generator->base.pixels = in_pixels;
+    m_generator->base.size = static_cast<GLsizeiptr>( in_width ) * in_height * format->bytesPerPixel;
+    m_generator->levels.resize( levels );
+
+    const bool coverage = createInfo.alphaReference > 0.0f && format->components == 4;
+    pass.alphaReference = coverage ? createInfo.alphaReference : 0.0f;
+    pass.covered = 0;
+    pass.input = nullptr;
+    double baseCoverage = 0.0;
+
+    std::vector<float>* output = &m_generator->linear[0];
+    std::vector<float>* previous = &m_generator->linear[1];
+    GLuint width = in_width;
+    GLuint height = in_height;
+    for ( GLuint level = 1; level < levels; level++ )
+    {
+        const GLuint nextWidth = std::max<GLuint>( width >> 1, 1 );
+        const GLuint nextHeight = std::max<GLuint>( height >> 1, 1 );
+        const size_t pixels = static_cast<size_t>( nextWidth ) * nextHeight;
+
+        m_generator->scratch.resize( static_cast<size_t>( nextWidth ) * height * 4 );
+        output->resize( pixels * 4 );
+        m_generator->levels[level].resize( pixels * format->bytesPerPixel );
+
+        BuildTaps( &pass.tapsX, width, nextWidth, createInfo.filter, createInfo.wrap );
+        BuildTaps( &pass.tapsY, height, nextHeight, createInfo.filter, createInfo.wrap );
+        pass.inputWidth = width;
+        pass.inputHeight = height;
+        pass.scratch = m_generator->scratch.data();
+        pass.output = output->data();
+        pass.outputWidth = nextWidth;
+        pass.outputHeight = nextHeight;
+        pass.encoded = m_generator->levels[level].data();
+
+        ParallelFor( m_generator, HorizontalJob, height );
+        ParallelFor( m_generator, VerticalJob, nextHeight );
+
+        if ( level == 1 )
+            baseCoverage = static_cast<double>( pass.covered ) / ( static_cast<double>( in_width ) * in_height );
+
+        // the next level filter the unscaled alpha
+        pass.alphaScale = coverage ? CoverageScale( output->data(), pixels, createInfo.alphaReference, baseCoverage ) : 1.0f;
+        ParallelFor( m_generator, EncodeJob, nextHeight );
+
+        pass.input = output->data();
+        std::swap( previous, output );
+        width = nextWidth;
+        height = nextHeight;
+        m_generator->stats.pixels += pixels;
+    }
+
+    m_generator->stats.images++;
+    m_generator->stats.levels += levels - 1;
+    m_generator->stats.microseconds += static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::microseconds>( mipClock_t::now() - start ).count() );
+    return true;
+}
+
+GLuint gl::MipGenerator::Levels( void ) const
+{
+    return ( m_generator != nullptr ) ? static_cast<GLuint>( m_generator->levels.size() ) : 0;
+}
+
+gl::mipLevel_t gl::MipGenerator::Level( const GLuint in_level ) const
+{
+    if ( m_generator == nullptr || in_level >= m_generator->levels.size() )
+        return mipLevel_t();
+
+    if ( in_level == 0 )
+        return m_generator->base;
+
+    mipLevel_t level;
+    level.width = std::max<GLuint>( m_generator->base.width >> in_level, 1 );
+    level.height = std::max<GLuint>( m_generator->base.height >> in_level, 1 );
+    level.pixels = m_generator->levels[in_level].data();
+    level.size = static_cast<GLsizeiptr>( m_generator->levels[in_level].size() );
+    return level;
+}
+
+bool gl::MipGenerator::Upload( Texture* in_texture, TextureUploader* in_uploader, const GLsizei in_layer ) const
+{
+    if ( m_generator == nullptr || in_texture == nullptr )
+        return false;
+
+    const GLuint levels = std::min<GLuint>( Levels(), static_cast<GLuint>( in_texture->Levels() ) );
+    GLint alignment = 4;
+    if ( in_uploader == nullptr )
+    {
+        glGetIntegerv( GL_UNPACK_ALIGNMENT, &alignment );
+        glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+    }
+
+    bool result = true;
+    for ( GLuint i = 1; i < levels; i++ )
+    {
+        const mipLevel_t level = Level( i );
+        Texture::subImage_t subImage;
+        subImage.level = static_cast<GLint>( i );
+        subImage.layer = in_layer;
+        subImage.dimension.width = static_cast<GLsizei>( level.width );
+        subImage.dimension.height = static_cast<GLsizei>( level.height );
+        subImage.dimension.depth = 1;
+
+        if ( in_uploader == nullptr )
+        {
+            in_texture->SubImage( &subImage, level.pixels );
+            continue;
+        }
+
+        // the ring may be full of regions not flushed yet
+        if ( !in_uploader->Upload( in_texture, &subImage, level.pixels, level.size ) )
+        {
+            in_uploader->Flush();
+            result = result && in_uploader->Upload( in_texture, &subImage, level.pixels, level.size );
+        }
+    }
+
+    if ( in_uploader == nullptr )
+        glPixelStorei( GL_UNPACK_ALIGNMENT, alignment );
+
+    return result;
+}
+
+gl::mipGeneratorStats_t gl::MipGenerator::Stats( void ) const
+{
+    return ( m_generator != nullptr ) ? m_generator->stats : mipGeneratorStats_t();
+}
+
+bool gl::MipGenerator::Supported( const Format in_format )
+{
+    const formatInfo_t* info = in_format.Info();
+    if ( info == nullptr || info->bytesPerPixel == 0 || info->components == 0 || info->components > 4 )
+        return false;
+
+    if ( ( info->flags & ( FORMAT_COMPRESSED | FORMAT_GENERIC | FORMAT_DEPTH | FORMAT_STENCIL ) ) != 0 )
+        return false;
+
+    switch ( info->type )
+    {
+    case GL_UNSIGNED_BYTE:
+    case GL_BYTE:
+    case GL_UNSIGNED_SHORT:
+    case GL_SHORT:
+    case GL_UNSIGNED_INT:
+    case GL_INT:
+    case GL_HALF_FLOAT:
+    case GL_FLOAT:
+        return true;
+    default:
+        return IsPacked( info->type );
+    }
+}
+
+gl::mipSimd_t gl::MipGenerator::BestSimd( void )
+{
+    static const mipSimd_t k_ORDER[] = { MIP_SIMD_AVX2, MIP_SIMD_SSE2, MIP_SIMD_NEON };
+    for ( const mipSimd_t simd : k_ORDER )
+    {
+        if ( SimdSupported( simd ) )
+            return simd;
+    }
+
+    return MIP_SIMD_NONE;
+}
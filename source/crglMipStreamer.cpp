@@ -0,0 +1,332 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#include "crglPrecompiled.hpp"
+#include "crglTextureUploader.hpp"
+#include "crglMipStreamer.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+typedef std::chrono::steady_clock   streamClock_t;
+
+typedef struct mipStream_t
+{
+    gl::Texture*                texture = nullptr;
+    gl::MipSource*              source = nullptr;
+    GLfloat                     screenSize = 0.0f;
+    GLint                       level = 0;          // finest level uploaded
+    bool                        active = false;
+    streamClock_t::time_point   added;
+} mipStream_t;
+
+typedef struct glCoreMipStreamer_t
+{
+    gl::MipStreamer::createInfo_t   createInfo;
+    gl::TextureUploader             uploader;
+    std::vector<mipStream_t>        streams;        // id - 1
+    std::vector<GLuint>             freeStreams;
+    gl::mipStreamerStats_t          stats;
+    uint64_t                        firstPixelSum = 0;
+    uint64_t                        firstPixels = 0;
+} glCoreMipStreamer_t;
+
+static GLint StreamDesiredLevel( const mipStream_t& in_stream )
+{
+    const gl::Texture::dimensions_t dimensions = in_stream.texture->Dimensions();
+    const GLfloat size = static_cast<GLfloat>( std::max( dimensions.width, dimensions.height ) );
+    const GLint levels = in_stream.texture->Levels();
+
+    // whitout a screen size estimation the whole chain is wanted
+    if ( in_stream.screenSize <= 0.0f )
+        return 0;
+
+    GLint level = static_cast<GLint>( std::floor( std::log2( size / std::max( in_stream.screenSize, 1.0f ) ) ) );
+    return std::min( std::max( level, 0 ), levels - 1 );
+}
+
+static GLfloat Priority( const mipStream_t& in_stream )
+{
+    const GLint desired = StreamDesiredLevel( in_stream );
+
+    if ( in_stream.level <= desired )
+        return 0.0f;
+
+    // big on screen and blurry first
+    return std::max( in_stream.screenSize, 1.0f ) * static_cast<GLfloat>( in_stream.level - desired );
+}
+
+// fill a allocated region whit a level and queue its upload, the region is discarded on failure
+static bool UploadLevel( gl::TextureUploader* in_uploader, const mipStream_t& in_stream, const GLint in_level, const GLsizeiptr in_size, const gl::uploadRegion_t* in_region )
+{
+    if ( !in_stream.source->LoadLevel( in_level, in_region->data, in_size ) )
+    {
+        in_uploader->Discard( in_region );
+        return false;
+    }
+
+    const gl::Texture::dimensions_t dimensions = in_stream.texture->Dimensions();
+    gl::Texture::subImage_t subImage;
+    subImage.level = in_level;
+    subImage.dimension.width = std::max<GLsizei>( dimensions.width >> in_level, 1 );
+    subImage.dimension.height = std::max<GLsizei>( dimensions.height >> in_level, 1 );
+    return in_uploader->Upload( in_region, in_stream.texture, &subImage );
+}
+
+static GLsizeiptr LevelSize( const mipStream_t& in_stream, const GLint in_level )
+{
+    const gl::Texture::dimensions_t dimensions = in_stream.texture->Dimensions();
+    return static_cast<GLsizeiptr>( in_stream.texture->PixelFormat().LevelSize( dimensions.width, dimensions.height, 1, in_level ) );
+}
+
+static mipStream_t* FindStream( glCoreMipStreamer_t* in_streamer, const GLuint in_stream )
+{
+    if ( in_streamer == nullptr || in_stream == 0 || in_stream > in_streamer->streams.size() )
+        return nullptr;
+
+    mipStream_t* stream = &in_streamer->streams[in_stream - 1];
+    return stream->active ? stream : nullptr;
+}
+
+gl::MipStreamer::MipStreamer( void ) : m_streamer( nullptr )
+{
+}
+
+gl::MipStreamer::~MipStreamer( void )
+{
+    Destroy();
+}
+
+bool gl::MipStreamer::Create( const createInfo_t* in_createInfo )
+{
+    TextureUploader::createInfo_t uploaderInfo;
+
+    if ( in_createInfo == nullptr )
+        return false;
+
+    Destroy();
+
+    m_streamer = new glCoreMipStreamer_t();
+    m_streamer->createInfo = *in_createInfo;
+
+    uploaderInfo.size = in_createInfo->stagingSize;
+    if ( !m_streamer->uploader.Create( &uploaderInfo ) )
+    {
+        Destroy();
+        return false;
+    }
+
+    return true;
+}
+
+void gl::MipStreamer::Destroy( void )
+{
+    if ( m_streamer == nullptr )
+        return;
+
+    m_streamer->uploader.Destroy();
+    delete m_streamer;
+    m_streamer = nullptr;
+}
+
+GLuint gl::MipStreamer::Add( Texture* in_texture, MipSource* in_source )
+{
+    mipStream_t stream;
+    GLuint id = 0;
+
+    if ( m_streamer == nullptr || in_texture == nullptr || in_source == nullptr || in_texture->Target() != texture::TEXTURE_2D )
+        return 0;
+
+    stream.texture = in_texture;
+    stream.source = in_source;
+    stream.level = in_texture->Levels();
+    stream.active = true;
+    stream.added = streamClock_t::now();
+
+    // the coarsest level is uploaded now, so the texture is never sampled whit undefined texels
+    const GLint coarsest = in_texture->Levels() - 1;
+    const GLsizeiptr size = LevelSize( stream, coarsest );
+    uploadRegion_t region;
+    if ( !m_streamer->uploader.Allocate( size, &region ) )
+    {
+        // the ring is full of the last update levels
+        m_streamer->uploader.Flush();
+        if ( !m_streamer->uploader.Allocate( size, &region ) )
+            return 0;
+    }
+
+    if ( !UploadLevel( &m_streamer->uploader, stream, coarsest, size, &region ) )
+        return 0;
+
+    // the SubImage is issued before the level clamp move
+    m_streamer->uploader.Flush();
+    in_texture->SetResidentLevel( coarsest );
+    stream.level = coarsest;
+
+    m_streamer->firstPixelSum += static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::microseconds>( streamClock_t::now() - stream.added ).count() );
+    m_streamer->firstPixels++;
+    m_streamer->stats.levels++;
+    m_streamer->stats.bytes += static_cast<uint64_t>( size );
+    if ( coarsest == StreamDesiredLevel( stream ) )
+        m_streamer->stats.complete++;
+
+    if ( !m_streamer->freeStreams.empty() )
+    {
+        id = m_streamer->freeStreams.back();
+        m_streamer->freeStreams.pop_back();
+        m_streamer->streams[id - 1] = stream;
+    }
+    else
+    {
+        m_streamer->streams.push_back( stream );
+        id = static_cast<GLuint>( m_streamer->streams.size() );
+    }
+
+    m_streamer->stats.textures++;
+    return id;
+}
+
+void gl::MipStreamer::Remove( const GLuint in_stream )
+{
+    mipStream_t* stream = FindStream( m_streamer, in_stream );
+    if ( stream == nullptr )
+        return;
+
+    // the uploads already queued reference the texture
+    m_streamer->uploader.Flush();
+
+    *stream = mipStream_t();
+    m_streamer->freeStreams.push_back( in_stream );
+}
+
+void gl::MipStreamer::SetScreenSize( const GLuint in_stream, const GLfloat in_pixels )
+{
+    mipStream_t* stream = FindStream( m_streamer, in_stream );
+    if ( stream != nullptr )
+        stream->screenSize = in_pixels;
+}
+
+GLuint gl::MipStreamer::Update( void )
+{
+    std::vector<mipStream_t*> uploaded;
+    std::vector<mipStream_t> stopped;
+    GLsizeiptr budget = 0;
+
+    if ( m_streamer == nullptr )
+        return 0;
+
+    // recycle the staging of the last updates
+    m_streamer->uploader.Flush();
+
+    budget = m_streamer->createInfo.bytesPerUpdate;
+    while ( budget > 0 )
+    {
+        mipStream_t* best = nullptr;
+        GLfloat bestPriority = 0.0f;
+        for ( auto& stream : m_streamer->streams )
+        {
+            if ( !stream.active )
+                continue;
+
+            GLfloat priority = Priority( stream );
+            if ( priority > bestPriority )
+            {
+                best = &stream;
+                bestPriority = priority;
+            }
+        }
+
+        if ( best == nullptr )
+            break;
+
+        const GLint level = best->level - 1;
+        const GLsizeiptr size = LevelSize( *best, level );
+        if ( size > budget && !uploaded.empty() )
+            break;
+
+        uploadRegion_t region;
+        if ( !m_streamer->uploader.Allocate( size, &region ) )
+            break;
+
+        if ( !UploadLevel( &m_streamer->uploader, *best, level, size, &region ) )
+        {
+            // the stream stop at the levels already uploaded, the slot is reused by the next Add
+            stopped.push_back( *best );
+            *best = mipStream_t();
+            m_streamer->freeStreams.push_back( static_cast<GLuint>( best - m_streamer->streams.data() ) + 1 );
+            continue;
+        }
+
+        best->level = level;
+        if ( level == StreamDesiredLevel( *best ) )
+            m_streamer->stats.complete++;
+
+        m_streamer->stats.levels++;
+        m_streamer->stats.bytes += static_cast<uint64_t>( size );
+        budget -= size;
+        uploaded.push_back( best );
+    }
+
+    // the SubImage calls are issued before the level clamp move, the draws see the texels
+    m_streamer->uploader.Flush();
+    for ( auto stream : uploaded )
+    {
+        if ( stream->active )
+            stream->texture->SetResidentLevel( stream->level );
+    }
+
+    for ( const auto& stream : stopped )
+        stream.texture->SetResidentLevel( stream.level );
+
+    return static_cast<GLuint>( uploaded.size() );
+}
+
+GLint gl::MipStreamer::ResidentLevel( const GLuint in_stream ) const
+{
+    mipStream_t* stream = FindStream( m_streamer, in_stream );
+    return ( stream != nullptr ) ? stream->level : 0;
+}
+
+GLint gl::MipStreamer::DesiredLevel( const GLuint in_stream ) const
+{
+    mipStream_t* stream = FindStream( m_streamer, in_stream );
+    return ( stream != nullptr ) ? StreamDesiredLevel( *stream ) : 0;
+}
+
+gl::mipStreamerStats_t gl::MipStreamer::Stats( void ) const
+{
+    mipStreamerStats_t stats;
+    if ( m_streamer == nullptr )
+        return stats;
+
+    stats = m_streamer->stats;
+    stats.meanFirstPixel = ( m_streamer->firstPixels > 0 ) ? m_streamer->firstPixelSum / m_streamer->firstPixels : 0;
+    return stats;
+}
+
+GLfloat gl::MipStreamer::ProjectedSize( const GLfloat in_radius, const GLfloat in_distance, const GLfloat in_fovY, const GLfloat in_viewportHeight )
+{
+    if ( in_distance <= in_radius )
+        return in_viewportHeight;
+
+    return ( in_radius / ( in_distance * std::tan( in_fovY * 0.5f ) ) ) * in_viewportHeight;
+}
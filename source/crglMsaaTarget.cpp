@@ -0,0 +1,440 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#include "crglPrecompiled.hpp"
+#include "crglMsaaTarget.hpp"
+
+#include <cstdio>
+
+static const char k_RESOLVE_SHADER[] = R"(
+layout( local_size_x = 8, local_size_y = 8 ) in;
+
+layout( binding = 0 ) uniform sampler2DMS u_source;
+layout( binding = 0, RESOLVE_IMAGE_FORMAT ) writeonly uniform image2D u_resolved;
+layout( location = 0 ) uniform int u_x;
+layout( location = 1 ) uniform int u_y;
+layout( location = 2 ) uniform int u_width;
+layout( location = 3 ) uniform int u_height;
+
+void main( void )
+{
+    ivec2 local = ivec2( gl_GlobalInvocationID.xy );
+    if ( local.x >= u_width || local.y >= u_height )
+        return;
+
+    ivec2 texel = ivec2( u_x, u_y ) + local;
+    int samples = textureSamples( u_source );
+    vec4 result = texelFetch( u_source, texel, 0 );
+
+#if RESOLVE_MODE == 1 || RESOLVE_MODE == 2
+    for ( int i = 1; i < samples; i++ )
+    {
+#if RESOLVE_MODE == 1
+        result.r = min( result.r, texelFetch( u_source, texel, i ).r );
+#else
+        result.r = max( result.r, texelFetch( u_source, texel, i ).r );
+#endif
+    }
+#elif RESOLVE_MODE == 3
+    // Karis weighting, the average of the tonemapped samples mapped back to linear, Rec. 709 luma
+    const vec3 luma = vec3( 0.2126, 0.7152, 0.0722 );
+    float weight = 1.0 / ( 1.0 + dot( result.rgb, luma ) );
+    result *= weight;
+    float total = weight;
+    for ( int i = 1; i < samples; i++ )
+    {
+        vec4 color = texelFetch( u_source, texel, i );
+        weight = 1.0 / ( 1.0 + dot( color.rgb, luma ) );
+        result += color * weight;
+        total += weight;
+    }
+    result /= total;
+#else
+    for ( int i = 1; i < samples; i++ )
+        result += texelFetch( u_source, texel, i );
+    result /= float( samples );
+#endif
+
+    imageStore( u_resolved, texel, result );
+}
+)";
+
+typedef struct glCoreMsaaTarget_t
+{
+    gl::MsaaTarget::createInfo_t    createInfo;
+    gl::Texture                     multisample;
+    gl::RenderBuffer                multisampleBuffer;
+    gl::Texture                     resolved;
+    gl::FrameBuffer                 source;         // blit framebuffers
+    gl::FrameBuffer                 destine;
+    gl::Program                     program;        // compute resolve
+    GLenum                          attachment = GL_COLOR_ATTACHMENT0;
+    GLenum                          resolvedFormat = GL_NONE;
+    gl::rect_t                      dirty;
+    gl::msaaTargetStats_t           stats;
+} glCoreMsaaTarget_t;
+
+/// @brief GLSL image format qualifier of the formats a compute resolve can write
+static const char* ImageFormat( const GLenum in_format )
+{
+    switch ( in_format )
+    {
+    case GL_RGBA8:          return "rgba8";
+    case GL_RGBA16:         return "rgba16";
+    case GL_RGB10_A2:       return "rgb10_a2";
+    case GL_RG8:            return "rg8";
+    case GL_R8:             return "r8";
+    case GL_RGBA16F:        return "rgba16f";
+    case GL_RG16F:          return "rg16f";
+    case GL_R16F:           return "r16f";
+    case GL_RGBA32F:        return "rgba32f";
+    case GL_RG32F:          return "rg32f";
+    case GL_R32F:           return "r32f";
+    case GL_R11F_G11F_B10F: return "r11f_g11f_b10f";
+    default:                return nullptr;
+    }
+}
+
+static bool IsCompute( const gl::resolveMode_t in_mode )
+{
+    return in_mode != gl::RESOLVE_BLIT;
+}
+
+static void CreateError( const char* in_message )
+{
+    if ( gl::Context* context = gl::Context::Current() )
+        context->DebugOuput( in_message );
+}
+
+static bool CreateProgram( glCoreMsaaTarget_t* in_target )
+{
+    char defines[256];
+    gl::Shader shader;
+
+    std::snprintf( defines, sizeof( defines ),
+        "#version 450 core\n"
+        "#define RESOLVE_IMAGE_FORMAT %s\n"
+        "#define RESOLVE_MODE %d\n",
+        ImageFormat( in_target->resolvedFormat ), static_cast<int>( in_target->createInfo.resolve ) - 1 );
+
+    const GLchar* sources[] = { defines, k_RESOLVE_SHADER };
+    const gl::Shader* shaders[] = { &shader };
+    return shader.Create( GL_COMPUTE_SHADER, sources, nullptr, 2 ) && in_target->program.Create( shaders, 1 );
+}
+
+gl::MsaaTarget::MsaaTarget( void ) : m_target( nullptr )
+{
+}
+
+gl::MsaaTarget::~MsaaTarget( void )
+{
+    Destroy();
+}
+
+bool gl::MsaaTarget::Create( const createInfo_t* in_createInfo )
+{
+    if ( in_createInfo == nullptr || in_createInfo->width == 0 || in_createInfo->height == 0 || in_createInfo->samples == 0 )
+        return false;
+
+    Destroy();
+
+    const Format format = in_createInfo->format;
+    const bool depth = format.IsDepth();
+    const bool compute = IsCompute( in_createInfo->resolve );
+    if ( compute && in_createInfo->renderBuffer )
+    {
+        CreateError( "MsaaTarget error: compute resolves can't read a renderbuffer\n" );
+        return false;
+    }
+
+    if ( compute && ( format.IsInteger() || format.IsSRGB() || ( !depth && format.IsStencil() ) ) )
+    {
+        CreateError( "MsaaTarget error: the format can't be resolved by a compute shader\n" );
+        return false;
+    }
+
+    m_target = new glCoreMsaaTarget_t();
+    m_target->createInfo = *in_createInfo;
+
+    if ( depth && format.IsStencil() )
+        m_target->attachment = GL_DEPTH_STENCIL_ATTACHMENT;
+    else if ( depth )
+        m_target->attachment = GL_DEPTH_ATTACHMENT;
+    else if ( format.IsStencil() )
+        m_target->attachment = GL_STENCIL_ATTACHMENT;
+
+    // depth is written as a plain float image
+    m_target->resolvedFormat = ( compute && depth ) ? GL_R32F : format.internalFormat;
+    if ( compute && ImageFormat( m_target->resolvedFormat ) == nullptr )
+    {
+        CreateError( "MsaaTarget error: the format can't be written as image, use a RGBA / RG / R format\n" );
+        Destroy();
+        return false;
+    }
+
+    // the multisample storage
+    bool created = false;
+    if ( in_createInfo->renderBuffer )
+        created = m_target->multisampleBuffer.Create( in_createInfo->width, in_createInfo->height, in_createInfo->samples, format.internalFormat );
+    else
+    {
+        Texture::createInfo_t textureInfo;
+        textureInfo.target = GL_TEXTURE_2D_MULTISAMPLE;
+        textureInfo.samples = static_cast<GLsizei>( in_createInfo->samples );
+        textureInfo.format = format;
+        textureInfo.dimensions.width = static_cast<GLsizei>( in_createInfo->width );
+        textureInfo.dimensions.height = static_cast<GLsizei>( in_createInfo->height );
+        textureInfo.fixedsamplelocations = GL_TRUE;
+        created = m_target->multisample.Create( &textureInfo );
+    }
+
+    // the single sample result
+    Texture::createInfo_t resolvedInfo;
+    resolvedInfo.target = GL_TEXTURE_2D;
+    resolvedInfo.format = m_target->resolvedFormat;
+    resolvedInfo.dimensions.width = static_cast<GLsizei>( in_createInfo->width );
+    resolvedInfo.dimensions.height = static_cast<GLsizei>( in_createInfo->height );
+    resolvedInfo.fixedsamplelocations = GL_TRUE;
+    if ( !created || !m_target->resolved.Create( &resolvedInfo ) )
+    {
+        CreateError( "MsaaTarget error: failed to create the target storage\n" );
+        Destroy();
+        return false;
+    }
+
+    if ( compute )
+    {
+        if ( !CreateProgram( m_target ) )
+        {
+            CreateError( "MsaaTarget error: failed to build the resolve program\n" );
+            Destroy();
+            return false;
+        }
+
+        return true;
+    }
+
+    FrameBuffer::attachament_t source;
+    source.target = in_createInfo->renderBuffer ? GL_RENDERBUFFER : GL_TEXTURE_2D_MULTISAMPLE;
+    source.attachament = m_target->attachment;
+    source.handle = in_createInfo->renderBuffer ? m_target->multisampleBuffer.GetHandle() : m_target->multisample.Handle();
+
+    FrameBuffer::attachament_t destine;
+    destine.target = GL_TEXTURE_2D;
+    destine.attachament = m_target->attachment;
+    destine.handle = m_target->resolved.Handle();
+
+    if ( !m_target->source.Create() || !m_target->source.Attach( &source, 0, 1 ) ||
+         !m_target->destine.Create() || !m_target->destine.Attach( &destine, 0, 1 ) )
+    {
+        CreateError( "MsaaTarget error: incomplete resolve framebuffers\n" );
+        Destroy();
+        return false;
+    }
+
+    return true;
+}
+
+void gl::MsaaTarget::Destroy( void )
+{
+    if ( m_target == nullptr )
+        return;
+
+    m_target->program.Destroy();
+    m_target->source.Destroy();
+    m_target->destine.Destroy();
+    m_target->multisample.Destroy();
+    m_target->multisampleBuffer.Destroy();
+    m_target->resolved.Destroy();
+    delete m_target;
+    m_target = nullptr;
+}
+
+void gl::MsaaTarget::MarkDirty( const rect_t* in_rect )
+{
+    if ( m_target == nullptr )
+        return;
+
+    const GLint width = static_cast<GLint>( m_target->createInfo.width );
+    const GLint height = static_cast<GLint>( m_target->createInfo.height );
+    GLint x0 = 0;
+    GLint y0 = 0;
+    GLint x1 = width;
+    GLint y1 = height;
+    if ( in_rect != nullptr )
+    {
+        x0 = std::max( in_rect->x, 0 );
+        y0 = std::max( in_rect->y, 0 );
+        x1 = std::min( in_rect->x + in_rect->width, width );
+        y1 = std::min( in_rect->y + in_rect->height, height );
+    }
+
+    if ( x1 <= x0 || y1 <= y0 )
+        return;
+
+    // union whit the region already pending
+    rect_t& dirty = m_target->dirty;
+    if ( dirty.width > 0 && dirty.height > 0 )
+    {
+        x0 = std::min( x0, dirty.x );
+        y0 = std::min( y0, dirty.y );
+        x1 = std::max( x1, dirty.x + dirty.width );
+        y1 = std::max( y1, dirty.y + dirty.height );
+    }
+
+    dirty.x = x0;
+    dirty.y = y0;
+    dirty.width = x1 - x0;
+    dirty.height = y1 - y0;
+}
+
+bool gl::MsaaTarget::Resolve( const bool in_invalidate )
+{
+    if ( m_target == nullptr )
+        return false;
+
+    const rect_t region = m_target->dirty;
+    if ( region.width <= 0 || region.height <= 0 )
+    {
+        m_target->stats.skipped++;
+        return false;
+    }
+
+    if ( IsCompute( m_target->createInfo.resolve ) )
+    {
+        Context* context = Context::Current();
+        if ( context == nullptr )
+            return false;
+
+        const GLuint program = m_target->program;
+        GLuint previous = context->BindProgram( program );
+
+        glProgramUniform1i( program, 0, region.x );
+        glProgramUniform1i( program, 1, region.y );
+        glProgramUniform1i( program, 2, region.width );
+        glProgramUniform1i( program, 3, region.height );
+
+        // through the context so its binding cache stay valid, the unit 0 is restored after
+        const coreState_t state = context->CurrentState();
+        GLuint previousTexture = state.textures.textures[0];
+        GLuint previousSampler = state.textures.samplers[0];
+        GLuint texture = m_target->multisample.Handle();
+        GLuint sampler = 0;
+        context->BindTextures( &texture, &sampler, 0, 1 );
+
+        // image units are not cached, the unit 0 is left unbound
+        glBindImageTexture( 0, m_target->resolved.Handle(), 0, GL_FALSE, 0, GL_WRITE_ONLY, m_target->resolvedFormat );
+        glDispatchCompute( ( region.width + 7 ) / 8, ( region.height + 7 ) / 8, 1 );
+        glMemoryBarrier( GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_FRAMEBUFFER_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT );
+        glBindImageTexture( 0, 0, 0, GL_FALSE, 0, GL_WRITE_ONLY, m_target->resolvedFormat );
+
+        context->BindTextures( &previousTexture, &previousSampler, 0, 1 );
+        context->BindProgram( previous );
+    }
+    else
+    {
+        GLbitfield mask = GL_COLOR_BUFFER_BIT;
+        if ( m_target->attachment == GL_DEPTH_STENCIL_ATTACHMENT )
+            mask = GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT;
+        else if ( m_target->attachment == GL_DEPTH_ATTACHMENT )
+            mask = GL_DEPTH_BUFFER_BIT;
+        else if ( m_target->attachment == GL_STENCIL_ATTACHMENT )
+            mask = GL_STENCIL_BUFFER_BIT;
+
+        FrameBuffer::rect_t rect;
+        rect.X0 = region.x;
+        rect.Y0 = region.y;
+        rect.X1 = region.x + region.width;
+        rect.Y1 = region.y + region.height;
+
+        // blits are scissored
+        Context* context = Context::Current();
+        scissorState_t scissor;
+        if ( context != nullptr )
+            scissor = context->SetScissorState( scissorState_t() );
+
+        m_target->source.Blit( m_target->destine.Handler(), rect, rect, mask, GL_NEAREST );
+
+        if ( context != nullptr )
+            context->SetScissorState( scissor );
+    }
+
+    // the samples are not needed anymore
+    if ( in_invalidate )
+    {
+        if ( m_target->createInfo.renderBuffer )
+            glInvalidateNamedFramebufferSubData( m_target->source.Handler(), 1, &m_target->attachment, region.x, region.y, region.width, region.height );
+        else
+            glInvalidateTexSubImage( m_target->multisample.Handle(), 0, region.x, region.y, 0, region.width, region.height, 1 );
+
+        m_target->stats.invalidates++;
+    }
+
+    m_target->stats.resolves++;
+    m_target->stats.pixels += static_cast<uint64_t>( region.width ) * static_cast<uint64_t>( region.height );
+    m_target->dirty = rect_t();
+    return true;
+}
+
+GLenum gl::MsaaTarget::Attachment( void ) const
+{
+    return ( m_target != nullptr ) ? m_target->attachment : GL_NONE;
+}
+
+const gl::Texture* gl::MsaaTarget::MultisampleTexture( void ) const
+{
+    return ( m_target != nullptr && !m_target->createInfo.renderBuffer ) ? &m_target->multisample : nullptr;
+}
+
+const gl::RenderBuffer* gl::MsaaTarget::MultisampleRenderBuffer( void ) const
+{
+    return ( m_target != nullptr && m_target->createInfo.renderBuffer ) ? &m_target->multisampleBuffer : nullptr;
+}
+
+const gl::Texture* gl::MsaaTarget::Resolved( void ) const
+{
+    return ( m_target != nullptr ) ? &m_target->resolved : nullptr;
+}
+
+gl::rect_t gl::MsaaTarget::DirtyRect( void ) const
+{
+    return ( m_target != nullptr ) ? m_target->dirty : rect_t();
+}
+
+GLuint gl::MsaaTarget::Width( void ) const
+{
+    return ( m_target != nullptr ) ? m_target->createInfo.width : 0;
+}
+
+GLuint gl::MsaaTarget::Height( void ) const
+{
+    return ( m_target != nullptr ) ? m_target->createInfo.height : 0;
+}
+
+GLuint gl::MsaaTarget::Samples( void ) const
+{
+    return ( m_target != nullptr ) ? m_target->createInfo.samples : 0;
+}
+
+gl::msaaTargetStats_t gl::MsaaTarget::Stats( void ) const
+{
+    return ( m_target != nullptr ) ? m_target->stats : msaaTargetStats_t();
+}
@@ -22,14 +22,18 @@
 #ifndef __CRGL_PRECOMPILED_HPP__
 #define __CRGL_PRECOMPILED_HPP__
 
+#include <algorithm> // std::min, std::max
 #include <exception>
 #include <stdexcept> // std::runtime_error
 #include <cstring> // std::memset
 #include <limits> // std::numeric_limits
 
 #include "crglCore.hpp"
+#include "crglDispatch.hpp"
 #include "crglEnumerators.hpp"
 #include "crglFence.hpp"
+#include "crglDebugLogger.hpp"
+#include "crglMemoryTracker.hpp"
 #include "crglContext.hpp"
 
 #endif //!__CRGL_PRECOMPILED_HPP__
\ No newline at end of file
@@ -0,0 +1,585 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#include "crglPrecompiled.hpp"
+#include "crglRenderFarm.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+typedef std::chrono::steady_clock   farmClock_t;
+
+typedef struct farmJob_t
+{
+    gl::RenderJob*              job = nullptr;
+    farmClock_t::time_point     submitted;
+} farmJob_t;
+
+typedef struct farmReadback_t
+{
+    gl::Buffer                  buffer;             // pixel pack buffer
+    GLsync                      fence = nullptr;    // readback done
+    farmJob_t                   job;
+} farmReadback_t;
+
+typedef struct farmWorker_t
+{
+    std::thread                 thread;
+    std::mutex                  lock;
+    std::deque<farmJob_t>       jobs;               // owner pop front, thieves pop back
+} farmWorker_t;
+
+typedef struct glCoreRenderFarm_t
+{
+    gl::RenderFarm::createInfo_t                createInfo;
+    gl::debugConfig_t                           debug;
+    std::vector<std::unique_ptr<farmWorker_t>>  workers;
+    std::atomic<GLuint>                         running{ 0 };
+    std::atomic<GLuint>                         next{ 0 };          // round robin submit
+    std::atomic<uint64_t>                       queued{ 0 };        // jobs waiting in a queue
+    bool                                        quit = false;
+
+    // sleeping workers and WaitIdle
+    mutable std::mutex                          idleLock;
+    mutable std::condition_variable             wake;
+    mutable std::condition_variable             idle;
+
+    // Start wait every worker to create its context, under idleLock
+    std::condition_variable                     started;
+    GLuint                                      starting = 0;
+
+    mutable std::mutex                          statsLock;
+    gl::renderFarmStats_t                       stats;
+    uint64_t                                    latencySum = 0;
+    farmClock_t::time_point                     statsStart;
+} glCoreRenderFarm_t;
+
+static GLuint LatencyBucket( const uint64_t in_microseconds )
+{
+    GLuint bucket = 0;
+    uint64_t value = std::max<uint64_t>( in_microseconds, 1 );
+    while ( value > 1 && bucket < gl::k_RENDER_FARM_LATENCY_BUCKETS - 1 )
+    {
+        value >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+#if defined( USE_EGL_CONTEXT )
+static gl::Context* SurfacelessContextFactory( void* in_userData )
+{
+    egl::Context::createInfo_t createInfo;
+    createInfo.pbuffer = true;
+    createInfo.core = true;
+    createInfo.verMaj = 4;
+    createInfo.verMin = 5;
+    createInfo.platform = EGL_PLATFORM_SURFACELESS_MESA;
+
+    egl::Context* context = new egl::Context();
+    if ( !context->Create( &createInfo ) )
+    {
+        delete context;
+        return nullptr;
+    }
+
+    return context;
+}
+#endif
+
+static bool PopJob( glCoreRenderFarm_t* in_farm, const GLuint in_worker, farmJob_t* in_job )
+{
+    const GLuint count = static_cast<GLuint>( in_farm->workers.size() );
+
+    // own queue first, oldest job
+    {
+        farmWorker_t* worker = in_farm->workers[in_worker].get();
+        std::lock_guard<std::mutex> lock( worker->lock );
+        if ( !worker->jobs.empty() )
+        {
+            *in_job = worker->jobs.front();
+            worker->jobs.pop_front();
+            in_farm->queued--;
+            return true;
+        }
+    }
+
+    // steal the newest job of another worker
+    for ( GLuint i = 1; i < count; i++ )
+    {
+        farmWorker_t* victim = in_farm->workers[( in_worker + i ) % count].get();
+        std::lock_guard<std::mutex> lock( victim->lock );
+        if ( !victim->jobs.empty() )
+        {
+            *in_job = victim->jobs.back();
+            victim->jobs.pop_back();
+            in_farm->queued--;
+
+            std::lock_guard<std::mutex> statsLock( in_farm->statsLock );
+            in_farm->stats.stolen++;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void FinishReadback( glCoreRenderFarm_t* in_farm, farmReadback_t* in_readback )
+{
+    const GLuint width = in_farm->createInfo.width;
+    const GLuint height = in_farm->createInfo.height;
+    const GLsizeiptr size = static_cast<GLsizeiptr>( in_farm->createInfo.colorFormat.ImageSize( width, height, 1 ) );
+
+    glClientWaitSync( in_readback->fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED );
+    glDeleteSync( in_readback->fence );
+    in_readback->fence = nullptr;
+
+    // a failed map is handed as a failed frame, the job must still be finished
+    const void* pixels = in_readback->buffer.Map( 0, size, GL_MAP_READ_BIT );
+    if ( pixels != nullptr )
+    {
+        in_readback->job.job->Finished( pixels, width, height );
+        in_readback->buffer.Unmap();
+    }
+    else
+    {
+        if ( gl::Context* context = gl::Context::Current() )
+            context->DebugOuput( "RenderFarm error: failed to map a readback buffer\n" );
+
+        in_readback->job.job->Finished( nullptr, 0, 0 );
+    }
+
+    uint64_t latency = static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::microseconds>( farmClock_t::now() - in_readback->job.submitted ).count() );
+    {
+        std::lock_guard<std::mutex> lock( in_farm->statsLock );
+        gl::renderFarmStats_t& stats = in_farm->stats;
+        stats.minLatency = ( stats.completed == 0 ) ? latency : std::min( stats.minLatency, latency );
+        stats.maxLatency = std::max( stats.maxLatency, latency );
+        stats.latency[LatencyBucket( latency )]++;
+        stats.completed++;
+        if ( pixels == nullptr )
+            stats.failed++;
+
+        in_farm->latencySum += latency;
+    }
+
+    std::lock_guard<std::mutex> lock( in_farm->idleLock );
+    in_farm->idle.notify_all();
+}
+
+// no worker left, fail the jobs still queued so nobody wait them forever
+static void DrainJobs( glCoreRenderFarm_t* in_farm )
+{
+    for ( auto& worker : in_farm->workers )
+    {
+        std::deque<farmJob_t> jobs;
+        {
+            std::lock_guard<std::mutex> lock( worker->lock );
+            jobs.swap( worker->jobs );
+            in_farm->queued -= jobs.size();
+        }
+
+        for ( const farmJob_t& job : jobs )
+        {
+            job.job->Finished( nullptr, 0, 0 );
+
+            std::lock_guard<std::mutex> lock( in_farm->statsLock );
+            in_farm->stats.completed++;
+            in_farm->stats.failed++;
+        }
+    }
+}
+
+// a worker is leaving, the last one fail the jobs left
+static void WorkerExit( glCoreRenderFarm_t* in_farm )
+{
+    if ( --in_farm->running == 0 )
+        DrainJobs( in_farm );
+
+    std::lock_guard<std::mutex> lock( in_farm->idleLock );
+    in_farm->idle.notify_all();
+}
+
+static bool IsReadbackDone( const farmReadback_t* in_readback )
+{
+    return glClientWaitSync( in_readback->fence, 0, 0 ) != GL_TIMEOUT_EXPIRED;
+}
+
+static void WorkerLoop( glCoreRenderFarm_t* in_farm, const GLuint in_index )
+{
+    const gl::RenderFarm::createInfo_t& createInfo = in_farm->createInfo;
+    const GLuint depth = std::max<GLuint>( createInfo.readbackDepth, 1 );
+    const GLsizeiptr readbackSize = static_cast<GLsizeiptr>( createInfo.colorFormat.ImageSize( createInfo.width, createInfo.height, 1 ) );
+    gl::Context* context = nullptr;
+
+#if defined( USE_EGL_CONTEXT )
+    gl::contextFactory_t factory = ( createInfo.factory != nullptr ) ? createInfo.factory : SurfacelessContextFactory;
+#else
+    gl::contextFactory_t factory = createInfo.factory;
+#endif
+
+    if ( factory != nullptr )
+        context = factory( createInfo.userData );
+
+    const bool current = context != nullptr && context->MakeCurrent();
+    const bool ready = current && context->Init( &in_farm->debug );
+    if ( !ready )
+    {
+        if ( current )
+            context->Release();
+
+        delete context;
+        context = nullptr;
+    }
+
+    // report to Start before running any job
+    {
+        std::lock_guard<std::mutex> lock( in_farm->idleLock );
+        in_farm->starting--;
+        if ( !ready )
+            in_farm->running--;
+    }
+    in_farm->started.notify_all();
+
+    if ( !ready )
+    {
+        // the last worker, started or not, fail the jobs queued in the meantime
+        if ( in_farm->running == 0 )
+            DrainJobs( in_farm );
+
+        std::lock_guard<std::mutex> lock( in_farm->idleLock );
+        in_farm->idle.notify_all();
+        return;
+    }
+
+    {
+        // worker render target
+        gl::Texture color;
+        gl::RenderBuffer depthStencil;
+        gl::FrameBuffer frameBuffer;
+        gl::Texture::createInfo_t colorInfo;
+        gl::viewport_t viewport;
+        std::vector<gl::FrameBuffer::attachament_t> attachaments;
+        
+        colorInfo.target = gl::texture::TEXTURE_2D;
+        colorInfo.format = createInfo.colorFormat;
+        colorInfo.dimensions.width = static_cast<GLsizei>( createInfo.width );
+        colorInfo.dimensions.height = static_cast<GLsizei>( createInfo.height );
+        color.Create( &colorInfo );
+        attachaments.push_back( { GL_TEXTURE_2D, GL_COLOR_ATTACHMENT0, color.Handle() } );
+
+        if ( createInfo.depthFormat != GL_NONE )
+        {
+            GLenum attachament = gl::Format( createInfo.depthFormat ).IsStencil() ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+            depthStencil.Create( createInfo.width, createInfo.height, 0, createInfo.depthFormat );
+            attachaments.push_back( { GL_RENDERBUFFER, attachament, depthStencil.GetHandle() } );
+        }
+
+        frameBuffer.Create();
+        frameBuffer.Attach( attachaments.data(), 0, static_cast<GLuint>( attachaments.size() ) );
+
+        viewport.width = static_cast<GLfloat>( createInfo.width );
+        viewport.height = static_cast<GLfloat>( createInfo.height );
+        viewport.far = 1.0f;
+
+        // readback ring
+        std::vector<farmReadback_t> readbacks( depth );
+        for ( auto& readback : readbacks )
+            readback.buffer.Create( GL_PIXEL_PACK_BUFFER, readbackSize, nullptr, GL_MAP_READ_BIT );
+        GLuint head = 0;        // oldest in flight
+        GLuint inFlight = 0;
+
+        // integer color buffers can only be read whit the *_INTEGER transfer formats
+        const GLenum readFormat = createInfo.colorFormat.IsInteger() ? createInfo.colorFormat.ColorChanels( false ) : createInfo.colorFormat.TransferFormat();
+
+        glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+        glNamedFramebufferReadBuffer( frameBuffer.Handler(), GL_COLOR_ATTACHMENT0 );
+
+        for ( ;; )
+        {
+            farmJob_t job;
+
+            // hand over the readbacks already done
+            while ( inFlight > 0 && IsReadbackDone( &readbacks[head] ) )
+            {
+                FinishReadback( in_farm, &readbacks[head] );
+                head = ( head + 1 ) % depth;
+                inFlight--;
+            }
+
+            if ( !PopJob( in_farm, in_index, &job ) )
+            {
+                // nothing to render, wait the pending readbacks
+                if ( inFlight > 0 )
+                {
+                    FinishReadback( in_farm, &readbacks[head] );
+                    head = ( head + 1 ) % depth;
+                    inFlight--;
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock( in_farm->idleLock );
+                if ( in_farm->quit && in_farm->queued == 0 )
+                    break;
+
+                in_farm->wake.wait( lock, [in_farm]( void ) { return in_farm->quit || in_farm->queued > 0; } );
+                continue;
+            }
+
+            // ring full, the oldest must finish first
+            if ( inFlight == depth )
+            {
+                FinishReadback( in_farm, &readbacks[head] );
+                head = ( head + 1 ) % depth;
+                inFlight--;
+            }
+
+            context->BindFrameBuffer( frameBuffer.Handler() );
+            context->SetViewportState( 0, viewport );
+            job.job->Render( context );
+
+            // async readback in the next free slot
+            farmReadback_t* readback = &readbacks[( head + inFlight ) % depth];
+            readback->job = job;
+            context->BindFrameBuffer( frameBuffer.Handler() );
+            glBindBuffer( GL_PIXEL_PACK_BUFFER, readback->buffer.GetHandle() );
+            glReadPixels( 0, 0, static_cast<GLsizei>( createInfo.width ), static_cast<GLsizei>( createInfo.height ), 
+                          readFormat, createInfo.colorFormat.DataType(), nullptr );
+            glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 );
+            readback->fence = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+            glFlush();
+            inFlight++;
+        }
+
+        context->BindFrameBuffer( 0 );
+    }
+
+    context->Release();
+    delete context;
+    WorkerExit( in_farm );
+}
+
+gl::RenderFarm::RenderFarm( void ) : m_farm( nullptr )
+{
+}
+
+gl::RenderFarm::~RenderFarm( void )
+{
+    Stop();
+}
+
+bool gl::RenderFarm::Start( const createInfo_t* in_createInfo )
+{
+    GLuint count = 0;
+
+    if ( in_createInfo == nullptr || in_createInfo->width == 0 || in_createInfo->height == 0 )
+        return false;
+
+    Stop();
+
+    m_farm = new glCoreRenderFarm_t();
+    m_farm->createInfo = *in_createInfo;
+    m_farm->createInfo.debug = nullptr;
+    if ( in_createInfo->debug != nullptr )
+        m_farm->debug = *in_createInfo->debug;
+    else
+        m_farm->debug.mode = DEBUG_OFF;
+
+    m_farm->statsStart = farmClock_t::now();
+
+    count = in_createInfo->workers;
+    if ( count == 0 )
+        count = std::max<GLuint>( std::thread::hardware_concurrency(), 1 );
+
+    // all the queues must exist before any thread try to steal
+    for ( GLuint i = 0; i < count; i++ )
+        m_farm->workers.emplace_back( new farmWorker_t() );
+
+    m_farm->running = count;
+    m_farm->starting = count;
+    for ( GLuint i = 0; i < count; i++ )
+        m_farm->workers[i]->thread = std::thread( WorkerLoop, m_farm, i );
+
+    // wait every worker to create its context, the failed ones already left
+    {
+        std::unique_lock<std::mutex> lock( m_farm->idleLock );
+        m_farm->started.wait( lock, [this]( void ) { return m_farm->starting == 0; } );
+    }
+
+    if ( m_farm->running == 0 )
+    {
+        if ( Context* context = Context::Current() )
+            context->DebugOuput( "RenderFarm error: no worker context could be started\n" );
+
+        Stop();
+        return false;
+    }
+
+    if ( m_farm->running < count )
+    {
+        if ( Context* context = Context::Current() )
+            context->DebugOuput( "RenderFarm error: not all the requested workers could be started\n" );
+    }
+
+    return true;
+}
+
+void gl::RenderFarm::Stop( void )
+{
+    if ( m_farm == nullptr )
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock( m_farm->idleLock );
+        m_farm->quit = true;
+    }
+    m_farm->wake.notify_all();
+
+    for ( auto& worker : m_farm->workers )
+    {
+        if ( worker->thread.joinable() )
+            worker->thread.join();
+    }
+
+    delete m_farm;
+    m_farm = nullptr;
+}
+
+bool gl::RenderFarm::Submit( RenderJob* in_job )
+{
+    farmJob_t job;
+
+    if ( m_farm == nullptr || in_job == nullptr || m_farm->running == 0 )
+        return false;
+
+    job.job = in_job;
+    job.submitted = farmClock_t::now();
+
+    {
+        std::lock_guard<std::mutex> lock( m_farm->statsLock );
+        m_farm->stats.submitted++;
+    }
+
+    farmWorker_t* worker = m_farm->workers[m_farm->next++ % m_farm->workers.size()].get();
+    {
+        std::lock_guard<std::mutex> lock( worker->lock );
+        worker->jobs.push_back( job );
+        m_farm->queued++;
+    }
+
+    // taken under the idle lock so a worker going to sleep can't miss it
+    {
+        std::lock_guard<std::mutex> lock( m_farm->idleLock );
+    }
+    m_farm->wake.notify_one();
+    return true;
+}
+
+void gl::RenderFarm::WaitIdle( void ) const
+{
+    if ( m_farm == nullptr )
+        return;
+
+    std::unique_lock<std::mutex> lock( m_farm->idleLock );
+    m_farm->idle.wait( lock, [this]( void ) 
+    { 
+        std::lock_guard<std::mutex> statsLock( m_farm->statsLock );
+        return m_farm->stats.completed >= m_farm->stats.submitted || m_farm->running == 0; 
+    } );
+}
+
+GLuint gl::RenderFarm::NumWorkers( void ) const
+{
+    return ( m_farm != nullptr ) ? m_farm->running.load() : 0;
+}
+
+GLuint gl::RenderFarm::Width( void ) const
+{
+    return ( m_farm != nullptr ) ? m_farm->createInfo.width : 0;
+}
+
+GLuint gl::RenderFarm::Height( void ) const
+{
+    return ( m_farm != nullptr ) ? m_farm->createInfo.height : 0;
+}
+
+gl::Format gl::RenderFarm::ColorFormat( void ) const
+{
+    return ( m_farm != nullptr ) ? m_farm->createInfo.colorFormat : Format();
+}
+
+gl::renderFarmStats_t gl::RenderFarm::Stats( void ) const
+{
+    renderFarmStats_t stats;
+    if ( m_farm == nullptr )
+        return stats;
+
+    std::lock_guard<std::mutex> lock( m_farm->statsLock );
+    stats = m_farm->stats;
+
+    double seconds = std::chrono::duration<double>( farmClock_t::now() - m_farm->statsStart ).count();
+    stats.jobsPerSecond = ( seconds > 0.0 ) ? static_cast<double>( stats.completed ) / seconds : 0.0;
+    stats.meanLatency = ( stats.completed > 0 ) ? m_farm->latencySum / stats.completed : 0;
+    return stats;
+}
+
+void gl::RenderFarm::ResetStats( void )
+{
+    if ( m_farm == nullptr )
+        return;
+
+    std::lock_guard<std::mutex> lock( m_farm->statsLock );
+    
+    // keep the in flight jobs accounted
+    uint64_t pending = m_farm->stats.submitted - m_farm->stats.completed;
+    m_farm->stats = renderFarmStats_t();
+    m_farm->stats.submitted = pending;
+    m_farm->latencySum = 0;
+    m_farm->statsStart = farmClock_t::now();
+}
+
+uint64_t gl::RenderFarm::LatencyPercentile( const double in_percentile ) const
+{
+    renderFarmStats_t stats = Stats();
+    uint64_t target = 0;
+    uint64_t count = 0;
+
+    if ( stats.completed == 0 )
+        return 0;
+
+    target = static_cast<uint64_t>( std::max( 0.0, std::min( in_percentile, 1.0 ) ) * static_cast<double>( stats.completed ) );
+    target = std::max<uint64_t>( target, 1 );
+
+    for ( GLuint i = 0; i < k_RENDER_FARM_LATENCY_BUCKETS; i++ )
+    {
+        count += stats.latency[i];
+        if ( count >= target )
+            return std::min( 1ull << ( i + 1 ), static_cast<unsigned long long>( stats.maxLatency ) );
+    }
+
+    return stats.maxLatency;
+}
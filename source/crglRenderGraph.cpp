@@ -0,0 +1,489 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#include "crglPrecompiled.hpp"
+#include "crglRenderTargetPool.hpp"
+#include "crglRenderGraph.hpp"
+#include "crglFrameBufferCache.hpp"
+
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+static const GLuint k_NO_PASS = ~0u;
+
+typedef struct graphUse_t
+{
+    GLuint      resource = 0;       // index
+    GLbitfield  access = 0;
+    GLenum      attachment = GL_NONE;
+    bool        write = false;
+} graphUse_t;
+
+typedef struct graphPass_t
+{
+    std::string                 name;
+    gl::renderGraphExecute_t    execute = nullptr;
+    void*                       userData = nullptr;
+    std::vector<graphUse_t>     uses;
+    bool                        sideEffect = false;
+    bool                        culled = false;
+} graphPass_t;
+
+typedef struct graphResource_t
+{
+    std::string                 name;
+    gl::Texture::createInfo_t   createInfo;
+    gl::Texture*                texture = nullptr;  // imported, or acquired while alive
+    bool                        imported = false;
+    GLuint                      firstPass = k_NO_PASS;
+    GLuint                      lastPass = k_NO_PASS;
+} graphResource_t;
+
+typedef struct glCoreRenderGraph_t
+{
+    std::vector<graphPass_t>        passes;
+    std::vector<graphResource_t>    resources;
+    gl::FrameBufferCache            frameBuffers;       // one per attachment set
+    bool                            compiled = false;
+    gl::renderGraphStats_t          stats;
+} glCoreRenderGraph_t;
+
+static void AddUse( glCoreRenderGraph_t* in_graph, const GLuint in_pass, const GLuint in_resource, const GLbitfield in_access, const GLenum in_attachment, const bool in_write )
+{
+    if ( in_pass == 0 || in_pass > in_graph->passes.size() )
+        return;
+
+    graphUse_t use;
+    use.resource = in_resource - 1;
+    use.access = in_access;
+    use.attachment = in_attachment;
+    use.write = in_write;
+    in_graph->passes[in_pass - 1].uses.push_back( use );
+    in_graph->compiled = false;
+}
+
+// the pass framebuffer, from the cache, bound trought the context state cache
+static bool SetupFrameBuffer( gl::Context* in_glContext, glCoreRenderGraph_t* in_graph, const graphPass_t* in_pass, gl::renderGraphPass_t* in_context )
+{
+    std::vector<gl::fboAttachment_t> attachments;
+
+    for ( const graphUse_t& use : in_pass->uses )
+    {
+        if ( use.attachment == GL_NONE || ( use.access & ( gl::GRAPH_READ_ATTACHMENT | gl::GRAPH_WRITE_ATTACHMENT ) ) == 0 )
+            continue;
+
+        auto same = [&use]( const gl::fboAttachment_t& in_attachment ) { return in_attachment.attachment == use.attachment; };
+        if ( std::find_if( attachments.begin(), attachments.end(), same ) != attachments.end() )
+            continue;
+
+        const gl::Texture* texture = in_graph->resources[use.resource].texture;
+        const gl::Texture::dimensions_t dimensions = texture->Dimensions();
+        if ( !attachments.empty() && ( dimensions.width != in_context->width || dimensions.height != in_context->height ) )
+        {
+            char message[256];
+            std::snprintf( message, sizeof( message ), "RenderGraph error: pass \"%s\" attachment \"%s\" is %dx%d, the previous ones are %dx%d\n", 
+                in_pass->name.c_str(), in_graph->resources[use.resource].name.c_str(), dimensions.width, dimensions.height, in_context->width, in_context->height );
+            in_glContext->DebugOuput( message );
+            return false;
+        }
+
+        in_context->width = dimensions.width;
+        in_context->height = dimensions.height;
+        attachments.push_back( gl::FrameBufferCache::Attachment( texture, use.attachment ) );
+    }
+
+    if ( attachments.empty() )
+        return true;
+
+    const GLuint frameBuffer = in_graph->frameBuffers.Get( attachments.data(), static_cast<GLuint>( attachments.size() ) );
+    if ( frameBuffer == 0 )
+        return false;
+
+    gl::viewport_t viewport = in_glContext->CurrentState().viewports[0];
+    viewport.left = 0.0f;
+    viewport.bottom = 0.0f;
+    viewport.width = static_cast<GLfloat>( in_context->width );
+    viewport.height = static_cast<GLfloat>( in_context->height );
+
+    in_context->frameBuffer = frameBuffer;
+    in_glContext->BindFrameBuffer( frameBuffer );
+    in_glContext->SetViewportState( 0, viewport );
+    return true;
+}
+
+gl::RenderGraph::RenderGraph( void ) : m_graph( nullptr )
+{
+}
+
+gl::RenderGraph::~RenderGraph( void )
+{
+    Destroy();
+}
+
+bool gl::RenderGraph::Create( void )
+{
+    Destroy();
+
+    FrameBufferCache::createInfo_t cacheInfo;
+    m_graph = new glCoreRenderGraph_t();
+    if ( !m_graph->frameBuffers.Create( &cacheInfo ) )
+    {
+        Destroy();
+        return false;
+    }
+
+    return true;
+}
+
+void gl::RenderGraph::Destroy( void )
+{
+    if ( m_graph == nullptr )
+        return;
+
+    m_graph->frameBuffers.Destroy();
+    delete m_graph;
+    m_graph = nullptr;
+}
+
+void gl::RenderGraph::Reset( void )
+{
+    if ( m_graph == nullptr )
+        return;
+
+    m_graph->passes.clear();
+    m_graph->resources.clear();
+    m_graph->compiled = false;
+    m_graph->stats = renderGraphStats_t();
+}
+
+GLuint gl::RenderGraph::CreateTexture( const char* in_name, const Texture::createInfo_t* in_createInfo )
+{
+    if ( m_graph == nullptr || in_createInfo == nullptr )
+        return 0;
+
+    graphResource_t resource;
+    resource.name = ( in_name != nullptr ) ? in_name : "";
+    resource.createInfo = *in_createInfo;
+    m_graph->resources.push_back( resource );
+    m_graph->compiled = false;
+    return static_cast<GLuint>( m_graph->resources.size() );
+}
+
+GLuint gl::RenderGraph::ImportTexture( const char* in_name, Texture* in_texture )
+{
+    if ( m_graph == nullptr || in_texture == nullptr )
+        return 0;
+
+    graphResource_t resource;
+    resource.name = ( in_name != nullptr ) ? in_name : "";
+    resource.texture = in_texture;
+    resource.imported = true;
+    m_graph->resources.push_back( resource );
+    m_graph->compiled = false;
+    return static_cast<GLuint>( m_graph->resources.size() );
+}
+
+GLuint gl::RenderGraph::AddPass( const char* in_name, renderGraphExecute_t in_execute, void* in_userData )
+{
+    if ( m_graph == nullptr || in_execute == nullptr )
+        return 0;
+
+    graphPass_t pass;
+    pass.name = ( in_name != nullptr ) ? in_name : "";
+    pass.execute = in_execute;
+    pass.userData = in_userData;
+    m_graph->passes.push_back( pass );
+    m_graph->compiled = false;
+    return static_cast<GLuint>( m_graph->passes.size() );
+}
+
+void gl::RenderGraph::Read( const GLuint in_pass, const GLuint in_resource, const GLbitfield in_access, const GLenum in_attachment )
+{
+    if ( m_graph != nullptr )
+        AddUse( m_graph, in_pass, in_resource, in_access, in_attachment, false );
+}
+
+void gl::RenderGraph::Write( const GLuint in_pass, const GLuint in_resource, const GLbitfield in_access, const GLenum in_attachment )
+{
+    if ( m_graph != nullptr )
+        AddUse( m_graph, in_pass, in_resource, in_access, in_attachment, true );
+}
+
+void gl::RenderGraph::SetSideEffect( const GLuint in_pass )
+{
+    if ( m_graph == nullptr || in_pass == 0 || in_pass > m_graph->passes.size() )
+        return;
+
+    m_graph->passes[in_pass - 1].sideEffect = true;
+    m_graph->compiled = false;
+}
+
+bool gl::RenderGraph::Compile( void )
+{
+    if ( m_graph == nullptr )
+        return false;
+
+    const size_t resourceCount = m_graph->resources.size();
+    for ( const graphPass_t& pass : m_graph->passes )
+    {
+        for ( const graphUse_t& use : pass.uses )
+        {
+            if ( use.resource >= resourceCount )
+                return false;
+        }
+    }
+
+    // walk backward, a pass is alive when it write a resource read later or imported
+    std::vector<bool> live( resourceCount, false );
+    for ( size_t i = 0; i < resourceCount; i++ )
+        live[i] = m_graph->resources[i].imported;
+
+    m_graph->stats.culled = 0;
+    for ( size_t i = m_graph->passes.size(); i > 0; i-- )
+    {
+        graphPass_t& pass = m_graph->passes[i - 1];
+        bool needed = pass.sideEffect;
+        for ( const graphUse_t& use : pass.uses )
+            needed = needed || ( use.write && live[use.resource] );
+
+        pass.culled = !needed;
+        if ( pass.culled )
+        {
+            m_graph->stats.culled++;
+            continue;
+        }
+
+        // a write whitout read replace the content, the previous writers are not needed
+        for ( const graphUse_t& use : pass.uses )
+        {
+            if ( use.write && !m_graph->resources[use.resource].imported )
+                live[use.resource] = false;
+        }
+
+        for ( const graphUse_t& use : pass.uses )
+        {
+            if ( !use.write )
+                live[use.resource] = true;
+        }
+    }
+
+    // lifetimes over the surviving passes
+    for ( graphResource_t& resource : m_graph->resources )
+    {
+        resource.firstPass = k_NO_PASS;
+        resource.lastPass = k_NO_PASS;
+    }
+
+    for ( GLuint i = 0; i < m_graph->passes.size(); i++ )
+    {
+        if ( m_graph->passes[i].culled )
+            continue;
+
+        for ( const graphUse_t& use : m_graph->passes[i].uses )
+        {
+            graphResource_t& resource = m_graph->resources[use.resource];
+            if ( resource.firstPass == k_NO_PASS )
+                resource.firstPass = i;
+
+            resource.lastPass = i;
+        }
+    }
+
+    m_graph->compiled = true;
+    return true;
+}
+
+bool gl::RenderGraph::Execute( RenderTargetPool* in_pool )
+{
+    std::unordered_map<const Texture*, GLbitfield> pending;   // barriers owed by image writes, by physical texture
+    bool result = true;
+
+    Context* glContext = Context::Current();
+    if ( m_graph == nullptr || in_pool == nullptr || glContext == nullptr || ( !m_graph->compiled && !Compile() ) )
+        return false;
+
+    // the caller framebuffer and viewport, restored after each pass whit attachments
+    const GLuint previousFrameBuffer = glContext->CurrentState().frameBuffer;
+    const viewport_t previousViewport = glContext->CurrentState().viewports[0];
+
+    m_graph->stats.passes = 0;
+    m_graph->stats.textures = 0;
+    m_graph->stats.barriers = 0;
+    m_graph->stats.invalidates = 0;
+
+    for ( GLuint i = 0; i < m_graph->passes.size(); i++ )
+    {
+        const graphPass_t& pass = m_graph->passes[i];
+        if ( pass.culled )
+            continue;
+
+        // the textures born in this pass
+        bool acquired = true;
+        for ( graphResource_t& resource : m_graph->resources )
+        {
+            if ( resource.imported || resource.firstPass != i )
+                continue;
+
+            resource.texture = in_pool->AcquireTexture( &resource.createInfo );
+            acquired = acquired && resource.texture != nullptr;
+            m_graph->stats.textures++;
+        }
+
+        if ( !acquired )
+        {
+            result = false;
+            break;
+        }
+
+        // only the accesses after a image write need a barrier
+        GLbitfield barriers = 0;
+        for ( const graphUse_t& use : pass.uses )
+        {
+            auto found = pending.find( m_graph->resources[use.resource].texture );
+            if ( found != pending.end() )
+                barriers |= found->second & BarrierBits( use.access );
+        }
+
+        if ( barriers != 0 )
+        {
+            glMemoryBarrier( barriers );
+            m_graph->stats.barriers++;
+
+            // a barrier is global
+            for ( auto& texture : pending )
+                texture.second &= ~barriers;
+        }
+
+        renderGraphPass_t context;
+        context.graph = this;
+        context.pass = i + 1;
+        context.name = pass.name.c_str();
+        if ( !SetupFrameBuffer( glContext, m_graph, &pass, &context ) )
+        {
+            result = false;
+            break;
+        }
+
+        pass.execute( &context, pass.userData );
+        m_graph->stats.passes++;
+
+        for ( const graphUse_t& use : pass.uses )
+        {
+            if ( use.write && ( use.access & GRAPH_WRITE_IMAGE ) )
+                pending[m_graph->resources[use.resource].texture] = BarrierBits( GRAPH_READ_SAMPLED | GRAPH_READ_IMAGE | GRAPH_READ_ATTACHMENT );
+        }
+
+        // the attachments content is not needed after the last use
+        std::vector<GLenum> invalidate;
+        std::vector<const Texture*> invalidated;
+        for ( const graphUse_t& use : pass.uses )
+        {
+            const graphResource_t& resource = m_graph->resources[use.resource];
+            if ( context.frameBuffer != 0 && use.attachment != GL_NONE && !resource.imported && resource.lastPass == i &&
+                std::find( invalidate.begin(), invalidate.end(), use.attachment ) == invalidate.end() )
+            {
+                invalidate.push_back( use.attachment );
+                invalidated.push_back( resource.texture );
+            }
+        }
+
+        if ( !invalidate.empty() )
+        {
+            glInvalidateNamedFramebufferData( context.frameBuffer, static_cast<GLsizei>( invalidate.size() ), invalidate.data() );
+            m_graph->stats.invalidates += static_cast<GLuint>( invalidate.size() );
+        }
+
+        if ( context.frameBuffer != 0 )
+        {
+            glContext->SetViewportState( 0, previousViewport );
+            glContext->BindFrameBuffer( previousFrameBuffer );
+        }
+
+        // the textures dying here go back to the pool, a later texture can alias them
+        for ( graphResource_t& resource : m_graph->resources )
+        {
+            if ( resource.imported || resource.lastPass != i )
+                continue;
+
+            // every level, the attachment invalidate covered only the attached one
+            const bool attachment = std::find( invalidated.begin(), invalidated.end(), resource.texture ) != invalidated.end();
+            const GLsizei levels = resource.texture->Levels();
+            for ( GLsizei level = attachment ? 1 : 0; level < levels; level++ )
+                resource.texture->Invalidate( level );
+
+            if ( !attachment )
+                m_graph->stats.invalidates++;
+
+            in_pool->Release( resource.texture );
+            resource.texture = nullptr;
+        }
+    }
+
+    // a failed pass left textures acquired
+    for ( graphResource_t& resource : m_graph->resources )
+    {
+        if ( resource.imported || resource.texture == nullptr )
+            continue;
+
+        in_pool->Release( resource.texture );
+        resource.texture = nullptr;
+    }
+
+    return result;
+}
+
+gl::Texture* gl::RenderGraph::GetTexture( const GLuint in_resource ) const
+{
+    if ( m_graph == nullptr || in_resource == 0 || in_resource > m_graph->resources.size() )
+        return nullptr;
+
+    return m_graph->resources[in_resource - 1].texture;
+}
+
+bool gl::RenderGraph::IsCulled( const GLuint in_pass ) const
+{
+    if ( m_graph == nullptr || in_pass == 0 || in_pass > m_graph->passes.size() )
+        return false;
+
+    return m_graph->passes[in_pass - 1].culled;
+}
+
+gl::renderGraphStats_t gl::RenderGraph::Stats( void ) const
+{
+    return ( m_graph != nullptr ) ? m_graph->stats : renderGraphStats_t();
+}
+
+GLbitfield gl::RenderGraph::BarrierBits( const GLbitfield in_access )
+{
+    GLbitfield bits = 0;
+    if ( in_access & GRAPH_READ_SAMPLED )
+        bits |= GL_TEXTURE_FETCH_BARRIER_BIT;
+
+    if ( in_access & ( GRAPH_READ_IMAGE | GRAPH_WRITE_IMAGE ) )
+        bits |= GL_SHADER_IMAGE_ACCESS_BARRIER_BIT;
+
+    if ( in_access & ( GRAPH_READ_ATTACHMENT | GRAPH_WRITE_ATTACHMENT ) )
+        bits |= GL_FRAMEBUFFER_BARRIER_BIT;
+
+    return bits;
+}
@@ -0,0 +1,328 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#include "crglPrecompiled.hpp"
+#include "crglFrameBufferCache.hpp"
+#include "crglMsaaTarget.hpp"
+#include "crglRenderPass.hpp"
+
+#include <vector>
+
+typedef struct glCoreRenderPass_t
+{
+    gl::FrameBufferCache*               cache = nullptr;
+    gl::FrameBufferCache                privateCache;
+    GLuint                              frameBuffer = 0;
+    GLsizei                             width = 0;
+    GLsizei                             height = 0;
+    gl::rect_t                          renderArea;
+    bool                                partial = false;    // render area smaller than the attachments
+    std::vector<GLenum>                 discard;            // STORE_OP_DONT_CARE attachments
+    std::vector<gl::MsaaTarget*>        resolve;            // multisample attachments resolved at End
+    std::vector<bool>                   resolveDiscard;     // invalidate the samples after the resolve
+    gl::renderPassStats_t               stats;
+} glCoreRenderPass_t;
+
+static bool IsColor( const GLenum in_attachment )
+{
+    return in_attachment >= GL_COLOR_ATTACHMENT0 && in_attachment <= GL_COLOR_ATTACHMENT31;
+}
+
+static void Invalidate( glCoreRenderPass_t* in_pass, const std::vector<GLenum>& in_attachments )
+{
+    if ( in_attachments.empty() )
+        return;
+
+    const GLsizei count = static_cast<GLsizei>( in_attachments.size() );
+    if ( in_pass->partial )
+        glInvalidateNamedFramebufferSubData( in_pass->frameBuffer, count, in_attachments.data(), 
+            in_pass->renderArea.x, in_pass->renderArea.y, in_pass->renderArea.width, in_pass->renderArea.height );
+    else
+        glInvalidateNamedFramebufferData( in_pass->frameBuffer, count, in_attachments.data() );
+
+    in_pass->stats.invalidates += in_attachments.size();
+}
+
+// the clear value in the attachment format type
+static gl::FrameBuffer::clearColor_t ClearColor( const gl::passAttachment_t* in_attachment, const GLint in_drawBuffer )
+{
+    gl::FrameBuffer::clearColor_t clear;
+    clear.drawBuffer = in_drawBuffer;
+    std::memcpy( clear.color, in_attachment->clear.color, sizeof( clear.color ) );
+    std::memcpy( clear.colorInt, in_attachment->clear.colorInt, sizeof( clear.colorInt ) );
+    std::memcpy( clear.colorUint, in_attachment->clear.colorUint, sizeof( clear.colorUint ) );
+
+    const gl::Texture* texture = in_attachment->texture;
+    const gl::RenderBuffer* renderBuffer = in_attachment->renderBuffer;
+    if ( in_attachment->msaa != nullptr )
+    {
+        texture = in_attachment->msaa->MultisampleTexture();
+        renderBuffer = in_attachment->msaa->MultisampleRenderBuffer();
+    }
+
+    const gl::Format format = ( texture != nullptr ) ? texture->PixelFormat() : gl::Format( renderBuffer->InternalFormat() );
+    if ( format.IsInteger() )
+    {
+        const GLenum type = format.DataType();
+        const bool isUnsigned = type == GL_UNSIGNED_BYTE || type == GL_UNSIGNED_SHORT || type == GL_UNSIGNED_INT || type == GL_UNSIGNED_INT_2_10_10_10_REV;
+        clear.type = isUnsigned ? GL_UNSIGNED_INT : GL_INT;
+    }
+
+    return clear;
+}
+
+gl::RenderPass::RenderPass( void ) : m_pass( nullptr )
+{
+}
+
+gl::RenderPass::~RenderPass( void )
+{
+    Destroy();
+}
+
+bool gl::RenderPass::Create( FrameBufferCache* in_cache )
+{
+    Destroy();
+
+    m_pass = new glCoreRenderPass_t();
+    m_pass->cache = in_cache;
+    if ( m_pass->cache == nullptr )
+    {
+        FrameBufferCache::createInfo_t cacheInfo;
+        if ( !m_pass->privateCache.Create( &cacheInfo ) )
+        {
+            Destroy();
+            return false;
+        }
+
+        m_pass->cache = &m_pass->privateCache;
+    }
+
+    return true;
+}
+
+void gl::RenderPass::Destroy( void )
+{
+    if ( m_pass == nullptr )
+        return;
+
+    m_pass->privateCache.Destroy();
+    delete m_pass;
+    m_pass = nullptr;
+}
+
+bool gl::RenderPass::Begin( const passAttachment_t* in_attachments, const GLuint in_count, const rect_t* in_renderArea )
+{
+    std::vector<fboAttachment_t> attachments;
+    std::vector<GLenum> invalidate;
+
+    // the binds go trought the context state cache
+    Context* context = Context::Current();
+    if ( m_pass == nullptr || context == nullptr || in_attachments == nullptr || in_count == 0 )
+        return false;
+
+    // the framebuffer size is the smallest attachment one
+    m_pass->width = 0;
+    m_pass->height = 0;
+    for ( GLuint i = 0; i < in_count; i++ )
+    {
+        const passAttachment_t& attachment = in_attachments[i];
+        GLsizei width = 0;
+        GLsizei height = 0;
+        if ( attachment.msaa != nullptr )
+        {
+            const MsaaTarget* msaa = attachment.msaa;
+            if ( msaa->MultisampleTexture() != nullptr )
+                attachments.push_back( FrameBufferCache::Attachment( msaa->MultisampleTexture(), attachment.attachment ) );
+            else if ( msaa->MultisampleRenderBuffer() != nullptr )
+                attachments.push_back( FrameBufferCache::Attachment( msaa->MultisampleRenderBuffer(), attachment.attachment ) );
+            else
+                return false;
+
+            width = static_cast<GLsizei>( msaa->Width() );
+            height = static_cast<GLsizei>( msaa->Height() );
+        }
+        else if ( attachment.texture != nullptr )
+        {
+            attachments.push_back( FrameBufferCache::Attachment( attachment.texture, attachment.attachment, attachment.level, attachment.layer ) );
+            width = std::max<GLsizei>( attachment.texture->Dimensions().width >> attachment.level, 1 );
+            height = std::max<GLsizei>( attachment.texture->Dimensions().height >> attachment.level, 1 );
+        }
+        else if ( attachment.renderBuffer != nullptr )
+        {
+            attachments.push_back( FrameBufferCache::Attachment( attachment.renderBuffer, attachment.attachment ) );
+            width = static_cast<GLsizei>( attachment.renderBuffer->Width() );
+            height = static_cast<GLsizei>( attachment.renderBuffer->Height() );
+        }
+        else
+            return false;
+
+        m_pass->width = ( i == 0 ) ? width : std::min( m_pass->width, width );
+        m_pass->height = ( i == 0 ) ? height : std::min( m_pass->height, height );
+    }
+
+    m_pass->frameBuffer = m_pass->cache->Get( attachments.data(), in_count );
+    if ( m_pass->frameBuffer == 0 )
+        return false;
+
+    m_pass->renderArea.x = 0;
+    m_pass->renderArea.y = 0;
+    m_pass->renderArea.width = m_pass->width;
+    m_pass->renderArea.height = m_pass->height;
+    if ( in_renderArea != nullptr )
+        m_pass->renderArea = *in_renderArea;
+
+    m_pass->partial = m_pass->renderArea.x != 0 || m_pass->renderArea.y != 0 || 
+                      m_pass->renderArea.width != m_pass->width || m_pass->renderArea.height != m_pass->height;
+
+    viewport_t viewport = context->CurrentState().viewports[0];
+    viewport.left = static_cast<GLfloat>( m_pass->renderArea.x );
+    viewport.bottom = static_cast<GLfloat>( m_pass->renderArea.y );
+    viewport.width = static_cast<GLfloat>( m_pass->renderArea.width );
+    viewport.height = static_cast<GLfloat>( m_pass->renderArea.height );
+    context->BindFrameBuffer( m_pass->frameBuffer );
+    context->SetViewportState( 0, viewport );
+
+    // the loads
+    bool clears = false;
+    m_pass->discard.clear();
+    m_pass->resolve.clear();
+    m_pass->resolveDiscard.clear();
+    for ( GLuint i = 0; i < in_count; i++ )
+    {
+        clears = clears || in_attachments[i].load == LOAD_OP_CLEAR;
+        if ( in_attachments[i].load == LOAD_OP_DONT_CARE )
+            invalidate.push_back( in_attachments[i].attachment );
+
+        // the resolve invalidate the multisample ones
+        if ( in_attachments[i].msaa != nullptr )
+        {
+            m_pass->resolve.push_back( in_attachments[i].msaa );
+            m_pass->resolveDiscard.push_back( in_attachments[i].store == STORE_OP_DONT_CARE );
+        }
+        else if ( in_attachments[i].store == STORE_OP_DONT_CARE )
+            m_pass->discard.push_back( in_attachments[i].attachment );
+    }
+
+    Invalidate( m_pass, invalidate );
+
+    if ( clears )
+    {
+        std::vector<FrameBuffer::clearColor_t> colors;
+        FrameBuffer::clearInfo_t clear;
+        FrameBuffer::rect_t area;
+
+        for ( GLuint i = 0; i < in_count; i++ )
+        {
+            const passAttachment_t& attachment = in_attachments[i];
+            if ( attachment.load != LOAD_OP_CLEAR )
+                continue;
+
+            m_pass->stats.clears++;
+            if ( attachment.attachment == GL_DEPTH_ATTACHMENT || attachment.attachment == GL_DEPTH_STENCIL_ATTACHMENT )
+            {
+                clear.depth = true;
+                clear.depthValue = attachment.clear.depth;
+            }
+
+            if ( attachment.attachment == GL_STENCIL_ATTACHMENT || attachment.attachment == GL_DEPTH_STENCIL_ATTACHMENT )
+            {
+                clear.stencil = true;
+                clear.stencilValue = attachment.clear.stencil;
+            }
+
+            if ( !IsColor( attachment.attachment ) )
+                continue;
+
+            // the draw buffers follow the color attachments order
+            GLint drawBuffer = 0;
+            for ( GLuint j = 0; j < in_count; j++ )
+            {
+                if ( IsColor( in_attachments[j].attachment ) && in_attachments[j].attachment < attachment.attachment )
+                    drawBuffer++;
+            }
+
+            colors.push_back( ClearColor( &attachment, drawBuffer ) );
+        }
+
+        // a load clear the whole render area, whatever the masks and scissor in use
+        area.X0 = m_pass->renderArea.x;
+        area.Y0 = m_pass->renderArea.y;
+        area.X1 = m_pass->renderArea.x + m_pass->renderArea.width;
+        area.Y1 = m_pass->renderArea.y + m_pass->renderArea.height;
+        clear.colors = colors.data();
+        clear.colorCount = static_cast<GLuint>( colors.size() );
+        clear.area = &area;
+        clear.ignoreMasks = true;
+        FrameBuffer::Clear( m_pass->frameBuffer, &clear );
+    }
+
+    m_pass->stats.passes++;
+    return true;
+}
+
+void gl::RenderPass::End( void )
+{
+    if ( m_pass == nullptr || m_pass->frameBuffer == 0 )
+        return;
+
+    for ( size_t i = 0; i < m_pass->resolve.size(); i++ )
+    {
+        m_pass->resolve[i]->MarkDirty( &m_pass->renderArea );
+        if ( m_pass->resolve[i]->Resolve( m_pass->resolveDiscard[i] ) )
+        {
+            m_pass->stats.resolves++;
+            if ( m_pass->resolveDiscard[i] )
+                m_pass->stats.invalidates++;
+        }
+    }
+
+    m_pass->resolve.clear();
+    m_pass->resolveDiscard.clear();
+
+    Invalidate( m_pass, m_pass->discard );
+    m_pass->discard.clear();
+
+    if ( Context* context = Context::Current() )
+        context->BindFrameBuffer( 0 );
+
+    m_pass->frameBuffer = 0;
+}
+
+GLuint gl::RenderPass::FrameBuffer( void ) const
+{
+    return ( m_pass != nullptr ) ? m_pass->frameBuffer : 0;
+}
+
+GLsizei gl::RenderPass::Width( void ) const
+{
+    return ( m_pass != nullptr ) ? m_pass->width : 0;
+}
+
+GLsizei gl::RenderPass::Height( void ) const
+{
+    return ( m_pass != nullptr ) ? m_pass->height : 0;
+}
+
+gl::renderPassStats_t gl::RenderPass::Stats( void ) const
+{
+    return ( m_pass != nullptr ) ? m_pass->stats : renderPassStats_t();
+}
@@ -0,0 +1,396 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#include "crglPrecompiled.hpp"
+#include "crglRenderTargetPool.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+typedef struct pooledTexture_t
+{
+    gl::Texture::createInfo_t   createInfo;
+    gl::Texture                 texture;
+    uint64_t                    hash = 0;
+    uint64_t                    bytes = 0;
+    uint64_t                    lastUsed = 0;
+    bool                        inUse = false;
+} pooledTexture_t;
+
+typedef struct pooledRenderBuffer_t
+{
+    gl::renderBufferInfo_t      createInfo;
+    gl::RenderBuffer            renderBuffer;
+    uint64_t                    hash = 0;
+    uint64_t                    bytes = 0;
+    uint64_t                    lastUsed = 0;
+    bool                        inUse = false;
+} pooledRenderBuffer_t;
+
+typedef struct glCoreRenderTargetPool_t
+{
+    gl::RenderTargetPool::createInfo_t                                  createInfo;
+    std::unordered_map<uint64_t, std::vector<pooledTexture_t*>>         freeTextures;
+    std::unordered_map<uint64_t, std::vector<pooledRenderBuffer_t*>>    freeRenderBuffers;
+    std::unordered_map<const gl::Texture*, pooledTexture_t*>            textures;
+    std::unordered_map<const gl::RenderBuffer*, pooledRenderBuffer_t*>  renderBuffers;
+    uint64_t                                                            frame = 0;
+    gl::renderTargetPoolStats_t                                         stats;
+} glCoreRenderTargetPool_t;
+
+static uint64_t HashCombine( const uint64_t in_hash, const uint64_t in_value )
+{
+    // FNV-1a over the value bytes
+    uint64_t hash = in_hash;
+    for ( GLuint i = 0; i < 8; i++ )
+    {
+        hash ^= ( in_value >> ( i * 8 ) ) & 0xFF;
+        hash *= 0x100000001B3ull;
+    }
+
+    return hash;
+}
+
+static bool IsMultisample( const GLenum in_target )
+{
+    return in_target == gl::texture::TEXTURE_2D_MULTISAMPLE || in_target == gl::texture::TEXTURE_2D_MULTISAMPLE_ARRAY;
+}
+
+static bool IsArray( const GLenum in_target )
+{
+    return in_target == gl::texture::TEXTURE_1D_ARRAY || in_target == gl::texture::TEXTURE_2D_ARRAY || 
+           in_target == gl::texture::TEXTURE_CUBE_MAP_ARRAY || in_target == gl::texture::TEXTURE_2D_MULTISAMPLE_ARRAY;
+}
+
+// clear the fields the target don't use, so they don't split equal descriptions
+static gl::Texture::createInfo_t Normalize( const gl::Texture::createInfo_t* in_createInfo )
+{
+    gl::Texture::createInfo_t createInfo = *in_createInfo;
+    createInfo.levels = std::max<GLsizei>( createInfo.levels, 1 );
+    if ( !IsArray( createInfo.target ) )
+        createInfo.layers = 1;
+
+    if ( IsMultisample( createInfo.target ) )
+        createInfo.fixedsamplelocations = createInfo.fixedsamplelocations ? GL_TRUE : GL_FALSE;
+    else
+    {
+        createInfo.samples = 1;
+        createInfo.fixedsamplelocations = GL_FALSE;
+    }
+
+    // the multisample arrays take the layers from the depth
+    if ( createInfo.target != gl::texture::TEXTURE_3D && !IsArray( createInfo.target ) )
+        createInfo.dimensions.depth = 0;
+
+    return createInfo;
+}
+
+static bool Equal( const gl::Texture::createInfo_t& in_a, const gl::Texture::createInfo_t& in_b )
+{
+    return in_a.target == in_b.target && in_a.levels == in_b.levels && in_a.layers == in_b.layers && in_a.samples == in_b.samples &&
+           in_a.format.internalFormat == in_b.format.internalFormat && in_a.format.format == in_b.format.format &&
+           in_a.dimensions.width == in_b.dimensions.width && in_a.dimensions.height == in_b.dimensions.height &&
+           in_a.dimensions.depth == in_b.dimensions.depth && in_a.fixedsamplelocations == in_b.fixedsamplelocations;
+}
+
+static bool Equal( const gl::renderBufferInfo_t& in_a, const gl::renderBufferInfo_t& in_b )
+{
+    return in_a.width == in_b.width && in_a.height == in_b.height && in_a.samples == in_b.samples && in_a.format == in_b.format;
+}
+
+static void AddBytes( glCoreRenderTargetPool_t* in_pool, const uint64_t in_bytes )
+{
+    in_pool->stats.bytes += in_bytes;
+    in_pool->stats.highWater = std::max( in_pool->stats.highWater, in_pool->stats.bytes );
+}
+
+gl::RenderTargetPool::RenderTargetPool( void ) : m_pool( nullptr )
+{
+}
+
+gl::RenderTargetPool::~RenderTargetPool( void )
+{
+    Destroy();
+}
+
+bool gl::RenderTargetPool::Create( const createInfo_t* in_createInfo )
+{
+    if ( in_createInfo == nullptr )
+        return false;
+
+    Destroy();
+
+    m_pool = new glCoreRenderTargetPool_t();
+    m_pool->createInfo = *in_createInfo;
+    return true;
+}
+
+void gl::RenderTargetPool::Destroy( void )
+{
+    if ( m_pool == nullptr )
+        return;
+
+    for ( auto& texture : m_pool->textures )
+        delete texture.second;
+
+    for ( auto& renderBuffer : m_pool->renderBuffers )
+        delete renderBuffer.second;
+
+    delete m_pool;
+    m_pool = nullptr;
+}
+
+gl::Texture* gl::RenderTargetPool::AcquireTexture( const Texture::createInfo_t* in_createInfo )
+{
+    if ( m_pool == nullptr || in_createInfo == nullptr || in_createInfo->sparse )
+        return nullptr;
+
+    const Texture::createInfo_t createInfo = Normalize( in_createInfo );
+    const uint64_t hash = Hash( &createInfo );
+
+    auto bucket = m_pool->freeTextures.find( hash );
+    if ( bucket != m_pool->freeTextures.end() )
+    {
+        auto& candidates = bucket->second;
+        for ( size_t i = 0; i < candidates.size(); i++ )
+        {
+            pooledTexture_t* pooled = candidates[i];
+            if ( !Equal( pooled->createInfo, createInfo ) )
+                continue;
+
+            candidates[i] = candidates.back();
+            candidates.pop_back();
+            pooled->inUse = true;
+            pooled->lastUsed = m_pool->frame;
+            m_pool->stats.reused++;
+            m_pool->stats.inUse++;
+            return &pooled->texture;
+        }
+    }
+
+    pooledTexture_t* pooled = new pooledTexture_t();
+    pooled->createInfo = createInfo;
+    if ( !pooled->texture.Create( &createInfo ) )
+    {
+        delete pooled;
+        return nullptr;
+    }
+
+    bool estimated = false;
+    pooled->hash = hash;
+    pooled->bytes = MemoryTracker::TextureSize( &createInfo, &estimated );
+    pooled->inUse = true;
+    pooled->lastUsed = m_pool->frame;
+    m_pool->textures[&pooled->texture] = pooled;
+    m_pool->stats.created++;
+    m_pool->stats.inUse++;
+    AddBytes( m_pool, pooled->bytes );
+    return &pooled->texture;
+}
+
+gl::RenderBuffer* gl::RenderTargetPool::AcquireRenderBuffer( const renderBufferInfo_t* in_createInfo )
+{
+    if ( m_pool == nullptr || in_createInfo == nullptr )
+        return nullptr;
+
+    const uint64_t hash = Hash( in_createInfo );
+    auto bucket = m_pool->freeRenderBuffers.find( hash );
+    if ( bucket != m_pool->freeRenderBuffers.end() )
+    {
+        auto& candidates = bucket->second;
+        for ( size_t i = 0; i < candidates.size(); i++ )
+        {
+            pooledRenderBuffer_t* pooled = candidates[i];
+            if ( !Equal( pooled->createInfo, *in_createInfo ) )
+                continue;
+
+            candidates[i] = candidates.back();
+            candidates.pop_back();
+            pooled->inUse = true;
+            pooled->lastUsed = m_pool->frame;
+            m_pool->stats.reused++;
+            m_pool->stats.inUse++;
+            return &pooled->renderBuffer;
+        }
+    }
+
+    pooledRenderBuffer_t* pooled = new pooledRenderBuffer_t();
+    pooled->createInfo = *in_createInfo;
+    if ( !pooled->renderBuffer.Create( in_createInfo->width, in_createInfo->height, in_createInfo->samples, in_createInfo->format ) )
+    {
+        delete pooled;
+        return nullptr;
+    }
+
+    bool estimated = false;
+    pooled->hash = hash;
+    pooled->bytes = MemoryTracker::RenderBufferSize( in_createInfo->width, in_createInfo->height, in_createInfo->samples, in_createInfo->format, &estimated );
+    pooled->inUse = true;
+    pooled->lastUsed = m_pool->frame;
+    m_pool->renderBuffers[&pooled->renderBuffer] = pooled;
+    m_pool->stats.created++;
+    m_pool->stats.inUse++;
+    AddBytes( m_pool, pooled->bytes );
+    return &pooled->renderBuffer;
+}
+
+void gl::RenderTargetPool::Release( const Texture* in_texture )
+{
+    if ( m_pool == nullptr )
+        return;
+
+    auto found = m_pool->textures.find( in_texture );
+    if ( found == m_pool->textures.end() || !found->second->inUse )
+        return;
+
+    pooledTexture_t* pooled = found->second;
+    pooled->inUse = false;
+    pooled->lastUsed = m_pool->frame;
+    m_pool->freeTextures[pooled->hash].push_back( pooled );
+    m_pool->stats.inUse--;
+}
+
+void gl::RenderTargetPool::Release( const RenderBuffer* in_renderBuffer )
+{
+    if ( m_pool == nullptr )
+        return;
+
+    auto found = m_pool->renderBuffers.find( in_renderBuffer );
+    if ( found == m_pool->renderBuffers.end() || !found->second->inUse )
+        return;
+
+    pooledRenderBuffer_t* pooled = found->second;
+    pooled->inUse = false;
+    pooled->lastUsed = m_pool->frame;
+    m_pool->freeRenderBuffers[pooled->hash].push_back( pooled );
+    m_pool->stats.inUse--;
+}
+
+static const gl::Texture* PooledTarget( const pooledTexture_t* in_pooled )
+{
+    return &in_pooled->texture;
+}
+
+static const gl::RenderBuffer* PooledTarget( const pooledRenderBuffer_t* in_pooled )
+{
+    return &in_pooled->renderBuffer;
+}
+
+// destroy the free targets last used before in_frame
+template< typename pooled_t, typename target_t >
+static void TrimTargets( glCoreRenderTargetPool_t* in_pool, std::unordered_map<uint64_t, std::vector<pooled_t*>>& in_free, std::unordered_map<const target_t*, pooled_t*>& in_targets, const uint64_t in_frame )
+{
+    for ( auto bucket = in_free.begin(); bucket != in_free.end(); )
+    {
+        auto& candidates = bucket->second;
+        for ( size_t i = 0; i < candidates.size(); )
+        {
+            pooled_t* pooled = candidates[i];
+            if ( pooled->lastUsed >= in_frame )
+            {
+                i++;
+                continue;
+            }
+
+            candidates[i] = candidates.back();
+            candidates.pop_back();
+            in_targets.erase( PooledTarget( pooled ) );
+            in_pool->stats.bytes -= pooled->bytes;
+            in_pool->stats.trimmed++;
+            delete pooled;
+        }
+
+        if ( candidates.empty() )
+            bucket = in_free.erase( bucket );
+        else
+            ++bucket;
+    }
+}
+
+void gl::RenderTargetPool::EndFrame( void )
+{
+    if ( m_pool == nullptr )
+        return;
+
+    // the transient targets live a frame at most
+    for ( auto& texture : m_pool->textures )
+        Release( texture.first );
+
+    for ( auto& renderBuffer : m_pool->renderBuffers )
+        Release( renderBuffer.first );
+
+    if ( m_pool->frame >= m_pool->createInfo.trimFrames )
+    {
+        const uint64_t oldest = m_pool->frame - m_pool->createInfo.trimFrames;
+        TrimTargets( m_pool, m_pool->freeTextures, m_pool->textures, oldest );
+        TrimTargets( m_pool, m_pool->freeRenderBuffers, m_pool->renderBuffers, oldest );
+    }
+
+    m_pool->frame++;
+}
+
+void gl::RenderTargetPool::Trim( void )
+{
+    if ( m_pool == nullptr )
+        return;
+
+    TrimTargets( m_pool, m_pool->freeTextures, m_pool->textures, UINT64_MAX );
+    TrimTargets( m_pool, m_pool->freeRenderBuffers, m_pool->renderBuffers, UINT64_MAX );
+}
+
+gl::renderTargetPoolStats_t gl::RenderTargetPool::Stats( void ) const
+{
+    if ( m_pool == nullptr )
+        return renderTargetPoolStats_t();
+
+    renderTargetPoolStats_t stats = m_pool->stats;
+    stats.textures = static_cast<GLuint>( m_pool->textures.size() );
+    stats.renderBuffers = static_cast<GLuint>( m_pool->renderBuffers.size() );
+    return stats;
+}
+
+uint64_t gl::RenderTargetPool::Hash( const Texture::createInfo_t* in_createInfo )
+{
+    const Texture::createInfo_t createInfo = Normalize( in_createInfo );
+    uint64_t hash = 0xCBF29CE484222325ull;
+    hash = HashCombine( hash, createInfo.target );
+    hash = HashCombine( hash, static_cast<uint64_t>( createInfo.levels ) );
+    hash = HashCombine( hash, static_cast<uint64_t>( createInfo.layers ) );
+    hash = HashCombine( hash, static_cast<uint64_t>( createInfo.samples ) );
+    hash = HashCombine( hash, createInfo.format.internalFormat );
+    hash = HashCombine( hash, createInfo.format.format );
+    hash = HashCombine( hash, static_cast<uint64_t>( createInfo.dimensions.width ) );
+    hash = HashCombine( hash, static_cast<uint64_t>( createInfo.dimensions.height ) );
+    hash = HashCombine( hash, static_cast<uint64_t>( createInfo.dimensions.depth ) );
+    hash = HashCombine( hash, createInfo.fixedsamplelocations );
+    return hash;
+}
+
+uint64_t gl::RenderTargetPool::Hash( const renderBufferInfo_t* in_createInfo )
+{
+    // offset so a renderbuffer never share the hash of a texture
+    uint64_t hash = HashCombine( 0xCBF29CE484222325ull, GL_RENDERBUFFER );
+    hash = HashCombine( hash, in_createInfo->width );
+    hash = HashCombine( hash, in_createInfo->height );
+    hash = HashCombine( hash, in_createInfo->samples );
+    hash = HashCombine( hash, in_createInfo->format );
+    return hash;
+}
@@ -23,6 +23,7 @@
 #include "crglTexture.hpp"
 
 static const char k_INVALID_CREATE_TEXTURE_TARGET_MSG[43] = { "gl::Texture::Create invalid texture target" };
+static const char k_FAILED_TEXTURE_STORAGE_MSG[51] = { "gl::Texture::Create failed to allocate the storage" };
 static const char k_INVALID_SUBIMAGE_TEXTURE_TARGET_MSG[46] = { "gl::Texture::SubImage invalid texture target " };
 
 typedef struct glCoreTexture_t
@@ -30,6 +31,11 @@ typedef struct glCoreTexture_t
     GLenum                  target = gl::texture::TEXTURE_1D;
     gl::Format              format = 0;
     GLuint                  image = 0;
+    GLsizei                 levels = 1;
+    GLint                   residentLevel = 0;          // finest level the sampling can reach
+    bool                    sparse = false;
+    gl::Texture::dimensions_t   dimensions;
+    gl::memoryOwner_t       memory;
 } glCoreTexture_t;
 
 gl::Texture::Texture( void ) : m_image( nullptr )
@@ -75,11 +81,19 @@ bool gl::Texture::Create( const createInfo_t* in_createInfo )
     height  = in_createInfo->dimensions.height;
     depth   = in_createInfo->dimensions.depth;
 
+    m_image->levels = levels;
+    m_image->dimensions = in_createInfo->dimensions;
+    m_image->sparse = in_createInfo->sparse;
+
     /// create texture handler 
     glCreateTextures( m_image->target, 1, &m_image->image );
     if ( m_image->image == 0 )
         return false;
 
+    // must be set before the storage allocation
+    if ( m_image->sparse )
+        glTextureParameteri( m_image->image, GL_TEXTURE_SPARSE_ARB, GL_TRUE );
+
     // allocate the texture memory
     switch ( m_image->target )
     {
@@ -116,6 +130,24 @@ bool gl::Texture::Create( const createInfo_t* in_createInfo )
         return false;
     }
 
+    // a invalid size or a out of memory leave the texture whitout storage
+    GLint immutable = GL_FALSE;
+    glGetTextureParameteriv( m_image->image, GL_TEXTURE_IMMUTABLE_FORMAT, &immutable );
+    if ( immutable == GL_FALSE )
+    {
+        glDebugMessageInsert( GL_DEBUG_SOURCE_THIRD_PARTY, GL_DEBUG_TYPE_ERROR, 0, GL_DEBUG_SEVERITY_HIGH, 50, k_FAILED_TEXTURE_STORAGE_MSG );
+        return false;
+    }
+
+    // sparse textures have no memory until the pages are commited
+    Context* context = Context::Current();
+    if ( context != nullptr && !m_image->sparse )
+    {
+        bool estimated = false;
+        uint64_t size = MemoryTracker::TextureSize( in_createInfo, &estimated );
+        m_image->memory = context->Memory().Track( MEMORY_TEXTURE, m_image->image, size, estimated );
+    }
+
     return m_image->image != 0 && glIsTexture( m_image->image ) == GL_TRUE;
 }
 
@@ -124,8 +156,13 @@ void gl::Texture::Destroy( void )
     if ( m_image == nullptr )
         return;
     
-    if ( m_image->image == 0 )
+    if ( m_image->image != 0 )
     {
+        if ( Context* context = Context::Current() )
+            context->NotifyResourceDestroyed( MEMORY_TEXTURE, m_image->image );
+
+        MemoryTracker::Untrack( m_image->memory, MEMORY_TEXTURE, m_image->image );
+
         glDeleteTextures( 1, &m_image->image );
         m_image->image = 0;
     }
@@ -154,13 +191,14 @@ void gl::Texture::SubImage( const subImage_t *in_subimage, const void* in_pixels
     }
 
     level = in_subimage->level;
+    layer = in_subimage->layer;
     xoffset = in_subimage->offsets.xoffset;
     yoffset = in_subimage->offsets.yoffset;
     zoffset = in_subimage->offsets.zoffset;
     width = in_subimage->dimension.width;
     height = in_subimage->dimension.height;
     depth = in_subimage->dimension.depth;
-    format = m_image->format.format;
+    format = m_image->format.TransferFormat();
     type = m_image->format.DataType();
 
     switch ( m_image->target )
@@ -188,13 +226,16 @@ void gl::Texture::SubImage( const subImage_t *in_subimage, const void* in_pixels
         
     case texture::TEXTURE_CUBE_MAP:
     case texture::TEXTURE_CUBE_MAP_ARRAY:
-        glTextureSubImage3D( m_image->image, level, xoffset, yoffset, layer, width, width, 1, format, type, in_pixels );
+        glTextureSubImage3D( m_image->image, level, xoffset, yoffset, layer, width, height, 1, format, type, in_pixels );
         break;
     
     default:
         glDebugMessageInsert( GL_DEBUG_SOURCE_THIRD_PARTY, GL_DEBUG_TYPE_ERROR, 0, GL_DEBUG_SEVERITY_HIGH, 44, k_INVALID_SUBIMAGE_TEXTURE_TARGET_MSG );
-        break;
+        return;
     }
+
+    if ( Context* context = Context::Current() )
+        context->RecordTextureUpload( m_image->format.ImageSize( width, height, depth ) );
 }
 
 void gl::Texture::CompressedSubImage(const subImage_t *in_subimage, const void *in_pixels)
@@ -225,7 +266,11 @@ void gl::Texture::CompressedSubImage(const subImage_t *in_subimage, const void *
     height = in_subimage->dimension.height;
     depth = in_subimage->dimension.depth;
     imageSize = in_subimage->imageSize;
-    format = m_image->format.format;
+    format = m_image->format.internalFormat;
+
+    // compute the size from the format blocks
+    if ( imageSize == 0 )
+        imageSize = static_cast<GLsizei>( m_image->format.ImageSize( width, height, depth ) );
     
     switch ( m_image->target )
     {
@@ -247,23 +292,26 @@ void gl::Texture::CompressedSubImage(const subImage_t *in_subimage, const void *
             break;
             
         case texture::TEXTURE_2D_ARRAY:
-            glCompressedTextureSubImage3D( m_image->format, level, xoffset, yoffset, layer, width, height, 1, format, imageSize, in_pixels );
+            glCompressedTextureSubImage3D( m_image->image, level, xoffset, yoffset, layer, width, height, 1, format, imageSize, in_pixels );
             break;
         case texture::TEXTURE_CUBE_MAP:
         case texture::TEXTURE_CUBE_MAP_ARRAY:
-            glCompressedTextureSubImage3D( m_image->format, level, xoffset, yoffset, layer, width, width, 1, format, imageSize, in_pixels );
+            glCompressedTextureSubImage3D( m_image->image, level, xoffset, yoffset, layer, width, height, 1, format, imageSize, in_pixels );
             break;
         default:
-        break;
+        return;
     }
 
+    if ( Context* context = Context::Current() )
+        context->RecordTextureUpload( static_cast<uint64_t>( imageSize ) );
+
 }
 
 void gl::Texture::GetImage(const GLint in_level, const GLsizei in_bufSize, void *in_pixels) const
 {
     GLenum format = GL_NONE;
     GLenum type = GL_NONE;
-    if( !m_image || m_image->image )
+    if( !m_image || m_image->image == 0 )
     {   
         // TODO: report a error 
         return;
@@ -532,6 +580,86 @@ GLenum gl::Texture::Target(void) const
     return m_image->target;
 }
 
+gl::Format gl::Texture::PixelFormat( void ) const
+{
+    return m_image->format;
+}
+
+GLsizei gl::Texture::Levels( void ) const
+{
+    if ( !m_image )
+        return 0;
+
+    return m_image->levels;
+}
+
+gl::Texture::dimensions_t gl::Texture::Dimensions( void ) const
+{
+    if ( !m_image )
+        return dimensions_t();
+
+    return m_image->dimensions;
+}
+
+void gl::Texture::SetResidentLevel( const GLint in_level )
+{
+    if ( !m_image || m_image->image == 0 )
+        return;
+
+    // base level stop the sampling of missing levels, the min lod is relative to it so is left alone
+    m_image->residentLevel = std::min<GLint>( std::max<GLint>( in_level, 0 ), m_image->levels - 1 );
+    glTextureParameteri( m_image->image, GL_TEXTURE_BASE_LEVEL, m_image->residentLevel );
+}
+
+GLint gl::Texture::ResidentLevel( void ) const
+{
+    if ( !m_image )
+        return 0;
+
+    return m_image->residentLevel;
+}
+
+void gl::Texture::Commit( const GLint in_level, const offsets_t in_offsets, const dimensions_t in_dimensions, const bool in_commit ) const
+{
+    if ( !m_image || m_image->image == 0 || !m_image->sparse )
+        return;
+
+    glTexturePageCommitmentEXT( m_image->image, in_level, in_offsets.xoffset, in_offsets.yoffset, in_offsets.zoffset, 
+                                in_dimensions.width, in_dimensions.height, std::max<GLsizei>( in_dimensions.depth, 1 ), in_commit ? GL_TRUE : GL_FALSE );
+}
+
+bool gl::Texture::IsSparse( void ) const
+{
+    return m_image != nullptr && m_image->sparse;
+}
+
+GLint gl::Texture::SparseLevels( void ) const
+{
+    GLint levels = 0;
+    if ( !m_image || m_image->image == 0 || !m_image->sparse )
+        return 0;
+
+    glGetTextureParameteriv( m_image->image, GL_NUM_SPARSE_LEVELS_ARB, &levels );
+    return levels;
+}
+
+bool gl::Texture::PageSize( const GLenum in_target, const GLenum in_internalFormat, dimensions_t* in_pageSize )
+{
+    GLint count = 0;
+
+    if ( in_pageSize == nullptr )
+        return false;
+
+    glGetInternalformativ( in_target, in_internalFormat, GL_NUM_VIRTUAL_PAGE_SIZES_ARB, 1, &count );
+    if ( count <= 0 )
+        return false;
+
+    glGetInternalformativ( in_target, in_internalFormat, GL_VIRTUAL_PAGE_SIZE_X_ARB, 1, &in_pageSize->width );
+    glGetInternalformativ( in_target, in_internalFormat, GL_VIRTUAL_PAGE_SIZE_Y_ARB, 1, &in_pageSize->height );
+    glGetInternalformativ( in_target, in_internalFormat, GL_VIRTUAL_PAGE_SIZE_Z_ARB, 1, &in_pageSize->depth );
+    return in_pageSize->width > 0 && in_pageSize->height > 0;
+}
+
 gl::Texture::operator GLuint(void) const
 {
     if ( !m_image )
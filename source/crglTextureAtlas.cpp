@@ -0,0 +1,516 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#include "crglPrecompiled.hpp"
+#include "crglTextureAtlas.hpp"
+
+#include <vector>
+
+typedef struct skylineNode_t
+{
+    GLint   x = 0;
+    GLint   y = 0;
+    GLint   width = 0;
+} skylineNode_t;
+
+typedef struct atlasPage_t
+{
+    std::vector<skylineNode_t>  skyline;
+    GLuint                      images = 0;
+} atlasPage_t;
+
+typedef struct atlasImage_t
+{
+    GLint       page = -1;          // -1 for free entries
+    GLint       x = 0;              // allocation origin, padding included
+    GLint       y = 0;
+    GLsizei     width = 0;          // image dimensions, padding excluded
+    GLsizei     height = 0;
+} atlasImage_t;
+
+typedef struct glCoreTextureAtlas_t
+{
+    gl::TextureAtlas::createInfo_t  createInfo;
+    gl::Texture*                    texture = nullptr;  // recreated when the pages change
+    std::vector<atlasPage_t>        pages;
+    std::vector<atlasImage_t>       images;         // id - 1
+    std::vector<GLuint>             freeIds;
+    uint64_t                        generation = 0;
+    gl::textureAtlasStats_t         stats;
+} glCoreTextureAtlas_t;
+
+static void ResetPage( atlasPage_t* in_page, const GLint in_width )
+{
+    skylineNode_t node;
+    node.width = in_width;
+    in_page->skyline.assign( 1, node );
+    in_page->images = 0;
+}
+
+// the lowest y a rect can be placed starting at node in_index, -1 if it don't fit
+static GLint SkylineFit( const atlasPage_t* in_page, const size_t in_index, const GLint in_width, const GLint in_height, const GLint in_pageWidth, const GLint in_pageHeight )
+{
+    const GLint x = in_page->skyline[in_index].x;
+    if ( x + in_width > in_pageWidth )
+        return -1;
+
+    GLint y = 0;
+    GLint remaining = in_width;
+    for ( size_t i = in_index; remaining > 0 && i < in_page->skyline.size(); i++ )
+    {
+        y = std::max( y, in_page->skyline[i].y );
+        if ( y + in_height > in_pageHeight )
+            return -1;
+
+        remaining -= in_page->skyline[i].width;
+    }
+
+    return y;
+}
+
+static bool SkylineInsert( atlasPage_t* in_page, const GLint in_width, const GLint in_height, const GLint in_pageWidth, const GLint in_pageHeight, GLint* in_x, GLint* in_y )
+{
+    size_t best = in_page->skyline.size();
+    GLint bestY = in_pageHeight;
+    GLint bestWidth = in_pageWidth + 1;
+
+    // bottom left, the narrowest segment break the ties
+    for ( size_t i = 0; i < in_page->skyline.size(); i++ )
+    {
+        const GLint y = SkylineFit( in_page, i, in_width, in_height, in_pageWidth, in_pageHeight );
+        if ( y < 0 )
+            continue;
+
+        if ( y < bestY || ( y == bestY && in_page->skyline[i].width < bestWidth ) )
+        {
+            best = i;
+            bestY = y;
+            bestWidth = in_page->skyline[i].width;
+        }
+    }
+
+    if ( best == in_page->skyline.size() )
+        return false;
+
+    skylineNode_t node;
+    node.x = in_page->skyline[best].x;
+    node.y = bestY + in_height;
+    node.width = in_width;
+    in_page->skyline.insert( in_page->skyline.begin() + static_cast<std::ptrdiff_t>( best ), node );
+
+    // shrink the segments now under the new one
+    for ( size_t i = best + 1; i < in_page->skyline.size(); )
+    {
+        skylineNode_t& next = in_page->skyline[i];
+        const GLint end = node.x + node.width;
+        if ( next.x >= end )
+            break;
+
+        const GLint shrink = end - next.x;
+        if ( next.width <= shrink )
+        {
+            in_page->skyline.erase( in_page->skyline.begin() + static_cast<std::ptrdiff_t>( i ) );
+            continue;
+        }
+
+        next.x += shrink;
+        next.width -= shrink;
+        break;
+    }
+
+    // merge the segments at the same height
+    for ( size_t i = 0; i + 1 < in_page->skyline.size(); )
+    {
+        if ( in_page->skyline[i].y == in_page->skyline[i + 1].y )
+        {
+            in_page->skyline[i].width += in_page->skyline[i + 1].width;
+            in_page->skyline.erase( in_page->skyline.begin() + static_cast<std::ptrdiff_t>( i + 1 ) );
+        }
+        else
+            i++;
+    }
+
+    *in_x = node.x;
+    *in_y = bestY;
+    in_page->images++;
+    return true;
+}
+
+static bool CreatePages( glCoreTextureAtlas_t* in_atlas, gl::Texture* in_texture, const GLsizei in_pages )
+{
+    gl::Texture::createInfo_t textureInfo;
+    textureInfo.target = gl::texture::TEXTURE_2D_ARRAY;
+    textureInfo.format = in_atlas->createInfo.format;
+    textureInfo.layers = in_pages;
+    textureInfo.dimensions.width = in_atlas->createInfo.width;
+    textureInfo.dimensions.height = in_atlas->createInfo.height;
+    if ( !in_texture->Create( &textureInfo ) )
+        return false;
+
+    // the padding must be empty
+    in_texture->Clear( nullptr, 0 );
+    return true;
+}
+
+static void ReplaceTexture( glCoreTextureAtlas_t* in_atlas, gl::Texture* in_texture )
+{
+    delete in_atlas->texture;
+    in_atlas->texture = in_texture;
+    in_atlas->generation++;
+}
+
+// add a page, the existing ones are copied to the new texture
+static bool GrowPages( glCoreTextureAtlas_t* in_atlas )
+{
+    const GLsizei count = static_cast<GLsizei>( in_atlas->pages.size() );
+    if ( count >= in_atlas->createInfo.maxPages )
+        return false;
+
+    gl::Texture* texture = new gl::Texture();
+    if ( !CreatePages( in_atlas, texture, count + 1 ) )
+    {
+        delete texture;
+        return false;
+    }
+
+    gl::Texture::dimensions_t dimensions;
+    dimensions.width = in_atlas->createInfo.width;
+    dimensions.height = in_atlas->createInfo.height;
+    dimensions.depth = count;
+    texture->CopyImage( GL_TEXTURE_2D_ARRAY, in_atlas->texture->Handle(), 0, 0, gl::Texture::offsets_t(), gl::Texture::offsets_t(), dimensions );
+
+    ReplaceTexture( in_atlas, texture );
+    in_atlas->pages.push_back( atlasPage_t() );
+    ResetPage( &in_atlas->pages.back(), in_atlas->createInfo.width );
+    return true;
+}
+
+static bool Allocate( glCoreTextureAtlas_t* in_atlas, const GLint in_width, const GLint in_height, GLint* in_page, GLint* in_x, GLint* in_y )
+{
+    for ( size_t i = 0; i < in_atlas->pages.size(); i++ )
+    {
+        if ( SkylineInsert( &in_atlas->pages[i], in_width, in_height, in_atlas->createInfo.width, in_atlas->createInfo.height, in_x, in_y ) )
+        {
+            *in_page = static_cast<GLint>( i );
+            return true;
+        }
+    }
+
+    return false;
+}
+
+gl::TextureAtlas::TextureAtlas( void ) : m_atlas( nullptr )
+{
+}
+
+gl::TextureAtlas::~TextureAtlas( void )
+{
+    Destroy();
+}
+
+bool gl::TextureAtlas::Create( const createInfo_t* in_createInfo )
+{
+    if ( in_createInfo == nullptr || in_createInfo->width <= 0 || in_createInfo->height <= 0 || in_createInfo->format.IsCompressed() )
+        return false;
+
+    Destroy();
+
+    m_atlas = new glCoreTextureAtlas_t();
+    m_atlas->createInfo = *in_createInfo;
+    m_atlas->createInfo.pages = std::max<GLsizei>( in_createInfo->pages, 1 );
+    m_atlas->createInfo.maxPages = std::max( in_createInfo->maxPages, m_atlas->createInfo.pages );
+    m_atlas->createInfo.padding = std::max( in_createInfo->padding, 0 );
+
+    m_atlas->texture = new Texture();
+    if ( !CreatePages( m_atlas, m_atlas->texture, m_atlas->createInfo.pages ) )
+    {
+        Destroy();
+        return false;
+    }
+
+    m_atlas->pages.resize( static_cast<size_t>( m_atlas->createInfo.pages ) );
+    for ( atlasPage_t& page : m_atlas->pages )
+        ResetPage( &page, m_atlas->createInfo.width );
+
+    return true;
+}
+
+void gl::TextureAtlas::Destroy( void )
+{
+    if ( m_atlas == nullptr )
+        return;
+
+    delete m_atlas->texture;
+    delete m_atlas;
+    m_atlas = nullptr;
+}
+
+GLuint gl::TextureAtlas::Insert( const GLsizei in_width, const GLsizei in_height, const void* in_pixels )
+{
+    GLint page = 0;
+    GLint x = 0;
+    GLint y = 0;
+
+    if ( m_atlas == nullptr || in_width <= 0 || in_height <= 0 )
+        return 0;
+
+    const GLint width = in_width + m_atlas->createInfo.padding * 2;
+    const GLint height = in_height + m_atlas->createInfo.padding * 2;
+    if ( width > m_atlas->createInfo.width || height > m_atlas->createInfo.height )
+    {
+        m_atlas->stats.failed++;
+        return 0;
+    }
+
+    m_atlas->stats.inserts++;
+    bool placed = Allocate( m_atlas, width, height, &page, &x, &y );
+
+    // reclaim the holes before taking more memory
+    const GLfloat threshold = m_atlas->createInfo.repackThreshold;
+    if ( !placed && threshold > 0.0f && m_atlas->stats.freedArea > 0 && 
+        static_cast<GLfloat>( m_atlas->stats.freedArea ) >= threshold * static_cast<GLfloat>( m_atlas->stats.usedArea ) && Repack() )
+        placed = Allocate( m_atlas, width, height, &page, &x, &y );
+
+    if ( !placed && GrowPages( m_atlas ) )
+        placed = Allocate( m_atlas, width, height, &page, &x, &y );
+
+    if ( !placed )
+    {
+        m_atlas->stats.failed++;
+        return 0;
+    }
+
+    GLuint id = 0;
+    if ( !m_atlas->freeIds.empty() )
+    {
+        id = m_atlas->freeIds.back();
+        m_atlas->freeIds.pop_back();
+    }
+    else
+    {
+        m_atlas->images.push_back( atlasImage_t() );
+        id = static_cast<GLuint>( m_atlas->images.size() );
+    }
+
+    atlasImage_t& image = m_atlas->images[id - 1];
+    image.page = page;
+    image.x = x;
+    image.y = y;
+    image.width = in_width;
+    image.height = in_height;
+    m_atlas->stats.usedArea += static_cast<uint64_t>( width ) * static_cast<uint64_t>( height );
+
+    if ( in_pixels != nullptr )
+        Upload( id, in_pixels );
+
+    return id;
+}
+
+void gl::TextureAtlas::Remove( const GLuint in_id )
+{
+    if ( m_atlas == nullptr || in_id == 0 || in_id > m_atlas->images.size() || m_atlas->images[in_id - 1].page < 0 )
+        return;
+
+    atlasImage_t& image = m_atlas->images[in_id - 1];
+    atlasPage_t& page = m_atlas->pages[static_cast<size_t>( image.page )];
+    const uint64_t area = static_cast<uint64_t>( image.width + m_atlas->createInfo.padding * 2 ) * 
+                          static_cast<uint64_t>( image.height + m_atlas->createInfo.padding * 2 );
+
+    // keep the padding empty for the next image
+    Texture::offsets_t offsets;
+    Texture::dimensions_t dimensions;
+    offsets.xoffset = image.x;
+    offsets.yoffset = image.y;
+    offsets.zoffset = image.page;
+    dimensions.width = image.width + m_atlas->createInfo.padding * 2;
+    dimensions.height = image.height + m_atlas->createInfo.padding * 2;
+    dimensions.depth = 1;
+    m_atlas->texture->Clear( nullptr, 0, offsets, dimensions );
+
+    m_atlas->stats.usedArea -= area;
+    m_atlas->stats.freedArea += area;
+
+    // a empty page is reclaimed at once
+    if ( --page.images == 0 )
+    {
+        uint64_t reclaimed = 0;
+        for ( const skylineNode_t& node : page.skyline )
+            reclaimed += static_cast<uint64_t>( node.width ) * static_cast<uint64_t>( node.y );
+
+        ResetPage( &page, m_atlas->createInfo.width );
+        m_atlas->stats.freedArea -= std::min( reclaimed, m_atlas->stats.freedArea );
+    }
+
+    image.page = -1;
+    m_atlas->freeIds.push_back( in_id );
+}
+
+void gl::TextureAtlas::Upload( const GLuint in_id, const void* in_pixels ) const
+{
+    if ( m_atlas == nullptr || in_pixels == nullptr || in_id == 0 || in_id > m_atlas->images.size() || m_atlas->images[in_id - 1].page < 0 )
+        return;
+
+    const atlasImage_t& image = m_atlas->images[in_id - 1];
+    Texture::subImage_t subImage;
+    subImage.layer = image.page;
+    subImage.offsets.xoffset = image.x + m_atlas->createInfo.padding;
+    subImage.offsets.yoffset = image.y + m_atlas->createInfo.padding;
+    subImage.dimension.width = image.width;
+    subImage.dimension.height = image.height;
+    subImage.dimension.depth = 1;
+
+    // the images are tightly packed
+    GLint alignment = 4;
+    glGetIntegerv( GL_UNPACK_ALIGNMENT, &alignment );
+    glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+    m_atlas->texture->SubImage( &subImage, in_pixels );
+    glPixelStorei( GL_UNPACK_ALIGNMENT, alignment );
+}
+
+bool gl::TextureAtlas::Rect( const GLuint in_id, atlasRect_t* in_rect ) const
+{
+    if ( m_atlas == nullptr || in_rect == nullptr || in_id == 0 || in_id > m_atlas->images.size() || m_atlas->images[in_id - 1].page < 0 )
+        return false;
+
+    const atlasImage_t& image = m_atlas->images[in_id - 1];
+    const GLfloat width = static_cast<GLfloat>( m_atlas->createInfo.width );
+    const GLfloat height = static_cast<GLfloat>( m_atlas->createInfo.height );
+    in_rect->layer = image.page;
+    in_rect->x = image.x + m_atlas->createInfo.padding;
+    in_rect->y = image.y + m_atlas->createInfo.padding;
+    in_rect->width = image.width;
+    in_rect->height = image.height;
+    in_rect->u0 = static_cast<GLfloat>( in_rect->x ) / width;
+    in_rect->v0 = static_cast<GLfloat>( in_rect->y ) / height;
+    in_rect->u1 = static_cast<GLfloat>( in_rect->x + image.width ) / width;
+    in_rect->v1 = static_cast<GLfloat>( in_rect->y + image.height ) / height;
+    return true;
+}
+
+bool gl::TextureAtlas::Repack( void )
+{
+    if ( m_atlas == nullptr )
+        return false;
+
+    // tallest first pack the skyline tighter
+    std::vector<GLuint> order;
+    for ( size_t i = 0; i < m_atlas->images.size(); i++ )
+    {
+        if ( m_atlas->images[i].page >= 0 )
+            order.push_back( static_cast<GLuint>( i ) );
+    }
+
+    std::sort( order.begin(), order.end(), [this]( const GLuint in_a, const GLuint in_b ) 
+    {
+        const atlasImage_t& a = m_atlas->images[in_a];
+        const atlasImage_t& b = m_atlas->images[in_b];
+        return ( a.height != b.height ) ? a.height > b.height : a.width > b.width;
+    } );
+
+    // place in a new layout, grow only if the old page count is not enough
+    const GLint padding = m_atlas->createInfo.padding;
+    std::vector<atlasPage_t> pages( m_atlas->pages.size() );
+    std::vector<atlasImage_t> placed( m_atlas->images );
+    for ( atlasPage_t& page : pages )
+        ResetPage( &page, m_atlas->createInfo.width );
+
+    for ( GLuint index : order )
+    {
+        atlasImage_t& image = placed[index];
+        const GLint width = image.width + padding * 2;
+        const GLint height = image.height + padding * 2;
+        bool fit = false;
+        while ( !fit )
+        {
+            for ( size_t i = 0; i < pages.size() && !fit; i++ )
+            {
+                if ( SkylineInsert( &pages[i], width, height, m_atlas->createInfo.width, m_atlas->createInfo.height, &image.x, &image.y ) )
+                {
+                    image.page = static_cast<GLint>( i );
+                    fit = true;
+                }
+            }
+
+            if ( fit )
+                break;
+
+            if ( static_cast<GLsizei>( pages.size() ) >= m_atlas->createInfo.maxPages )
+                return false;
+
+            pages.push_back( atlasPage_t() );
+            ResetPage( &pages.back(), m_atlas->createInfo.width );
+        }
+    }
+
+    Texture* texture = new Texture();
+    if ( !CreatePages( m_atlas, texture, static_cast<GLsizei>( pages.size() ) ) )
+    {
+        delete texture;
+        return false;
+    }
+
+    for ( GLuint index : order )
+    {
+        const atlasImage_t& source = m_atlas->images[index];
+        const atlasImage_t& destine = placed[index];
+        Texture::offsets_t srcOffsets;
+        Texture::offsets_t dstOffsets;
+        Texture::dimensions_t dimensions;
+        srcOffsets.xoffset = source.x + padding;
+        srcOffsets.yoffset = source.y + padding;
+        srcOffsets.zoffset = source.page;
+        dstOffsets.xoffset = destine.x + padding;
+        dstOffsets.yoffset = destine.y + padding;
+        dstOffsets.zoffset = destine.page;
+        dimensions.width = source.width;
+        dimensions.height = source.height;
+        dimensions.depth = 1;
+        texture->CopyImage( GL_TEXTURE_2D_ARRAY, m_atlas->texture->Handle(), 0, 0, srcOffsets, dstOffsets, dimensions );
+    }
+
+    ReplaceTexture( m_atlas, texture );
+    m_atlas->pages.swap( pages );
+    m_atlas->images.swap( placed );
+    m_atlas->stats.freedArea = 0;
+    m_atlas->stats.repacks++;
+    return true;
+}
+
+uint64_t gl::TextureAtlas::Generation( void ) const
+{
+    return ( m_atlas != nullptr ) ? m_atlas->generation : 0;
+}
+
+const gl::Texture* gl::TextureAtlas::GetTexture( void ) const
+{
+    return ( m_atlas != nullptr ) ? m_atlas->texture : nullptr;
+}
+
+gl::textureAtlasStats_t gl::TextureAtlas::Stats( void ) const
+{
+    if ( m_atlas == nullptr )
+        return textureAtlasStats_t();
+
+    textureAtlasStats_t stats = m_atlas->stats;
+    stats.images = static_cast<GLuint>( m_atlas->images.size() - m_atlas->freeIds.size() );
+    stats.pages = static_cast<GLuint>( m_atlas->pages.size() );
+    return stats;
+}
@@ -0,0 +1,338 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#include "crglPrecompiled.hpp"
+#include "crglTextureUploader.hpp"
+
+#include <deque>
+#include <mutex>
+#include <vector>
+
+enum uploadState_t
+{
+    UPLOAD_ALLOCATED = 0,   // the caller is writing it
+    UPLOAD_QUEUED,          // waiting Flush
+    UPLOAD_ISSUED,          // in a fenced batch
+    UPLOAD_DISCARDED        // free as soon as it reach the ring tail
+};
+
+typedef struct uploadRecord_t
+{
+    uint64_t        id = 0;
+    GLsizeiptr      offset = 0;
+    GLsizeiptr      size = 0;
+    uploadState_t   state = UPLOAD_ALLOCATED;
+    uint64_t        batch = 0;
+} uploadRecord_t;
+
+typedef struct uploadRequest_t
+{
+    uint64_t                id = 0;
+    gl::Texture*            texture = nullptr;
+    gl::Texture::subImage_t subImage;
+} uploadRequest_t;
+
+typedef struct uploadBatch_t
+{
+    uint64_t    batch = 0;
+    GLsync      fence = nullptr;
+} uploadBatch_t;
+
+typedef struct glCoreTextureUploader_t
+{
+    gl::TextureUploader::createInfo_t   createInfo;
+    gl::Buffer                          buffer;
+    uint8_t*                            mapped = nullptr;
+
+    mutable std::mutex                  lock;
+    std::deque<uploadRecord_t>          records;        // allocation order
+    std::vector<uploadRequest_t>        requests;
+    GLsizeiptr                          head = 0;       // next allocation offset
+    uint64_t                            nextId = 1;
+    gl::textureUploaderStats_t          stats;
+
+    // GL thread only
+    std::deque<uploadBatch_t>           batches;
+    uint64_t                            nextBatch = 1;
+    uint64_t                            completedBatch = 0;
+} glCoreTextureUploader_t;
+
+static uploadRecord_t* FindRecord( glCoreTextureUploader_t* in_uploader, const uint64_t in_id )
+{
+    if ( in_uploader->records.empty() || in_id < in_uploader->records.front().id )
+        return nullptr;
+
+    // ids are consecutive in the deque
+    uint64_t index = in_id - in_uploader->records.front().id;
+    if ( index >= in_uploader->records.size() )
+        return nullptr;
+
+    return &in_uploader->records[index];
+}
+
+static void Recycle( glCoreTextureUploader_t* in_uploader )
+{
+    // the ring tail move over the finished regions
+    while ( !in_uploader->records.empty() )
+    {
+        const uploadRecord_t& record = in_uploader->records.front();
+        bool done = record.state == UPLOAD_DISCARDED || ( record.state == UPLOAD_ISSUED && record.batch <= in_uploader->completedBatch );
+        if ( !done )
+            break;
+
+        in_uploader->stats.inUse -= record.size;
+        in_uploader->records.pop_front();
+    }
+
+    if ( in_uploader->records.empty() )
+        in_uploader->head = 0;
+}
+
+gl::TextureUploader::TextureUploader( void ) : m_uploader( nullptr )
+{
+}
+
+gl::TextureUploader::~TextureUploader( void )
+{
+    Destroy();
+}
+
+bool gl::TextureUploader::Create( const createInfo_t* in_createInfo )
+{
+    if ( in_createInfo == nullptr || in_createInfo->size <= 0 )
+        return false;
+
+    Destroy();
+
+    m_uploader = new glCoreTextureUploader_t();
+    m_uploader->createInfo = *in_createInfo;
+    m_uploader->createInfo.alignment = std::max<GLsizeiptr>( in_createInfo->alignment, 4 );
+
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    m_uploader->buffer.Create( GL_PIXEL_UNPACK_BUFFER, in_createInfo->size, nullptr, flags );
+    m_uploader->mapped = static_cast<uint8_t*>( m_uploader->buffer.Map( 0, in_createInfo->size, flags ) );
+    if ( m_uploader->mapped == nullptr )
+    {
+        Destroy();
+        return false;
+    }
+
+    return true;
+}
+
+void gl::TextureUploader::Destroy( void )
+{
+    if ( m_uploader == nullptr )
+        return;
+
+    if ( m_uploader->mapped != nullptr )
+    {
+        Flush();
+        for ( auto& batch : m_uploader->batches )
+        {
+            glClientWaitSync( batch.fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED );
+            glDeleteSync( batch.fence );
+        }
+
+        m_uploader->buffer.Unmap();
+    }
+
+    m_uploader->buffer.Destroy();
+    delete m_uploader;
+    m_uploader = nullptr;
+}
+
+bool gl::TextureUploader::Allocate( const GLsizeiptr in_size, uploadRegion_t* in_region )
+{
+    if ( m_uploader == nullptr || in_region == nullptr || in_size <= 0 )
+        return false;
+
+    const GLsizeiptr size = m_uploader->createInfo.size;
+    const GLsizeiptr alignment = m_uploader->createInfo.alignment;
+    std::lock_guard<std::mutex> lock( m_uploader->lock );
+
+    GLsizeiptr offset = ( ( m_uploader->head + alignment - 1 ) / alignment ) * alignment;
+    if ( !m_uploader->records.empty() )
+    {
+        const GLsizeiptr tail = m_uploader->records.front().offset;
+        if ( m_uploader->head >= tail )
+        {
+            // space until the end, else wrap before the tail
+            if ( offset + in_size > size )
+                offset = 0;
+            
+            if ( offset == 0 && in_size >= tail )
+                offset = -1;
+        }
+        else if ( offset + in_size >= tail )
+            offset = -1;
+    }
+    else if ( offset + in_size > size )
+        offset = ( in_size <= size ) ? 0 : -1;
+
+    if ( offset < 0 )
+    {
+        m_uploader->stats.failed++;
+        return false;
+    }
+
+    uploadRecord_t record;
+    record.id = m_uploader->nextId++;
+    record.offset = offset;
+    record.size = in_size;
+    m_uploader->records.push_back( record );
+    m_uploader->head = offset + in_size;
+    m_uploader->stats.inUse += in_size;
+
+    in_region->data = m_uploader->mapped + offset;
+    in_region->offset = offset;
+    in_region->size = in_size;
+    in_region->id = record.id;
+    return true;
+}
+
+bool gl::TextureUploader::Upload( const uploadRegion_t* in_region, Texture* in_texture, const Texture::subImage_t* in_subImage )
+{
+    if ( m_uploader == nullptr || in_region == nullptr || in_texture == nullptr || in_subImage == nullptr )
+        return false;
+
+    std::lock_guard<std::mutex> lock( m_uploader->lock );
+    uploadRecord_t* record = FindRecord( m_uploader, in_region->id );
+    if ( record == nullptr || record->state != UPLOAD_ALLOCATED )
+        return false;
+
+    record->state = UPLOAD_QUEUED;
+
+    uploadRequest_t request;
+    request.id = in_region->id;
+    request.texture = in_texture;
+    request.subImage = *in_subImage;
+    m_uploader->requests.push_back( request );
+    return true;
+}
+
+void gl::TextureUploader::Discard( const uploadRegion_t* in_region )
+{
+    if ( m_uploader == nullptr || in_region == nullptr )
+        return;
+
+    std::lock_guard<std::mutex> lock( m_uploader->lock );
+    uploadRecord_t* record = FindRecord( m_uploader, in_region->id );
+    if ( record != nullptr && record->state == UPLOAD_ALLOCATED )
+    {
+        record->state = UPLOAD_DISCARDED;
+        Recycle( m_uploader );
+    }
+}
+
+bool gl::TextureUploader::Upload( Texture* in_texture, const Texture::subImage_t* in_subImage, const void* in_pixels, const GLsizeiptr in_size )
+{
+    uploadRegion_t region;
+
+    if ( in_pixels == nullptr || !Allocate( in_size, &region ) )
+        return false;
+
+    std::memcpy( region.data, in_pixels, static_cast<size_t>( in_size ) );
+    return Upload( &region, in_texture, in_subImage );
+}
+
+GLuint gl::TextureUploader::Flush( void )
+{
+    std::vector<uploadRequest_t> requests;
+    GLint alignment = 4;
+
+    if ( m_uploader == nullptr )
+        return 0;
+
+    {
+        std::lock_guard<std::mutex> lock( m_uploader->lock );
+        requests.swap( m_uploader->requests );
+    }
+
+    if ( !requests.empty() )
+    {
+        const uint64_t batch = m_uploader->nextBatch++;
+        uint64_t bytes = 0;
+
+        glGetIntegerv( GL_UNPACK_ALIGNMENT, &alignment );
+        glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+        glBindBuffer( GL_PIXEL_UNPACK_BUFFER, m_uploader->buffer.GetHandle() );
+        for ( auto& request : requests )
+        {
+            GLsizeiptr offset = 0;
+            {
+                std::lock_guard<std::mutex> lock( m_uploader->lock );
+                uploadRecord_t* record = FindRecord( m_uploader, request.id );
+                offset = record->offset;
+                bytes += static_cast<uint64_t>( record->size );
+            }
+
+            const void* pixels = reinterpret_cast<const void*>( offset );
+            if ( request.texture->PixelFormat().IsCompressed() )
+                request.texture->CompressedSubImage( &request.subImage, pixels );
+            else
+                request.texture->SubImage( &request.subImage, pixels );
+        }
+        glBindBuffer( GL_PIXEL_UNPACK_BUFFER, 0 );
+        glPixelStorei( GL_UNPACK_ALIGNMENT, alignment );
+
+        uploadBatch_t fenced;
+        fenced.batch = batch;
+        fenced.fence = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+        m_uploader->batches.push_back( fenced );
+
+        std::lock_guard<std::mutex> lock( m_uploader->lock );
+        for ( auto& request : requests )
+        {
+            uploadRecord_t* record = FindRecord( m_uploader, request.id );
+            record->state = UPLOAD_ISSUED;
+            record->batch = batch;
+        }
+
+        m_uploader->stats.uploads += requests.size();
+        m_uploader->stats.bytes += bytes;
+    }
+
+    // batches finish in order
+    while ( !m_uploader->batches.empty() )
+    {
+        uploadBatch_t& batch = m_uploader->batches.front();
+        if ( glClientWaitSync( batch.fence, 0, 0 ) == GL_TIMEOUT_EXPIRED )
+            break;
+
+        glDeleteSync( batch.fence );
+        m_uploader->completedBatch = batch.batch;
+        m_uploader->batches.pop_front();
+    }
+
+    std::lock_guard<std::mutex> lock( m_uploader->lock );
+    Recycle( m_uploader );
+    return static_cast<GLuint>( requests.size() );
+}
+
+gl::textureUploaderStats_t gl::TextureUploader::Stats( void ) const
+{
+    if ( m_uploader == nullptr )
+        return textureUploaderStats_t();
+
+    std::lock_guard<std::mutex> lock( m_uploader->lock );
+    return m_uploader->stats;
+}
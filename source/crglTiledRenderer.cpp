@@ -0,0 +1,487 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#include "crglPrecompiled.hpp"
+#include "crglTiledRenderer.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/// @brief largest default tile side, bigger tiles don't speed up and cost readback memory
+static constexpr GLuint k_MAX_DEFAULT_TILE_SIZE = 2048;
+
+typedef struct glCoreTiledRenderer_t
+{
+    gl::TiledRenderer::createInfo_t     createInfo;
+    GLuint                              tileWidth = 0;
+    GLuint                              tileHeight = 0;
+    GLuint                              columns = 0;
+    GLuint                              rows = 0;
+    GLuint                              bytesPerPixel = 0;
+    GLsizeiptr                          rowPitch = 0;       // image row bytes
+
+    // sequential rendering
+    gl::Texture                         color;
+    gl::RenderBuffer                    depth;
+    gl::FrameBuffer                     frameBuffer;
+    gl::FrameReader                     reader;
+    GLuint                              received = 0;       // tiles read back in the current image
+
+    // stitching, a row of tiles, bottom to top like OpenGL
+    std::vector<uint8_t>                band;
+    std::vector<uint8_t>                flipRow;
+    FILE*                               file = nullptr;
+    std::atomic<bool>                   failed{ false };
+
+    // farm rendering
+    gl::TiledScene*                     scene = nullptr;
+    std::mutex                          lock;
+    std::condition_variable             done;
+    GLuint                              pending = 0;        // farm tiles of the band not finished
+
+    gl::tiledRendererStats_t            stats;
+} glCoreTiledRenderer_t;
+
+/// @brief a tile rendered by a farm worker
+class TiledJob : public gl::RenderJob
+{
+public:
+    glCoreTiledRenderer_t*  renderer = nullptr;
+    gl::tile_t              tile;
+
+    void    Render( gl::Context* in_context ) override;
+    void    Finished( const void* in_pixels, const GLuint in_width, const GLuint in_height ) override;
+};
+
+static void RenderError( const char* in_message )
+{
+    if ( gl::Context* context = gl::Context::Current() )
+        context->DebugOuput( in_message );
+}
+
+/// @brief netpbm header of the 8 bits formats, false if the format can't be written
+static bool FileHeader( const GLenum in_format, const GLuint in_width, const GLuint in_height, char* in_header, const size_t in_size )
+{
+    switch ( in_format )
+    {
+    case GL_R8:
+        std::snprintf( in_header, in_size, "P5\n%u %u\n255\n", in_width, in_height );
+        return true;
+    case GL_RGB8:
+        std::snprintf( in_header, in_size, "P6\n%u %u\n255\n", in_width, in_height );
+        return true;
+    case GL_RG8:
+        std::snprintf( in_header, in_size, "P7\nWIDTH %u\nHEIGHT %u\nDEPTH 2\nMAXVAL 255\nTUPLTYPE GRAYSCALE_ALPHA\nENDHDR\n", in_width, in_height );
+        return true;
+    case GL_RGBA8:
+        std::snprintf( in_header, in_size, "P7\nWIDTH %u\nHEIGHT %u\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n", in_width, in_height );
+        return true;
+    default:
+        return false;
+    }
+}
+
+/// @brief copy the tile region of the readback in the band, the tile is at the readback bottom left
+static void CopyTile( glCoreTiledRenderer_t* in_renderer, const gl::tile_t* in_tile, const void* in_pixels, const GLuint in_width )
+{
+    const size_t bpp = in_renderer->bytesPerPixel;
+    const size_t sourcePitch = static_cast<size_t>( in_width ) * bpp;
+    const size_t columnOffset = static_cast<size_t>( in_tile->x ) * bpp;
+    const size_t bytes = static_cast<size_t>( in_tile->width ) * bpp;
+    const uint8_t* source = static_cast<const uint8_t*>( in_pixels );
+    uint8_t* band = in_renderer->band.data();
+
+    for ( GLuint row = 0; row < in_tile->height; row++ )
+        std::memcpy( band + row * static_cast<size_t>( in_renderer->rowPitch ) + columnOffset, source + row * sourcePitch, bytes );
+}
+
+/// @brief flip the complete band to top to bottom order and hand it to the outputs
+static void WriteBand( glCoreTiledRenderer_t* in_renderer, const gl::tile_t* in_tile )
+{
+    if ( in_renderer->failed )
+        return;
+
+    const size_t pitch = static_cast<size_t>( in_renderer->rowPitch );
+    const GLuint count = in_tile->height;
+    uint8_t* band = in_renderer->band.data();
+    for ( GLuint row = 0; row < count / 2; row++ )
+    {
+        uint8_t* top = band + ( count - 1 - row ) * pitch;
+        uint8_t* bottom = band + row * pitch;
+        std::memcpy( in_renderer->flipRow.data(), top, pitch );
+        std::memcpy( top, bottom, pitch );
+        std::memcpy( bottom, in_renderer->flipRow.data(), pitch );
+    }
+
+    const size_t bytes = pitch * count;
+    if ( in_renderer->file != nullptr && std::fwrite( band, 1, bytes, in_renderer->file ) != bytes )
+        in_renderer->failed = true;
+
+    // first row from the image top
+    const GLuint first = in_tile->imageHeight - ( in_tile->y + in_tile->height );
+    const gl::TiledRenderer::createInfo_t& createInfo = in_renderer->createInfo;
+    if ( createInfo.writer != nullptr && !createInfo.writer( band, first, count, in_renderer->rowPitch, createInfo.userData ) )
+        in_renderer->failed = true;
+
+    in_renderer->stats.bands++;
+    in_renderer->stats.bytesWritten += bytes;
+}
+
+static gl::tile_t MakeTile( const glCoreTiledRenderer_t* in_renderer, const GLuint in_column, const GLuint in_row )
+{
+    gl::tile_t tile;
+    const GLuint width = in_renderer->createInfo.width;
+    const GLuint height = in_renderer->createInfo.height;
+    const GLuint top = height - in_row * in_renderer->tileHeight;
+
+    tile.column = in_column;
+    tile.row = in_row;
+    tile.x = in_column * in_renderer->tileWidth;
+    tile.y = ( top > in_renderer->tileHeight ) ? top - in_renderer->tileHeight : 0;
+    tile.width = std::min( in_renderer->tileWidth, width - tile.x );
+    tile.height = top - tile.y;
+    tile.imageWidth = width;
+    tile.imageHeight = height;
+
+    // scale the tile region to the whole clip space
+    const double scaleX = static_cast<double>( width ) / tile.width;
+    const double scaleY = static_cast<double>( height ) / tile.height;
+    const double centerX = ( 2.0 * tile.x + tile.width ) / width - 1.0;
+    const double centerY = ( 2.0 * tile.y + tile.height ) / height - 1.0;
+    tile.offset[0] = static_cast<GLfloat>( scaleX );
+    tile.offset[5] = static_cast<GLfloat>( scaleY );
+    tile.offset[12] = static_cast<GLfloat>( -centerX * scaleX );
+    tile.offset[13] = static_cast<GLfloat>( -centerY * scaleY );
+    return tile;
+}
+
+static gl::viewport_t TileViewport( const gl::tile_t* in_tile )
+{
+    gl::viewport_t viewport;
+    viewport.width = static_cast<GLfloat>( in_tile->width );
+    viewport.height = static_cast<GLfloat>( in_tile->height );
+    viewport.far = 1.0f;
+    return viewport;
+}
+
+/// @brief sequential readbacks, tiles arrive in capture order on the reader thread
+static void TileReadback( const gl::frame_t* in_frame, void* in_userData )
+{
+    glCoreTiledRenderer_t* renderer = static_cast<glCoreTiledRenderer_t*>( in_userData );
+    const GLuint index = renderer->received++;
+    const gl::tile_t tile = MakeTile( renderer, index % renderer->columns, index / renderer->columns );
+
+    CopyTile( renderer, &tile, in_frame->pixels, in_frame->width );
+    renderer->stats.tiles++;
+    if ( tile.column == renderer->columns - 1 )
+        WriteBand( renderer, &tile );
+}
+
+void TiledJob::Render( gl::Context* in_context )
+{
+    in_context->SetViewportState( 0, TileViewport( &tile ) );
+    renderer->scene->Render( in_context, &tile );
+}
+
+void TiledJob::Finished( const void* in_pixels, const GLuint in_width, const GLuint in_height )
+{
+    // a failed readback or a framebuffer that can't hold the tile fail the whole image
+    if ( in_pixels == nullptr || in_width < tile.width || in_height < tile.height )
+    {
+        RenderError( "TiledRenderer error: the farm readback don't cover the tile\n" );
+        renderer->failed = true;
+    }
+    else
+    {
+        // the tiles of a band don't overlap
+        CopyTile( renderer, &tile, in_pixels, in_width );
+    }
+
+    std::lock_guard<std::mutex> lock( renderer->lock );
+    renderer->stats.tiles++;
+    renderer->pending--;
+    renderer->done.notify_all();
+}
+
+gl::TiledRenderer::TiledRenderer( void ) : m_renderer( nullptr )
+{
+}
+
+gl::TiledRenderer::~TiledRenderer( void )
+{
+    Destroy();
+}
+
+bool gl::TiledRenderer::Create( const createInfo_t* in_createInfo )
+{
+    if ( in_createInfo == nullptr || in_createInfo->width == 0 || in_createInfo->height == 0 )
+        return false;
+
+    Destroy();
+
+    char header[128];
+    const Format format = in_createInfo->colorFormat;
+    if ( in_createInfo->path != nullptr && !FileHeader( format.internalFormat, 1, 1, header, sizeof( header ) ) )
+    {
+        RenderError( "TiledRenderer error: file output support only R8, RG8, RGB8 and RGBA8, use a writer\n" );
+        return false;
+    }
+
+    m_renderer = new glCoreTiledRenderer_t();
+    m_renderer->createInfo = *in_createInfo;
+    m_renderer->bytesPerPixel = format.BytesPerPixel();
+    m_renderer->tileWidth = in_createInfo->tileWidth;
+    m_renderer->tileHeight = in_createInfo->tileHeight;
+
+    if ( in_createInfo->farm != nullptr )
+    {
+        // the tiles are rendered at the farm framebuffer bottom left
+        if ( m_renderer->tileWidth == 0 || m_renderer->tileHeight == 0 ||
+             m_renderer->tileWidth > in_createInfo->farm->Width() || m_renderer->tileHeight > in_createInfo->farm->Height() )
+        {
+            RenderError( "TiledRenderer error: the tile size must fit the farm framebuffer, start the farm first\n" );
+            Destroy();
+            return false;
+        }
+
+        // the tiles are copied from the farm readback, in the farm format
+        if ( in_createInfo->farm->ColorFormat().internalFormat != format.internalFormat )
+        {
+            RenderError( "TiledRenderer error: the color format must match the farm color format\n" );
+            Destroy();
+            return false;
+        }
+    }
+    else
+    {
+        GLint maxTexture = 0;
+        GLint maxRenderBuffer = 0;
+        GLint maxViewport[2] = { 0, 0 };
+        glGetIntegerv( GL_MAX_TEXTURE_SIZE, &maxTexture );
+        glGetIntegerv( GL_MAX_RENDERBUFFER_SIZE, &maxRenderBuffer );
+        glGetIntegerv( GL_MAX_VIEWPORT_DIMS, maxViewport );
+
+        const GLuint maxWidth = static_cast<GLuint>( std::min( { maxTexture, maxRenderBuffer, maxViewport[0] } ) );
+        const GLuint maxHeight = static_cast<GLuint>( std::min( { maxTexture, maxRenderBuffer, maxViewport[1] } ) );
+        if ( m_renderer->tileWidth == 0 )
+            m_renderer->tileWidth = std::min( maxWidth, k_MAX_DEFAULT_TILE_SIZE );
+        if ( m_renderer->tileHeight == 0 )
+            m_renderer->tileHeight = std::min( maxHeight, k_MAX_DEFAULT_TILE_SIZE );
+
+        // no point in tiles bigger than the image
+        m_renderer->tileWidth = std::min( m_renderer->tileWidth, in_createInfo->width );
+        m_renderer->tileHeight = std::min( m_renderer->tileHeight, in_createInfo->height );
+        if ( m_renderer->tileWidth == 0 || m_renderer->tileHeight == 0 || m_renderer->tileWidth > maxWidth || m_renderer->tileHeight > maxHeight )
+        {
+            RenderError( "TiledRenderer error: the tile size exceed the context limits\n" );
+            Destroy();
+            return false;
+        }
+
+        std::vector<FrameBuffer::attachament_t> attachaments;
+        Texture::createInfo_t colorInfo;
+        colorInfo.target = GL_TEXTURE_2D;
+        colorInfo.format = format;
+        colorInfo.dimensions.width = static_cast<GLsizei>( m_renderer->tileWidth );
+        colorInfo.dimensions.height = static_cast<GLsizei>( m_renderer->tileHeight );
+        colorInfo.fixedsamplelocations = GL_TRUE;
+        bool created = m_renderer->color.Create( &colorInfo );
+        attachaments.push_back( { GL_TEXTURE_2D, GL_COLOR_ATTACHMENT0, m_renderer->color.Handle() } );
+
+        if ( in_createInfo->depthFormat != GL_NONE )
+        {
+            GLenum attachament = Format( in_createInfo->depthFormat ).IsStencil() ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+            created = created && m_renderer->depth.Create( m_renderer->tileWidth, m_renderer->tileHeight, 0, in_createInfo->depthFormat );
+            attachaments.push_back( { GL_RENDERBUFFER, attachament, m_renderer->depth.GetHandle() } );
+        }
+
+        FrameReader::createInfo_t readerInfo;
+        readerInfo.width = m_renderer->tileWidth;
+        readerInfo.height = m_renderer->tileHeight;
+        readerInfo.format = format;
+        readerInfo.depth = std::max( in_createInfo->readbackDepth, 1u );
+        readerInfo.dropWhenFull = false;
+        readerInfo.consumer = TileReadback;
+        readerInfo.userData = m_renderer;
+
+        if ( !created || !m_renderer->frameBuffer.Create() || 
+             !m_renderer->frameBuffer.Attach( attachaments.data(), 0, static_cast<GLuint>( attachaments.size() ) ) ||
+             !m_renderer->reader.Create( &readerInfo ) )
+        {
+            RenderError( "TiledRenderer error: failed to create the tile framebuffer\n" );
+            Destroy();
+            return false;
+        }
+    }
+
+    m_renderer->columns = ( in_createInfo->width + m_renderer->tileWidth - 1 ) / m_renderer->tileWidth;
+    m_renderer->rows = ( in_createInfo->height + m_renderer->tileHeight - 1 ) / m_renderer->tileHeight;
+    m_renderer->rowPitch = static_cast<GLsizeiptr>( in_createInfo->width ) * m_renderer->bytesPerPixel;
+    m_renderer->band.resize( static_cast<size_t>( m_renderer->rowPitch ) * m_renderer->tileHeight );
+    m_renderer->flipRow.resize( static_cast<size_t>( m_renderer->rowPitch ) );
+    m_renderer->stats.bandBytes = m_renderer->band.size();
+    return true;
+}
+
+void gl::TiledRenderer::Destroy( void )
+{
+    if ( m_renderer == nullptr )
+        return;
+
+    m_renderer->reader.Destroy();
+    m_renderer->frameBuffer.Destroy();
+    m_renderer->color.Destroy();
+    m_renderer->depth.Destroy();
+    delete m_renderer;
+    m_renderer = nullptr;
+}
+
+bool gl::TiledRenderer::Render( TiledScene* in_scene )
+{
+    if ( m_renderer == nullptr || in_scene == nullptr )
+        return false;
+
+    const createInfo_t& createInfo = m_renderer->createInfo;
+    Context* context = Context::Current();
+    if ( createInfo.farm == nullptr && context == nullptr )
+        return false;
+
+    m_renderer->failed = false;
+    m_renderer->received = 0;
+    m_renderer->scene = in_scene;
+    if ( createInfo.path != nullptr )
+    {
+        char header[128];
+        m_renderer->file = std::fopen( createInfo.path, "wb" );
+        FileHeader( createInfo.colorFormat.internalFormat, createInfo.width, createInfo.height, header, sizeof( header ) );
+        if ( m_renderer->file == nullptr || std::fputs( header, m_renderer->file ) < 0 )
+        {
+            RenderError( "TiledRenderer error: can't write the output file\n" );
+            m_renderer->failed = true;
+        }
+    }
+
+    if ( createInfo.farm != nullptr )
+    {
+        // a band at time, the farm order the tiles freely
+        std::vector<TiledJob> jobs( m_renderer->columns );
+        for ( GLuint row = 0; row < m_renderer->rows && !m_renderer->failed; row++ )
+        {
+            m_renderer->pending = m_renderer->columns;
+            for ( GLuint column = 0; column < m_renderer->columns; column++ )
+            {
+                jobs[column].renderer = m_renderer;
+                jobs[column].tile = MakeTile( m_renderer, column, row );
+                if ( !createInfo.farm->Submit( &jobs[column] ) )
+                {
+                    std::lock_guard<std::mutex> lock( m_renderer->lock );
+                    m_renderer->pending--;
+                    m_renderer->failed = true;
+                }
+            }
+
+            std::unique_lock<std::mutex> lock( m_renderer->lock );
+            m_renderer->done.wait( lock, [this]( void ) { return m_renderer->pending == 0; } );
+            lock.unlock();
+
+            WriteBand( m_renderer, &jobs[m_renderer->columns - 1].tile );
+        }
+    }
+    else
+    {
+        const GLuint frameBuffer = m_renderer->frameBuffer.Handler();
+        GLuint previous = context->BindFrameBuffer( frameBuffer );
+        viewport_t viewport = context->CurrentState().viewports[0];
+
+        for ( GLuint row = 0; row < m_renderer->rows && !m_renderer->failed; row++ )
+        {
+            for ( GLuint column = 0; column < m_renderer->columns; column++ )
+            {
+                const tile_t tile = MakeTile( m_renderer, column, row );
+                context->BindFrameBuffer( frameBuffer );
+                context->SetViewportState( 0, TileViewport( &tile ) );
+                in_scene->Render( context, &tile );
+                m_renderer->reader.Capture( frameBuffer );
+            }
+        }
+
+        // the last bands are still in flight
+        m_renderer->reader.Flush();
+        context->SetViewportState( 0, viewport );
+        context->BindFrameBuffer( previous );
+    }
+
+    if ( m_renderer->file != nullptr )
+    {
+        if ( std::fclose( m_renderer->file ) != 0 )
+            m_renderer->failed = true;
+
+        m_renderer->file = nullptr;
+    }
+
+    m_renderer->scene = nullptr;
+    return !m_renderer->failed;
+}
+
+GLuint gl::TiledRenderer::Columns( void ) const
+{
+    return ( m_renderer != nullptr ) ? m_renderer->columns : 0;
+}
+
+GLuint gl::TiledRenderer::Rows( void ) const
+{
+    return ( m_renderer != nullptr ) ? m_renderer->rows : 0;
+}
+
+gl::tile_t gl::TiledRenderer::Tile( const GLuint in_column, const GLuint in_row ) const
+{
+    if ( m_renderer == nullptr || in_column >= m_renderer->columns || in_row >= m_renderer->rows )
+        return tile_t();
+
+    return MakeTile( m_renderer, in_column, in_row );
+}
+
+gl::tiledRendererStats_t gl::TiledRenderer::Stats( void ) const
+{
+    return ( m_renderer != nullptr ) ? m_renderer->stats : tiledRendererStats_t();
+}
+
+void gl::TiledRenderer::TileProjection( const tile_t* in_tile, const GLfloat* in_projection, GLfloat* in_result )
+{
+    GLfloat result[16];
+    for ( GLuint column = 0; column < 4; column++ )
+    {
+        for ( GLuint row = 0; row < 4; row++ )
+        {
+            GLfloat sum = 0.0f;
+            for ( GLuint k = 0; k < 4; k++ )
+                sum += in_tile->offset[k * 4 + row] * in_projection[column * 4 + k];
+
+            result[column * 4 + row] = sum;
+        }
+    }
+
+    std::memcpy( in_result, result, sizeof( result ) );
+}
@@ -0,0 +1,325 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#include "crglPrecompiled.hpp"
+#include "crglVideoTexture.hpp"
+
+static const char k_VIDEO_SHADER[] = R"(
+#if defined( CRGL_YUV_BT601 )
+const float k_CRGL_KR = 0.299;
+const float k_CRGL_KB = 0.114;
+#else
+const float k_CRGL_KR = 0.2126;
+const float k_CRGL_KB = 0.0722;
+#endif
+
+// in_maxValue is 255 for 8 bit or 1023 for 10 bit codes
+vec3 crglYuvToRgb( vec3 in_yuv, float in_maxValue )
+{
+    float scale = ( in_maxValue + 1.0 ) / 256.0;
+    vec3 code = in_yuv * in_maxValue;
+#if defined( CRGL_YUV_FULL_RANGE )
+    float luma = code.x / in_maxValue;
+    vec2 chroma = ( code.yz - 128.0 * scale ) / in_maxValue;
+#else
+    float luma = ( code.x - 16.0 * scale ) / ( 219.0 * scale );
+    vec2 chroma = ( code.yz - 128.0 * scale ) / ( 224.0 * scale );
+#endif
+    float r = luma + 2.0 * ( 1.0 - k_CRGL_KR ) * chroma.y;
+    float b = luma + 2.0 * ( 1.0 - k_CRGL_KB ) * chroma.x;
+    float g = ( luma - k_CRGL_KR * r - k_CRGL_KB * b ) / ( 1.0 - k_CRGL_KR - k_CRGL_KB );
+    return clamp( vec3( r, g, b ), 0.0, 1.0 );
+}
+
+vec3 crglSampleNV12( sampler2D in_y, sampler2D in_uv, vec2 in_coord )
+{
+    return crglYuvToRgb( vec3( texture( in_y, in_coord ).r, texture( in_uv, in_coord ).rg ), 255.0 );
+}
+
+vec3 crglSampleI420( sampler2D in_y, sampler2D in_u, sampler2D in_v, vec2 in_coord )
+{
+    return crglYuvToRgb( vec3( texture( in_y, in_coord ).r, texture( in_u, in_coord ).r, texture( in_v, in_coord ).r ), 255.0 );
+}
+
+vec3 crglSampleP010( sampler2D in_y, sampler2D in_uv, vec2 in_coord )
+{
+    // the 10 bits are in the high bits of the 16 bit word
+    vec3 yuv = vec3( texture( in_y, in_coord ).r, texture( in_uv, in_coord ).rg ) * ( 65535.0 / 65472.0 );
+    return crglYuvToRgb( yuv, 1023.0 );
+}
+)";
+
+// ring offsets and plane rows are aligned to it
+static constexpr GLsizei k_VIDEO_ROW_ALIGNMENT = 256;
+static constexpr GLuint k_VIDEO_MAX_RING_FRAMES = 8;
+
+typedef struct videoPlaneInfo_t
+{
+    GLenum      format = GL_NONE;
+    GLuint      width = 0;
+    GLuint      height = 0;
+    GLsizei     bytesPerPixel = 0;
+    GLsizei     stride = 0;         // ring row stride
+    GLsizeiptr  offset = 0;         // offset in the ring slot
+} videoPlaneInfo_t;
+
+typedef struct glCoreVideoTexture_t
+{
+    gl::VideoTexture::createInfo_t  createInfo;
+    GLuint                          numPlanes = 0;
+    videoPlaneInfo_t                planes[gl::k_VIDEO_MAX_PLANES];
+    gl::Texture                     textures[gl::k_VIDEO_MAX_PLANES];
+    gl::Buffer                      ring;
+    uint8_t*                        mapped = nullptr;
+    GLsizeiptr                      slotSize = 0;
+    GLsync                          fences[k_VIDEO_MAX_RING_FRAMES] = {};
+    GLuint                          next = 0;
+    uint64_t                        stalls = 0;
+} glCoreVideoTexture_t;
+
+static GLsizei AlignRow( const GLsizei in_value )
+{
+    return ( in_value + k_VIDEO_ROW_ALIGNMENT - 1 ) & ~( k_VIDEO_ROW_ALIGNMENT - 1 );
+}
+
+gl::VideoTexture::VideoTexture( void ) : m_video( nullptr )
+{
+}
+
+gl::VideoTexture::~VideoTexture( void )
+{
+    Destroy();
+}
+
+bool gl::VideoTexture::Create( const createInfo_t* in_createInfo )
+{
+    if ( in_createInfo == nullptr || in_createInfo->width == 0 || in_createInfo->height == 0 )
+        return false;
+
+    Destroy();
+
+    m_video = new glCoreVideoTexture_t();
+    m_video->createInfo = *in_createInfo;
+    m_video->createInfo.ringFrames = std::min<GLuint>( std::max<GLuint>( in_createInfo->ringFrames, 1 ), k_VIDEO_MAX_RING_FRAMES );
+
+    const GLuint width = in_createInfo->width;
+    const GLuint height = in_createInfo->height;
+    const GLuint chromaWidth = ( width + 1 ) / 2;
+    const GLuint chromaHeight = ( height + 1 ) / 2;
+    switch ( in_createInfo->format )
+    {
+    case VIDEO_NV12:
+        m_video->numPlanes = 2;
+        m_video->planes[0] = { GL_R8, width, height, 1 };
+        m_video->planes[1] = { GL_RG8, chromaWidth, chromaHeight, 2 };
+        break;
+    case VIDEO_I420:
+        m_video->numPlanes = 3;
+        m_video->planes[0] = { GL_R8, width, height, 1 };
+        m_video->planes[1] = { GL_R8, chromaWidth, chromaHeight, 1 };
+        m_video->planes[2] = { GL_R8, chromaWidth, chromaHeight, 1 };
+        break;
+    case VIDEO_P010:
+        m_video->numPlanes = 2;
+        m_video->planes[0] = { GL_R16, width, height, 2 };
+        m_video->planes[1] = { GL_RG16, chromaWidth, chromaHeight, 4 };
+        break;
+    default:
+        Destroy();
+        return false;
+    }
+
+    // the luma stride hint scale to the chroma planes
+    const GLsizei lumaRow = static_cast<GLsizei>( width ) * m_video->planes[0].bytesPerPixel;
+    const GLsizei hint = std::max( in_createInfo->strideHint, lumaRow );
+    for ( GLuint i = 0; i < m_video->numPlanes; i++ )
+    {
+        videoPlaneInfo_t& plane = m_video->planes[i];
+        GLsizei row = static_cast<GLsizei>( plane.width ) * plane.bytesPerPixel;
+        GLsizei planeHint = static_cast<GLsizei>( ( static_cast<int64_t>( hint ) * row ) / lumaRow );
+        plane.stride = AlignRow( std::max( row, planeHint ) );
+        plane.offset = m_video->slotSize;
+        m_video->slotSize += static_cast<GLsizeiptr>( plane.stride ) * plane.height;
+
+        Texture::createInfo_t textureInfo;
+        textureInfo.target = texture::TEXTURE_2D;
+        textureInfo.format = Format( plane.format );
+        textureInfo.dimensions.width = static_cast<GLsizei>( plane.width );
+        textureInfo.dimensions.height = static_cast<GLsizei>( plane.height );
+        if ( !m_video->textures[i].Create( &textureInfo ) )
+        {
+            Destroy();
+            return false;
+        }
+
+        const GLint linear = GL_LINEAR;
+        const GLint clamp = GL_CLAMP_TO_EDGE;
+        m_video->textures[i].Parameteriv( GL_TEXTURE_MIN_FILTER, &linear );
+        m_video->textures[i].Parameteriv( GL_TEXTURE_MAG_FILTER, &linear );
+        m_video->textures[i].Parameteriv( GL_TEXTURE_WRAP_S, &clamp );
+        m_video->textures[i].Parameteriv( GL_TEXTURE_WRAP_T, &clamp );
+    }
+
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    const GLsizeiptr ringSize = m_video->slotSize * m_video->createInfo.ringFrames;
+    m_video->ring.Create( GL_PIXEL_UNPACK_BUFFER, ringSize, nullptr, flags );
+    m_video->mapped = static_cast<uint8_t*>( m_video->ring.Map( 0, ringSize, flags ) );
+    if ( m_video->mapped == nullptr )
+    {
+        Destroy();
+        return false;
+    }
+
+    return true;
+}
+
+void gl::VideoTexture::Destroy( void )
+{
+    if ( m_video == nullptr )
+        return;
+
+    for ( GLuint i = 0; i < m_video->createInfo.ringFrames; i++ )
+    {
+        if ( m_video->fences[i] != nullptr )
+            glDeleteSync( m_video->fences[i] );
+    }
+
+    if ( m_video->mapped != nullptr )
+        m_video->ring.Unmap();
+
+    m_video->ring.Destroy();
+    for ( GLuint i = 0; i < k_VIDEO_MAX_PLANES; i++ )
+        m_video->textures[i].Destroy();
+
+    delete m_video;
+    m_video = nullptr;
+}
+
+bool gl::VideoTexture::Upload( const videoPlane_t* in_planes, const GLuint in_count )
+{
+    GLint alignment = 4;
+    GLint rowLength = 0;
+
+    if ( m_video == nullptr || in_planes == nullptr || in_count < m_video->numPlanes )
+        return false;
+
+    // check every plane before touching the ring, a frame is uploaded whole or not at all
+    for ( GLuint i = 0; i < m_video->numPlanes; i++ )
+    {
+        const GLsizei row = static_cast<GLsizei>( m_video->planes[i].width ) * m_video->planes[i].bytesPerPixel;
+        if ( in_planes[i].data == nullptr || ( in_planes[i].stride > 0 && in_planes[i].stride < row ) )
+            return false;
+    }
+
+    // wait the GPU to be done whit the slot
+    const GLuint slot = m_video->next;
+    GLsync& fence = m_video->fences[slot];
+    if ( fence != nullptr )
+    {
+        if ( glClientWaitSync( fence, 0, 0 ) == GL_TIMEOUT_EXPIRED )
+        {
+            m_video->stalls++;
+            glClientWaitSync( fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED );
+        }
+
+        glDeleteSync( fence );
+        fence = nullptr;
+    }
+
+    glGetIntegerv( GL_UNPACK_ALIGNMENT, &alignment );
+    glGetIntegerv( GL_UNPACK_ROW_LENGTH, &rowLength );
+    glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+    glBindBuffer( GL_PIXEL_UNPACK_BUFFER, m_video->ring.GetHandle() );
+
+    uint8_t* base = m_video->mapped + m_video->slotSize * slot;
+    for ( GLuint i = 0; i < m_video->numPlanes; i++ )
+    {
+        const videoPlaneInfo_t& plane = m_video->planes[i];
+        const GLsizei row = static_cast<GLsizei>( plane.width ) * plane.bytesPerPixel;
+        const GLsizei stride = ( in_planes[i].stride > 0 ) ? in_planes[i].stride : row;
+        const uint8_t* source = static_cast<const uint8_t*>( in_planes[i].data );
+        uint8_t* destine = base + plane.offset;
+        GLsizei uploadStride = plane.stride;
+
+        if ( stride <= plane.stride && ( stride % plane.bytesPerPixel ) == 0 )
+        {
+            // decoder layout kept, the row length skip the padding
+            std::memcpy( destine, source, static_cast<size_t>( stride ) * ( plane.height - 1 ) + row );
+            uploadStride = stride;
+        }
+        else
+        {
+            for ( GLuint y = 0; y < plane.height; y++ )
+                std::memcpy( destine + static_cast<size_t>( y ) * plane.stride, source + static_cast<size_t>( y ) * stride, row );
+        }
+
+        Texture::subImage_t subImage;
+        subImage.dimension.width = static_cast<GLsizei>( plane.width );
+        subImage.dimension.height = static_cast<GLsizei>( plane.height );
+        glPixelStorei( GL_UNPACK_ROW_LENGTH, uploadStride / plane.bytesPerPixel );
+        m_video->textures[i].SubImage( &subImage, reinterpret_cast<const void*>( m_video->slotSize * slot + plane.offset ) );
+    }
+
+    glBindBuffer( GL_PIXEL_UNPACK_BUFFER, 0 );
+    glPixelStorei( GL_UNPACK_ROW_LENGTH, rowLength );
+    glPixelStorei( GL_UNPACK_ALIGNMENT, alignment );
+
+    fence = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+    m_video->next = ( slot + 1 ) % m_video->createInfo.ringFrames;
+    return true;
+}
+
+void gl::VideoTexture::Bind( const GLuint in_firstUnit ) const
+{
+    Context* context = Context::Current();
+    if ( m_video == nullptr || context == nullptr )
+        return;
+
+    GLuint textures[k_VIDEO_MAX_PLANES];
+    GLuint samplers[k_VIDEO_MAX_PLANES] = {};
+    for ( GLuint i = 0; i < m_video->numPlanes; i++ )
+        textures[i] = m_video->textures[i].Handle();
+
+    context->BindTextures( textures, samplers, in_firstUnit, m_video->numPlanes );
+}
+
+GLuint gl::VideoTexture::NumPlanes( void ) const
+{
+    return ( m_video != nullptr ) ? m_video->numPlanes : 0;
+}
+
+const gl::Texture* gl::VideoTexture::Plane( const GLuint in_plane ) const
+{
+    if ( m_video == nullptr || in_plane >= m_video->numPlanes )
+        return nullptr;
+
+    return &m_video->textures[in_plane];
+}
+
+uint64_t gl::VideoTexture::Stalls( void ) const
+{
+    return ( m_video != nullptr ) ? m_video->stalls : 0;
+}
+
+const char* gl::VideoTexture::ShaderSource( void )
+{
+    return k_VIDEO_SHADER;
+}
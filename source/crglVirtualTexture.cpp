@@ -0,0 +1,532 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#include "crglPrecompiled.hpp"
+#include "crglTextureUploader.hpp"
+#include "crglVirtualTexture.hpp"
+
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+static const char k_VIRTUAL_SHADER[] = R"(
+vec4 crglVirtualSample( sampler2D in_atlas, usampler2DArray in_pageTable, vec2 in_coord, float in_level, vec2 in_virtualSize, float in_tileSize )
+{
+    int level = int( max( in_level, 0.0 ) );
+    vec2 levelSize = max( floor( in_virtualSize / exp2( float( level ) ) ), vec2( 1.0 ) );
+    ivec2 tile = ivec2( clamp( in_coord, vec2( 0.0 ), vec2( 0.99999 ) ) * levelSize / in_tileSize );
+
+    // the entry point to the tile, or to the closest coarser one resident
+    uvec4 entry = texelFetch( in_pageTable, ivec3( tile, level ), 0 );
+    if ( entry.w == 0u )
+        return vec4( 0.0 );
+
+    vec2 residentSize = max( floor( in_virtualSize / exp2( float( entry.z ) ) ), vec2( 1.0 ) );
+    vec2 texel = clamp( in_coord, vec2( 0.0 ), vec2( 1.0 ) ) * residentSize;
+    vec2 local = clamp( texel - floor( texel / in_tileSize ) * in_tileSize, vec2( 0.5 ), vec2( in_tileSize - 0.5 ) );
+    vec2 atlasSize = vec2( textureSize( in_atlas, 0 ) );
+    return textureLod( in_atlas, ( vec2( entry.xy ) * in_tileSize + local ) / atlasSize, 0.0 );
+}
+)";
+
+typedef struct virtualTile_t
+{
+    uint64_t    key = 0;
+    GLint       level = 0;
+    GLuint      x = 0;
+    GLuint      y = 0;
+    GLuint      slot = 0;           // atlas slot, software path
+    uint64_t    lastUsed = 0;       // frame
+    bool        pinned = false;     // sparse mip tail
+} virtualTile_t;
+
+typedef std::list<virtualTile_t>    tileList_t;
+
+typedef struct glCoreVirtualTexture_t
+{
+    gl::VirtualTexture::createInfo_t                createInfo;
+    gl::TileSource*                                 source = nullptr;
+    bool                                            sparse = false;
+    GLuint                                          tileWidth = 0;
+    GLuint                                          tileHeight = 0;
+    GLint                                           sparseLevels = 0;   // levels >= are the mip tail
+
+    gl::Texture                                     physical;
+    gl::Texture                                     pageTable;
+    GLuint                                          atlasColumns = 0;
+    std::vector<GLuint>                             freeSlots;
+    std::vector<uint16_t>                           entries;            // page table, 4 per tile
+    bool                                            pageTableDirty = false;
+
+    gl::TextureUploader                             uploader;
+    tileList_t                                      lru;                // most recent first
+    std::unordered_map<uint64_t, tileList_t::iterator> resident;
+    std::unordered_set<uint64_t>                    requested;
+    uint64_t                                        frame = 1;
+    gl::virtualTextureStats_t                       stats;
+} glCoreVirtualTexture_t;
+
+static uint64_t TileKey( const GLint in_level, const GLuint in_x, const GLuint in_y )
+{
+    return ( static_cast<uint64_t>( in_level ) << 48 ) | ( static_cast<uint64_t>( in_y ) << 24 ) | static_cast<uint64_t>( in_x );
+}
+
+static GLuint LevelSize( const GLuint in_size, const GLint in_level )
+{
+    return std::max<GLuint>( in_size >> in_level, 1 );
+}
+
+static GLuint TileCount( const GLuint in_size, const GLint in_level, const GLuint in_tile )
+{
+    return ( LevelSize( in_size, in_level ) + in_tile - 1 ) / in_tile;
+}
+
+// the tile texels, clipped to the level size
+static void TileRegion( const glCoreVirtualTexture_t* in_virtual, const GLint in_level, const GLuint in_x, const GLuint in_y, gl::Texture::offsets_t* in_offsets, gl::Texture::dimensions_t* in_dimensions )
+{
+    const GLuint width = LevelSize( in_virtual->createInfo.width, in_level );
+    const GLuint height = LevelSize( in_virtual->createInfo.height, in_level );
+
+    in_offsets->xoffset = static_cast<GLint>( in_x * in_virtual->tileWidth );
+    in_offsets->yoffset = static_cast<GLint>( in_y * in_virtual->tileHeight );
+    in_dimensions->width = static_cast<GLsizei>( std::min( in_virtual->tileWidth, width - in_x * in_virtual->tileWidth ) );
+    in_dimensions->height = static_cast<GLsizei>( std::min( in_virtual->tileHeight, height - in_y * in_virtual->tileHeight ) );
+    in_dimensions->depth = 1;
+}
+
+static void RebuildPageTable( glCoreVirtualTexture_t* in_virtual )
+{
+    const GLuint columns = TileCount( in_virtual->createInfo.width, 0, in_virtual->tileWidth );
+    const GLuint rows = TileCount( in_virtual->createInfo.height, 0, in_virtual->tileHeight );
+    const size_t layerSize = static_cast<size_t>( columns ) * rows * 4;
+
+    std::fill( in_virtual->entries.begin(), in_virtual->entries.end(), 0 );
+
+    // coarse to fine, the missing tiles inherit the parent entry
+    for ( GLint level = in_virtual->createInfo.levels - 1; level >= 0; level-- )
+    {
+        const GLuint tilesX = TileCount( in_virtual->createInfo.width, level, in_virtual->tileWidth );
+        const GLuint tilesY = TileCount( in_virtual->createInfo.height, level, in_virtual->tileHeight );
+        uint16_t* layer = &in_virtual->entries[layerSize * level];
+        for ( GLuint y = 0; y < tilesY; y++ )
+        {
+            for ( GLuint x = 0; x < tilesX; x++ )
+            {
+                uint16_t* entry = &layer[( y * columns + x ) * 4];
+                auto tile = in_virtual->resident.find( TileKey( level, x, y ) );
+                if ( tile != in_virtual->resident.end() )
+                {
+                    const GLuint slot = tile->second->slot;
+                    entry[0] = static_cast<uint16_t>( slot % in_virtual->atlasColumns );
+                    entry[1] = static_cast<uint16_t>( slot / in_virtual->atlasColumns );
+                    entry[2] = static_cast<uint16_t>( level );
+                    entry[3] = 1;
+                }
+                else if ( level + 1 < in_virtual->createInfo.levels )
+                {
+                    const uint16_t* parent = &in_virtual->entries[layerSize * ( level + 1 ) + ( ( y / 2 ) * columns + x / 2 ) * 4];
+                    std::memcpy( entry, parent, sizeof( uint16_t ) * 4 );
+                }
+            }
+        }
+    }
+
+    gl::Texture::subImage_t subImage;
+    subImage.dimension.width = static_cast<GLsizei>( columns );
+    subImage.dimension.height = static_cast<GLsizei>( rows );
+    for ( GLint level = 0; level < in_virtual->createInfo.levels; level++ )
+    {
+        subImage.layer = level;
+        in_virtual->pageTable.SubImage( &subImage, &in_virtual->entries[layerSize * level] );
+    }
+}
+
+static bool Evict( glCoreVirtualTexture_t* in_virtual )
+{
+    // the oldest tile not used this frame
+    for ( auto tile = in_virtual->lru.rbegin(); tile != in_virtual->lru.rend(); ++tile )
+    {
+        if ( tile->pinned || tile->lastUsed >= in_virtual->frame )
+            continue;
+
+        if ( in_virtual->sparse )
+        {
+            gl::Texture::offsets_t offsets;
+            gl::Texture::dimensions_t dimensions;
+            TileRegion( in_virtual, tile->level, tile->x, tile->y, &offsets, &dimensions );
+            in_virtual->physical.Commit( tile->level, offsets, dimensions, false );
+        }
+        else
+        {
+            in_virtual->freeSlots.push_back( tile->slot );
+            in_virtual->pageTableDirty = true;
+        }
+
+        in_virtual->resident.erase( tile->key );
+        in_virtual->lru.erase( std::next( tile ).base() );
+        in_virtual->stats.evictions++;
+        return true;
+    }
+
+    return false;
+}
+
+typedef enum tileLoad_t
+{
+    TILE_LOADED = 0,
+    TILE_NO_SPACE,          // cache or staging ring full, nothing more can be loaded this frame
+    TILE_SOURCE_FAILED      // the source had no texels for this tile, the others can still load
+} tileLoad_t;
+
+static tileLoad_t LoadTile( glCoreVirtualTexture_t* in_virtual, const GLint in_level, const GLuint in_x, const GLuint in_y, const bool in_pinned )
+{
+    gl::Texture::offsets_t offsets;
+    gl::Texture::dimensions_t dimensions;
+    gl::uploadRegion_t region;
+    virtualTile_t tile;
+
+    TileRegion( in_virtual, in_level, in_x, in_y, &offsets, &dimensions );
+    const GLsizeiptr size = static_cast<GLsizeiptr>( in_virtual->createInfo.format.ImageSize( dimensions.width, dimensions.height, 1 ) );
+    if ( !in_virtual->uploader.Allocate( size, &region ) )
+    {
+        // staging full, recycle and retry once
+        in_virtual->uploader.Flush();
+        if ( !in_virtual->uploader.Allocate( size, &region ) )
+            return TILE_NO_SPACE;
+    }
+
+    // read the source before evicting, a failed tile must not cost a resident one
+    if ( !in_virtual->source->LoadTile( in_level, in_x, in_y, static_cast<GLuint>( dimensions.width ), static_cast<GLuint>( dimensions.height ), region.data, size ) )
+    {
+        in_virtual->uploader.Discard( &region );
+        return TILE_SOURCE_FAILED;
+    }
+
+    if ( !in_pinned && in_virtual->resident.size() >= in_virtual->createInfo.cacheTiles && !Evict( in_virtual ) )
+    {
+        in_virtual->uploader.Discard( &region );
+        return TILE_NO_SPACE;
+    }
+
+    tile.key = TileKey( in_level, in_x, in_y );
+    tile.level = in_level;
+    tile.x = in_x;
+    tile.y = in_y;
+    tile.lastUsed = in_virtual->frame;
+    tile.pinned = in_pinned;
+
+    gl::Texture::subImage_t subImage;
+    subImage.dimension = dimensions;
+    if ( in_virtual->sparse )
+    {
+        in_virtual->physical.Commit( in_level, offsets, dimensions, true );
+        subImage.level = in_level;
+        subImage.offsets = offsets;
+    }
+    else
+    {
+        tile.slot = in_virtual->freeSlots.back();
+        in_virtual->freeSlots.pop_back();
+        subImage.offsets.xoffset = static_cast<GLint>( ( tile.slot % in_virtual->atlasColumns ) * in_virtual->tileWidth );
+        subImage.offsets.yoffset = static_cast<GLint>( ( tile.slot / in_virtual->atlasColumns ) * in_virtual->tileHeight );
+        in_virtual->pageTableDirty = true;
+    }
+
+    in_virtual->uploader.Upload( &region, &in_virtual->physical, &subImage );
+    in_virtual->lru.push_front( tile );
+    in_virtual->resident[tile.key] = in_virtual->lru.begin();
+    in_virtual->stats.loads++;
+    return TILE_LOADED;
+}
+
+gl::VirtualTexture::VirtualTexture( void ) : m_virtual( nullptr )
+{
+}
+
+gl::VirtualTexture::~VirtualTexture( void )
+{
+    Destroy();
+}
+
+bool gl::VirtualTexture::Create( const createInfo_t* in_createInfo, TileSource* in_source )
+{
+    Texture::createInfo_t textureInfo;
+    Texture::dimensions_t pageSize;
+
+    if ( in_createInfo == nullptr || in_source == nullptr || in_createInfo->width == 0 || in_createInfo->height == 0 || in_createInfo->tileSize == 0 )
+        return false;
+
+    Destroy();
+
+    m_virtual = new glCoreVirtualTexture_t();
+    m_virtual->createInfo = *in_createInfo;
+    m_virtual->createInfo.levels = std::max<GLsizei>( in_createInfo->levels, 1 );
+    m_virtual->createInfo.cacheTiles = std::max<GLuint>( in_createInfo->cacheTiles, 1 );
+    m_virtual->source = in_source;
+
+    const Context* context = Context::Current();
+    m_virtual->sparse = in_createInfo->allowSparse && context != nullptr && context->HasExtension( EXTENSION_ARB_sparse_texture ) &&
+                        context->IsFunctionLoaded( FUNCTION_TexturePageCommitmentEXT ) &&
+                        Texture::PageSize( GL_TEXTURE_2D, in_createInfo->format.internalFormat, &pageSize );
+
+    textureInfo.target = texture::TEXTURE_2D;
+    textureInfo.format = in_createInfo->format;
+    if ( m_virtual->sparse )
+    {
+        m_virtual->tileWidth = static_cast<GLuint>( pageSize.width );
+        m_virtual->tileHeight = static_cast<GLuint>( pageSize.height );
+
+        textureInfo.sparse = true;
+        textureInfo.levels = m_virtual->createInfo.levels;
+        textureInfo.dimensions.width = static_cast<GLsizei>( in_createInfo->width );
+        textureInfo.dimensions.height = static_cast<GLsizei>( in_createInfo->height );
+        if ( !m_virtual->physical.Create( &textureInfo ) )
+        {
+            Destroy();
+            return false;
+        }
+        
+        m_virtual->sparseLevels = std::min<GLint>( m_virtual->physical.SparseLevels(), m_virtual->createInfo.levels );
+    }
+    else
+    {
+        m_virtual->tileWidth = in_createInfo->tileSize;
+        m_virtual->tileHeight = in_createInfo->tileSize;
+
+        // the atlas hold the cache tiles in a square as possible
+        GLuint columns = 1;
+        while ( columns * columns < m_virtual->createInfo.cacheTiles )
+            columns++;
+
+        const GLuint rows = ( m_virtual->createInfo.cacheTiles + columns - 1 ) / columns;
+        m_virtual->atlasColumns = columns;
+        textureInfo.dimensions.width = static_cast<GLsizei>( columns * in_createInfo->tileSize );
+        textureInfo.dimensions.height = static_cast<GLsizei>( rows * in_createInfo->tileSize );
+        if ( !m_virtual->physical.Create( &textureInfo ) )
+        {
+            Destroy();
+            return false;
+        }
+
+        const GLuint tilesX = TileCount( in_createInfo->width, 0, m_virtual->tileWidth );
+        const GLuint tilesY = TileCount( in_createInfo->height, 0, m_virtual->tileHeight );
+        Texture::createInfo_t tableInfo;
+        tableInfo.target = texture::TEXTURE_2D_ARRAY;
+        tableInfo.format = Format( GL_RGBA16UI );
+        tableInfo.layers = m_virtual->createInfo.levels;
+        tableInfo.dimensions.width = static_cast<GLsizei>( tilesX );
+        tableInfo.dimensions.height = static_cast<GLsizei>( tilesY );
+        if ( !m_virtual->pageTable.Create( &tableInfo ) )
+        {
+            Destroy();
+            return false;
+        }
+
+        const GLint nearest = GL_NEAREST;
+        m_virtual->pageTable.Parameteriv( GL_TEXTURE_MIN_FILTER, &nearest );
+        m_virtual->pageTable.Parameteriv( GL_TEXTURE_MAG_FILTER, &nearest );
+        m_virtual->entries.resize( static_cast<size_t>( tilesX ) * tilesY * 4 * m_virtual->createInfo.levels, 0 );
+
+        for ( GLuint i = m_virtual->createInfo.cacheTiles; i > 0; i-- )
+            m_virtual->freeSlots.push_back( i - 1 );
+
+        m_virtual->pageTableDirty = true;
+    }
+
+    // staging for a update worth of tiles
+    TextureUploader::createInfo_t uploaderInfo;
+    uploaderInfo.size = static_cast<GLsizeiptr>( in_createInfo->format.ImageSize( m_virtual->tileWidth, m_virtual->tileHeight, 1 ) ) * 
+                        static_cast<GLsizeiptr>( std::max<GLuint>( in_createInfo->tilesPerUpdate, 1 ) + 1 ) * 2;
+    if ( !m_virtual->uploader.Create( &uploaderInfo ) )
+    {
+        Destroy();
+        return false;
+    }
+
+    // the sparse mip tail is commited as a whole, kept resident
+    if ( m_virtual->sparse )
+    {
+        for ( GLint level = m_virtual->sparseLevels; level < m_virtual->createInfo.levels; level++ )
+        {
+            for ( GLuint y = 0; y < TilesY( level ); y++ )
+            {
+                for ( GLuint x = 0; x < TilesX( level ); x++ )
+                    LoadTile( m_virtual, level, x, y, true );
+            }
+        }
+
+        m_virtual->uploader.Flush();
+    }
+
+    m_virtual->stats.capacity = m_virtual->createInfo.cacheTiles;
+    return true;
+}
+
+void gl::VirtualTexture::Destroy( void )
+{
+    if ( m_virtual == nullptr )
+        return;
+
+    m_virtual->uploader.Destroy();
+    m_virtual->pageTable.Destroy();
+    m_virtual->physical.Destroy();
+    delete m_virtual;
+    m_virtual = nullptr;
+}
+
+void gl::VirtualTexture::Request( const GLint in_level, const GLuint in_x, const GLuint in_y )
+{
+    if ( m_virtual == nullptr || in_level < 0 || in_level >= m_virtual->createInfo.levels || in_x >= TilesX( in_level ) || in_y >= TilesY( in_level ) )
+        return;
+
+    const uint64_t key = TileKey( in_level, in_x, in_y );
+    m_virtual->stats.requests++;
+
+    auto tile = m_virtual->resident.find( key );
+    if ( tile != m_virtual->resident.end() )
+    {
+        // most recent first
+        tile->second->lastUsed = m_virtual->frame;
+        m_virtual->lru.splice( m_virtual->lru.begin(), m_virtual->lru, tile->second );
+        return;
+    }
+
+    m_virtual->stats.misses++;
+    m_virtual->requested.insert( key );
+}
+
+void gl::VirtualTexture::RequestRegion( const GLint in_level, const GLfloat in_u0, const GLfloat in_v0, const GLfloat in_u1, const GLfloat in_v1 )
+{
+    if ( m_virtual == nullptr || in_level < 0 || in_level >= m_virtual->createInfo.levels )
+        return;
+
+    const GLfloat width = static_cast<GLfloat>( LevelSize( m_virtual->createInfo.width, in_level ) );
+    const GLfloat height = static_cast<GLfloat>( LevelSize( m_virtual->createInfo.height, in_level ) );
+    const GLuint x0 = static_cast<GLuint>( std::max( std::min( in_u0, in_u1 ), 0.0f ) * width ) / m_virtual->tileWidth;
+    const GLuint y0 = static_cast<GLuint>( std::max( std::min( in_v0, in_v1 ), 0.0f ) * height ) / m_virtual->tileHeight;
+    const GLuint x1 = std::min( static_cast<GLuint>( std::min( std::max( in_u0, in_u1 ), 1.0f ) * width ) / m_virtual->tileWidth, TilesX( in_level ) - 1 );
+    const GLuint y1 = std::min( static_cast<GLuint>( std::min( std::max( in_v0, in_v1 ), 1.0f ) * height ) / m_virtual->tileHeight, TilesY( in_level ) - 1 );
+
+    for ( GLuint y = y0; y <= y1; y++ )
+    {
+        for ( GLuint x = x0; x <= x1; x++ )
+            Request( in_level, x, y );
+    }
+}
+
+GLuint gl::VirtualTexture::Update( void )
+{
+    std::vector<uint64_t> requested;
+    GLuint loaded = 0;
+
+    if ( m_virtual == nullptr )
+        return 0;
+
+    // coarse levels first, a blurry tile is better than a hole
+    requested.assign( m_virtual->requested.begin(), m_virtual->requested.end() );
+    std::sort( requested.begin(), requested.end(), []( const uint64_t in_a, const uint64_t in_b ) { return in_a > in_b; } );
+
+    for ( uint64_t key : requested )
+    {
+        if ( loaded >= m_virtual->createInfo.tilesPerUpdate )
+            break;
+
+        const GLint level = static_cast<GLint>( key >> 48 );
+        const GLuint y = static_cast<GLuint>( ( key >> 24 ) & 0xFFFFFF );
+        const GLuint x = static_cast<GLuint>( key & 0xFFFFFF );
+        const tileLoad_t result = LoadTile( m_virtual, level, x, y, false );
+        if ( result == TILE_NO_SPACE )
+            break;
+
+        // a tile the source can't provide is skipped, it don't block the next ones
+        m_virtual->requested.erase( key );
+        if ( result == TILE_LOADED )
+            loaded++;
+    }
+
+    m_virtual->uploader.Flush();
+    if ( m_virtual->pageTableDirty )
+    {
+        RebuildPageTable( m_virtual );
+        m_virtual->pageTableDirty = false;
+    }
+
+    // what was not loaded must be requested again
+    m_virtual->requested.clear();
+    m_virtual->frame++;
+    return loaded;
+}
+
+bool gl::VirtualTexture::IsResident( const GLint in_level, const GLuint in_x, const GLuint in_y ) const
+{
+    return m_virtual != nullptr && m_virtual->resident.count( TileKey( in_level, in_x, in_y ) ) > 0;
+}
+
+bool gl::VirtualTexture::IsSparse( void ) const
+{
+    return m_virtual != nullptr && m_virtual->sparse;
+}
+
+GLuint gl::VirtualTexture::TileWidth( void ) const
+{
+    return ( m_virtual != nullptr ) ? m_virtual->tileWidth : 0;
+}
+
+GLuint gl::VirtualTexture::TileHeight( void ) const
+{
+    return ( m_virtual != nullptr ) ? m_virtual->tileHeight : 0;
+}
+
+GLuint gl::VirtualTexture::TilesX( const GLint in_level ) const
+{
+    return ( m_virtual != nullptr ) ? TileCount( m_virtual->createInfo.width, in_level, m_virtual->tileWidth ) : 0;
+}
+
+GLuint gl::VirtualTexture::TilesY( const GLint in_level ) const
+{
+    return ( m_virtual != nullptr ) ? TileCount( m_virtual->createInfo.height, in_level, m_virtual->tileHeight ) : 0;
+}
+
+const gl::Texture* gl::VirtualTexture::Physical( void ) const
+{
+    return ( m_virtual != nullptr ) ? &m_virtual->physical : nullptr;
+}
+
+const gl::Texture* gl::VirtualTexture::PageTable( void ) const
+{
+    return ( m_virtual != nullptr && !m_virtual->sparse ) ? &m_virtual->pageTable : nullptr;
+}
+
+gl::virtualTextureStats_t gl::VirtualTexture::Stats( void ) const
+{
+    if ( m_virtual == nullptr )
+        return virtualTextureStats_t();
+
+    virtualTextureStats_t stats = m_virtual->stats;
+    stats.resident = static_cast<GLuint>( m_virtual->resident.size() );
+    return stats;
+}
+
+const char* gl::VirtualTexture::ShaderSource( void )
+{
+    return k_VIRTUAL_SHADER;
+}
@@ -0,0 +1,392 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+#include "crglPrecompiled.hpp"
+#include "crglYuvConverter.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/// @brief each invocation convert a 8x2 pixels block, so every plane write whole words
+static const char k_YUV_SHADER[] = R"(
+layout( local_size_x = 8, local_size_y = 8 ) in;
+
+layout( binding = 0 ) uniform sampler2D u_source;
+layout( std430, binding = 0 ) writeonly buffer yuvPlanes { uint planes[]; };
+layout( location = 0 ) uniform int u_width;
+layout( location = 1 ) uniform int u_height;
+
+uint Pack( vec4 in_values )
+{
+    uvec4 bytes = uvec4( clamp( floor( in_values + 0.5 ), 0.0, 255.0 ) );
+    return bytes.x | ( bytes.y << 8 ) | ( bytes.z << 16 ) | ( bytes.w << 24 );
+}
+
+float Luma( vec3 in_rgb )
+{
+    return YUV_Y_OFFSET + YUV_Y_SCALE * dot( in_rgb, vec3( YUV_KR, 1.0 - YUV_KR - YUV_KB, YUV_KB ) );
+}
+
+vec3 Fetch( int in_x, int in_y )
+{
+#if YUV_FLIP_Y
+    in_y = u_height - 1 - in_y;
+#endif
+    return texelFetch( u_source, ivec2( in_x, in_y ), 0 ).rgb;
+}
+
+void main( void )
+{
+    ivec2 block = ivec2( gl_GlobalInvocationID.xy );
+    int x = block.x * 8;
+    int y = block.y * 2;
+    if ( x >= u_width || y >= u_height )
+        return;
+
+    float luma[16];
+    vec3 chroma[4];
+    for ( int i = 0; i < 4; i++ )
+        chroma[i] = vec3( 0.0 );
+
+    for ( int row = 0; row < 2; row++ )
+    {
+        for ( int column = 0; column < 8; column++ )
+        {
+            vec3 rgb = Fetch( x + column, y + row );
+            luma[row * 8 + column] = Luma( rgb );
+            chroma[column / 2] += rgb * 0.25;
+        }
+    }
+
+    // luma rows
+    int lumaWord = ( y * u_width + x ) / 4;
+    int rowWords = u_width / 4;
+    planes[lumaWord] = Pack( vec4( luma[0], luma[1], luma[2], luma[3] ) );
+    planes[lumaWord + 1] = Pack( vec4( luma[4], luma[5], luma[6], luma[7] ) );
+    planes[lumaWord + rowWords] = Pack( vec4( luma[8], luma[9], luma[10], luma[11] ) );
+    planes[lumaWord + rowWords + 1] = Pack( vec4( luma[12], luma[13], luma[14], luma[15] ) );
+
+    // chroma from the average of the 2x2 pixels
+    vec4 u, v;
+    for ( int i = 0; i < 4; i++ )
+    {
+        float average = dot( chroma[i], vec3( YUV_KR, 1.0 - YUV_KR - YUV_KB, YUV_KB ) );
+        u[i] = 128.0 + YUV_C_SCALE * ( chroma[i].b - average ) / ( 2.0 * ( 1.0 - YUV_KB ) );
+        v[i] = 128.0 + YUV_C_SCALE * ( chroma[i].r - average ) / ( 2.0 * ( 1.0 - YUV_KR ) );
+    }
+
+    int chromaBase = ( u_width * u_height ) / 4;
+#if YUV_I420
+    int chromaWord = ( ( y / 2 ) * ( u_width / 2 ) + x / 2 ) / 4;
+    planes[chromaBase + chromaWord] = Pack( u );
+    planes[chromaBase + chromaBase / 4 + chromaWord] = Pack( v );
+#else
+    int chromaWord = ( ( y / 2 ) * u_width + x ) / 4;
+    planes[chromaBase + chromaWord] = Pack( vec4( u.x, v.x, u.y, v.y ) );
+    planes[chromaBase + chromaWord + 1] = Pack( vec4( u.z, v.z, u.w, v.w ) );
+#endif
+}
+)";
+
+typedef struct yuvCoefficients_t
+{
+    float   kr = 0.0f;
+    float   kb = 0.0f;
+    float   yOffset = 0.0f;
+    float   yScale = 0.0f;
+    float   cScale = 0.0f;
+} yuvCoefficients_t;
+
+typedef struct glCoreYuvConverter_t
+{
+    gl::YuvConverter::createInfo_t  createInfo;
+    yuvCoefficients_t               coefficients;
+    gl::Program                     program;
+} glCoreYuvConverter_t;
+
+static yuvCoefficients_t Coefficients( const gl::YuvConverter::createInfo_t* in_createInfo )
+{
+    yuvCoefficients_t coefficients;
+    if ( in_createInfo->matrix == gl::YUV_BT601 )
+    {
+        coefficients.kr = 0.299f;
+        coefficients.kb = 0.114f;
+    }
+    else
+    {
+        coefficients.kr = 0.2126f;
+        coefficients.kb = 0.0722f;
+    }
+
+    if ( in_createInfo->fullRange )
+    {
+        coefficients.yOffset = 0.0f;
+        coefficients.yScale = 255.0f;
+        coefficients.cScale = 255.0f;
+    }
+    else
+    {
+        coefficients.yOffset = 16.0f;
+        coefficients.yScale = 219.0f;
+        coefficients.cScale = 224.0f;
+    }
+
+    return coefficients;
+}
+
+static uint8_t ToByte( const float in_value )
+{
+    return static_cast<uint8_t>( std::min( std::max( std::floor( in_value + 0.5f ), 0.0f ), 255.0f ) );
+}
+
+gl::YuvConverter::YuvConverter( void ) : m_converter( nullptr )
+{
+}
+
+gl::YuvConverter::~YuvConverter( void )
+{
+    Destroy();
+}
+
+bool gl::YuvConverter::Create( const createInfo_t* in_createInfo )
+{
+    char defines[512];
+    gl::Shader shader;
+
+    if ( in_createInfo == nullptr )
+        return false;
+
+    Destroy();
+
+    m_converter = new glCoreYuvConverter_t();
+    m_converter->createInfo = *in_createInfo;
+    m_converter->coefficients = Coefficients( in_createInfo );
+
+    const yuvCoefficients_t& coefficients = m_converter->coefficients;
+    std::snprintf( defines, sizeof( defines ), 
+        "#version 450 core\n"
+        "#define YUV_KR %.6f\n"
+        "#define YUV_KB %.6f\n"
+        "#define YUV_Y_OFFSET %.1f\n"
+        "#define YUV_Y_SCALE %.1f\n"
+        "#define YUV_C_SCALE %.1f\n"
+        "#define YUV_I420 %d\n"
+        "#define YUV_FLIP_Y %d\n",
+        coefficients.kr, coefficients.kb, coefficients.yOffset, coefficients.yScale, coefficients.cScale, 
+        in_createInfo->layout == YUV_I420 ? 1 : 0, in_createInfo->flipY ? 1 : 0 );
+
+    const GLchar* sources[] = { defines, k_YUV_SHADER };
+    const Shader* shaders[] = { &shader };
+    if ( !shader.Create( GL_COMPUTE_SHADER, sources, nullptr, 2 ) || !m_converter->program.Create( shaders, 1 ) )
+    {
+        if ( Context* context = Context::Current() )
+            context->DebugOuput( "YuvConverter error: failed to build the conversion program\n" );
+
+        Destroy();
+        return false;
+    }
+
+    return true;
+}
+
+void gl::YuvConverter::Destroy( void )
+{
+    if ( m_converter == nullptr )
+        return;
+
+    m_converter->program.Destroy();
+    delete m_converter;
+    m_converter = nullptr;
+}
+
+GLsizeiptr gl::YuvConverter::OutputSize( const GLuint in_width, const GLuint in_height ) const
+{
+    return static_cast<GLsizeiptr>( in_width ) * static_cast<GLsizeiptr>( in_height ) * 3 / 2;
+}
+
+bool gl::YuvConverter::Convert( const GLuint in_source, const GLuint in_width, const GLuint in_height, const GLuint in_buffer )
+{
+    Context* context = Context::Current();
+    if ( m_converter == nullptr || context == nullptr )
+        return false;
+
+    if ( ( in_width % 8 ) != 0 || ( in_height % 2 ) != 0 )
+    {
+        glDebugMessageInsert( GL_DEBUG_SOURCE_THIRD_PARTY, GL_DEBUG_TYPE_ERROR, 0, GL_DEBUG_SEVERITY_HIGH, -1, "YuvConverter: width must be multiple of 8 and height of 2" );
+        return false;
+    }
+
+    const GLuint program = m_converter->program;
+    GLuint previous = context->BindProgram( program );
+    glProgramUniform1i( program, 0, static_cast<GLint>( in_width ) );
+    glProgramUniform1i( program, 1, static_cast<GLint>( in_height ) );
+
+    // through the context so its binding cache stay valid, the unit 0 is restored after
+    const coreState_t state = context->CurrentState();
+    GLuint previousTexture = state.textures.textures[0];
+    GLuint previousSampler = state.textures.samplers[0];
+    GLuint texture = in_source;
+    GLuint sampler = 0;
+    context->BindTextures( &texture, &sampler, 0, 1 );
+
+    GLuint buffer = in_buffer;
+    GLintptr offset = 0;
+    GLsizeiptr size = OutputSize( in_width, in_height );
+    context->BindShaderStorageBuffers( &buffer, &offset, &size, 0, 1 );
+
+    // 8x8 groups of 8x2 pixels blocks
+    const GLuint blocksX = in_width / 8;
+    const GLuint blocksY = in_height / 2;
+    glDispatchCompute( ( blocksX + 7 ) / 8, ( blocksY + 7 ) / 8, 1 );
+
+    buffer = 0;
+    context->BindShaderStorageBuffers( &buffer, &offset, &size, 0, 1 );
+    context->BindTextures( &previousTexture, &previousSampler, 0, 1 );
+    context->BindProgram( previous );
+    return true;
+}
+
+bool gl::YuvConverter::Verify( const GLuint in_width, const GLuint in_height, const GLuint in_tolerance )
+{
+    Context* context = Context::Current();
+    if ( m_converter == nullptr || context == nullptr )
+        return false;
+
+    // gradients whit a noise, so every rounding path and both chroma planes see varied values
+    std::vector<uint8_t> rgba( static_cast<size_t>( in_width ) * in_height * 4 );
+    uint32_t seed = 0x9E3779B9u;
+    for ( GLuint y = 0; y < in_height; y++ )
+    {
+        for ( GLuint x = 0; x < in_width; x++ )
+        {
+            seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+            uint8_t* pixel = &rgba[( static_cast<size_t>( y ) * in_width + x ) * 4];
+            pixel[0] = static_cast<uint8_t>( ( x * 255 ) / std::max( in_width - 1, 1u ) );
+            pixel[1] = static_cast<uint8_t>( ( y * 255 ) / std::max( in_height - 1, 1u ) );
+            pixel[2] = static_cast<uint8_t>( seed >> 24 );
+            pixel[3] = 255;
+        }
+    }
+
+    Texture source;
+    Texture::createInfo_t textureInfo;
+    textureInfo.target = texture::TEXTURE_2D;
+    textureInfo.format = Format( GL_RGBA8 );
+    textureInfo.dimensions.width = static_cast<GLsizei>( in_width );
+    textureInfo.dimensions.height = static_cast<GLsizei>( in_height );
+    textureInfo.dimensions.depth = 1;
+    if ( !source.Create( &textureInfo ) )
+        return false;
+
+    Texture::subImage_t subImage;
+    subImage.dimension = textureInfo.dimensions;
+    source.SubImage( &subImage, rgba.data() );
+
+    const GLsizeiptr size = OutputSize( in_width, in_height );
+    Buffer planes;
+    planes.Create( GL_SHADER_STORAGE_BUFFER, size, nullptr, 0 );
+    if ( !Convert( source.Handle(), in_width, in_height, planes ) )
+        return false;
+
+    std::vector<uint8_t> gpu( static_cast<size_t>( size ) );
+    std::vector<uint8_t> cpu( static_cast<size_t>( size ) );
+    void* data = gpu.data();
+    glMemoryBarrier( GL_BUFFER_UPDATE_BARRIER_BIT );
+    planes.Download( data, 0, size );
+    Reference( rgba.data(), in_width, in_height, static_cast<GLsizei>( in_width * 4 ), cpu.data() );
+
+    GLuint maxError = 0;
+    size_t errors = 0;
+    for ( size_t i = 0; i < cpu.size(); i++ )
+    {
+        GLuint error = static_cast<GLuint>( std::abs( static_cast<int>( gpu[i] ) - static_cast<int>( cpu[i] ) ) );
+        maxError = std::max( maxError, error );
+        if ( error > in_tolerance )
+            errors++;
+    }
+
+    if ( errors != 0 )
+    {
+        char message[160];
+        std::snprintf( message, sizeof( message ), "YuvConverter::Verify %ux%u: %zu bytes differ from the reference by more than %u, max %u\n", 
+            in_width, in_height, errors, in_tolerance, maxError );
+        context->DebugOuput( message );
+    }
+
+    return errors == 0;
+}
+
+void gl::YuvConverter::Reference( const uint8_t* in_rgba, const GLuint in_width, const GLuint in_height, const GLsizei in_stride, uint8_t* in_output ) const
+{
+    if ( m_converter == nullptr )
+        return;
+
+    const yuvCoefficients_t& c = m_converter->coefficients;
+    const float kg = 1.0f - c.kr - c.kb;
+    const bool i420 = m_converter->createInfo.layout == YUV_I420;
+    const size_t lumaSize = static_cast<size_t>( in_width ) * in_height;
+    uint8_t* chroma = in_output + lumaSize;
+
+    auto Pixel = [&]( const GLuint in_x, const GLuint in_y, float* in_rgb )
+    {
+        GLuint y = m_converter->createInfo.flipY ? in_height - 1 - in_y : in_y;
+        const uint8_t* pixel = in_rgba + static_cast<size_t>( y ) * static_cast<size_t>( in_stride ) + in_x * 4;
+        for ( int i = 0; i < 3; i++ )
+            in_rgb[i] = pixel[i] / 255.0f;
+    };
+
+    for ( GLuint y = 0; y < in_height; y += 2 )
+    {
+        for ( GLuint x = 0; x < in_width; x += 2 )
+        {
+            float average[3] = { 0.0f, 0.0f, 0.0f };
+            for ( GLuint row = 0; row < 2; row++ )
+            {
+                for ( GLuint column = 0; column < 2; column++ )
+                {
+                    float rgb[3];
+                    Pixel( x + column, y + row, rgb );
+                    in_output[( y + row ) * in_width + x + column] = ToByte( c.yOffset + c.yScale * ( c.kr * rgb[0] + kg * rgb[1] + c.kb * rgb[2] ) );
+                    for ( int i = 0; i < 3; i++ )
+                        average[i] += rgb[i] * 0.25f;
+                }
+            }
+
+            float luma = c.kr * average[0] + kg * average[1] + c.kb * average[2];
+            uint8_t u = ToByte( 128.0f + c.cScale * ( average[2] - luma ) / ( 2.0f * ( 1.0f - c.kb ) ) );
+            uint8_t v = ToByte( 128.0f + c.cScale * ( average[0] - luma ) / ( 2.0f * ( 1.0f - c.kr ) ) );
+            if ( i420 )
+            {
+                size_t index = ( y / 2 ) * ( in_width / 2 ) + x / 2;
+                chroma[index] = u;
+                chroma[lumaSize / 4 + index] = v;
+            }
+            else
+            {
+                size_t index = ( y / 2 ) * in_width + x;
+                chroma[index] = u;
+                chroma[index + 1] = v;
+            }
+        }
+    }
+}
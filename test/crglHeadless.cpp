@@ -0,0 +1,313 @@
+/*
+===========================================================================================
+    This file is part of crglLib OpenGL core c++ framework.
+
+    Copyright (c) 2025 Cristiano B. Santos <cristianobeato_dm@hotmail.com>
+    Contributor(s): none yet.
+
+-------------------------------------------------------------------------------------------
+
+ This file is part of the crglLib library and is licensed under the
+ MIT License with Attribution Requirement.
+
+ You are free to use, modify, and distribute this file (even commercially),
+ as long as you give credit to the original author:
+
+     “Based on crglCore by Cristiano Beato – https://github.com/CristianoBeato”
+
+ For full license terms, see the LICENSE file in the root of this repository.
+===============================================================================================
+*/
+
+// Headless checks, run whitout a window on a EGL surfaceless display.
+// Each check print its result, the exit code is the number of failed checks.
+
+#include <iostream>
+#include <exception>
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <crglCore.hpp>
+#include <crglDispatch.hpp>
+
+typedef bool ( *check_t )( egl::Context* in_context );
+
+/// @brief GPU compute conversion against the CPU reference, every layout and matrix
+static bool CheckYuvConverter( egl::Context* in_context )
+{
+    for ( int mode = 0; mode < 8; mode++ )
+    {
+        gl::YuvConverter converter;
+        gl::YuvConverter::createInfo_t createInfo;
+        createInfo.layout = ( mode & 1 ) ? gl::YUV_I420 : gl::YUV_NV12;
+        createInfo.matrix = ( mode & 2 ) ? gl::YUV_BT601 : gl::YUV_BT709;
+        createInfo.fullRange = ( mode & 4 ) != 0;
+        createInfo.flipY = ( mode & 1 ) != 0;
+
+        if ( !converter.Create( &createInfo ) || !converter.Verify( 320, 180 ) )
+            return false;
+    }
+
+    return true;
+}
+
+/// @brief clear the worker framebuffer to a color from the job number and check it come back
+class ClearJob : public gl::RenderJob
+{
+public:
+    GLuint              number = 0;
+    std::atomic<bool>*  failed = nullptr;
+
+    virtual void    Render( gl::Context* in_context ) override
+    {
+        glClearColor( static_cast<GLfloat>( number % 256 ) / 255.0f, 0.0f, 1.0f, 1.0f );
+        glClear( GL_COLOR_BUFFER_BIT );
+    }
+
+    virtual void    Finished( const void* in_pixels, const GLuint in_width, const GLuint in_height ) override
+    {
+        const uint8_t* pixels = static_cast<const uint8_t*>( in_pixels );
+        const size_t last = ( static_cast<size_t>( in_width ) * in_height - 1 ) * 4;
+        if ( pixels == nullptr || pixels[0] != number % 256 || pixels[2] != 255 || pixels[last] != number % 256 )
+            *failed = true;
+    }
+};
+
+/// @brief render farm on the default factory, each worker on its own surfaceless context
+static bool CheckRenderFarm( egl::Context* in_context )
+{
+    gl::RenderFarm farm;
+    gl::RenderFarm::createInfo_t createInfo;
+    createInfo.workers = 2;
+    createInfo.width = 64;
+    createInfo.height = 64;
+    if ( !farm.Start( &createInfo ) )
+        return false;
+
+    std::atomic<bool> failed{ false };
+    std::vector<ClearJob> jobs( 64 );
+    for ( GLuint i = 0; i < jobs.size(); i++ )
+    {
+        jobs[i].number = i;
+        jobs[i].failed = &failed;
+        if ( !farm.Submit( &jobs[i] ) )
+            return false;
+    }
+
+    farm.WaitIdle();
+    const gl::renderFarmStats_t stats = farm.Stats();
+    farm.Stop();
+    return !failed && stats.completed == jobs.size() && stats.failed == 0;
+}
+
+/// @brief solid tiles, the color encode the tile position and level
+class ColorTiles : public gl::TileSource
+{
+public:
+    virtual bool    LoadTile( const GLint in_level, const GLuint in_x, const GLuint in_y, const GLuint in_width, const GLuint in_height, void* in_destine, const GLsizeiptr in_size ) override
+    {
+        const uint8_t color[4] = { Red( in_x ), Green( in_y ), Blue( in_level ), 255 };
+        uint8_t* texels = static_cast<uint8_t*>( in_destine );
+        for ( GLsizeiptr i = 0; i + 4 <= in_size; i += 4 )
+            std::memcpy( texels + i, color, 4 );
+
+        return true;
+    }
+
+    static uint8_t  Red( const GLuint in_x ) { return static_cast<uint8_t>( 10 + in_x * 40 ); }
+    static uint8_t  Green( const GLuint in_y ) { return static_cast<uint8_t>( 10 + in_y * 40 ); }
+    static uint8_t  Blue( const GLint in_level ) { return static_cast<uint8_t>( 20 + in_level * 100 ); }
+};
+
+static const char k_VIRTUAL_SAMPLE_MAIN[] = R"(
+layout( local_size_x = 1 ) in;
+layout( binding = 0 ) uniform sampler2D u_atlas;
+layout( binding = 1 ) uniform usampler2DArray u_pageTable;
+layout( location = 0 ) uniform int u_width;
+layout( location = 1 ) uniform int u_height;
+layout( location = 2 ) uniform int u_tileSize;
+layout( location = 3 ) uniform int u_tiles;
+layout( std430, binding = 0 ) writeonly buffer samples_t { uvec4 samples[]; };
+
+void main( void )
+{
+    int tile = int( gl_GlobalInvocationID.x );
+    vec2 coord = ( vec2( tile % u_tiles, tile / u_tiles ) + 0.5 ) / float( u_tiles );
+    vec4 color = crglVirtualSample( u_atlas, u_pageTable, coord, 0.0, vec2( u_width, u_height ), float( u_tileSize ) );
+    samples[tile] = uvec4( round( color * 255.0 ) );
+}
+)";
+
+/// @brief software page table forced, sample the center of every level 0 tile trought ShaderSource
+static bool CheckVirtualTextureFallback( egl::Context* in_context )
+{
+    const GLuint tiles = 4;
+    ColorTiles source;
+    gl::VirtualTexture virtualTexture;
+    gl::VirtualTexture::createInfo_t createInfo;
+    createInfo.width = 512;
+    createInfo.height = 512;
+    createInfo.levels = 2;
+    createInfo.tileSize = 128;
+    createInfo.cacheTiles = 32;
+    createInfo.tilesPerUpdate = 32;
+    createInfo.allowSparse = false;
+    if ( !virtualTexture.Create( &createInfo, &source ) || virtualTexture.IsSparse() )
+        return false;
+
+    virtualTexture.RequestRegion( 0, 0.0f, 0.0f, 1.0f, 1.0f );
+    if ( virtualTexture.Update() != tiles * tiles )
+        return false;
+
+    const std::string compute = std::string( "#version 450 core\n" ) + gl::VirtualTexture::ShaderSource() + k_VIRTUAL_SAMPLE_MAIN;
+    const GLchar* sources[1] = { compute.c_str() };
+    gl::Shader shader;
+    gl::Program program;
+    if ( !shader.Create( GL_COMPUTE_SHADER, sources, nullptr, 1 ) )
+        return false;
+
+    const gl::Shader* shaders[1] = { &shader };
+    if ( !program.Create( shaders, 1 ) )
+        return false;
+
+    const GLsizeiptr size = tiles * tiles * 4 * sizeof( GLuint );
+    gl::Buffer samples;
+    samples.Create( GL_SHADER_STORAGE_BUFFER, size, nullptr, 0 );
+
+    glProgramUniform1i( program, 0, static_cast<GLint>( createInfo.width ) );
+    glProgramUniform1i( program, 1, static_cast<GLint>( createInfo.height ) );
+    glProgramUniform1i( program, 2, static_cast<GLint>( createInfo.tileSize ) );
+    glProgramUniform1i( program, 3, static_cast<GLint>( tiles ) );
+
+    GLuint textures[2] = { virtualTexture.Physical()->Handle(), virtualTexture.PageTable()->Handle() };
+    GLuint samplers[2] = { 0, 0 };
+    GLuint buffer = samples.GetHandle();
+    GLintptr offset = 0;
+    GLuint previous = in_context->BindProgram( program );
+    in_context->BindTextures( textures, samplers, 0, 2 );
+    in_context->BindShaderStorageBuffers( &buffer, &offset, &size, 0, 1 );
+    glDispatchCompute( tiles * tiles, 1, 1 );
+    glMemoryBarrier( GL_BUFFER_UPDATE_BARRIER_BIT );
+    in_context->BindProgram( previous );
+
+    std::vector<GLuint> result( tiles * tiles * 4 );
+    void* data = result.data();
+    samples.Download( data, 0, size );
+    for ( GLuint y = 0; y < tiles; y++ )
+    {
+        for ( GLuint x = 0; x < tiles; x++ )
+        {
+            const GLuint* texel = &result[( y * tiles + x ) * 4];
+            if ( texel[0] != ColorTiles::Red( x ) || texel[1] != ColorTiles::Green( y ) || texel[2] != ColorTiles::Blue( 0 ) || texel[3] != 255 )
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/// @brief destroy a texture on a worker thread
+class DestroyJob : public gl::ResourceJob
+{
+public:
+    gl::Texture*    texture = nullptr;
+
+    virtual void    Execute( void ) override { texture->Destroy(); }
+};
+
+/// @brief entries dropped for a texture destroyed on a shared context, kept when no context is current
+static bool CheckFrameBufferCache( egl::Context* in_context )
+{
+    gl::FrameBufferCache cache;
+    gl::FrameBufferCache::createInfo_t cacheInfo;
+    if ( !cache.Create( &cacheInfo ) || !in_context->CreateWorkers( 1 ) )
+        return false;
+
+    gl::Texture::createInfo_t createInfo;
+    createInfo.target = GL_TEXTURE_2D;
+    createInfo.format = gl::Format( GL_RGBA8 );
+    createInfo.dimensions.width = 64;
+    createInfo.dimensions.height = 64;
+
+    gl::Texture onWorker;
+    gl::Texture noContext;
+    if ( !onWorker.Create( &createInfo ) || !noContext.Create( &createInfo ) )
+        return false;
+
+    const gl::fboAttachment_t workerAttachment = gl::FrameBufferCache::Attachment( &onWorker, GL_COLOR_ATTACHMENT0 );
+    const gl::fboAttachment_t noContextAttachment = gl::FrameBufferCache::Attachment( &noContext, GL_COLOR_ATTACHMENT0 );
+    if ( cache.Get( &workerAttachment, 1 ) == 0 || cache.Get( &noContextAttachment, 1 ) == 0 )
+        return false;
+
+    // notified from the worker thread
+    DestroyJob job;
+    job.texture = &onWorker;
+    if ( !in_context->Submit( &job ) )
+        return false;
+
+    while ( in_context->PendingJobs() > 0 )
+        in_context->ProcessCompletedJobs();
+
+    in_context->DestroyWorkers();
+    if ( cache.Get( &noContextAttachment, 1 ) == 0 || cache.Stats().evictions != 1 )
+        return false;
+
+    // not notified, but not deleted either, the framebuffer still point to a live texture
+    in_context->Release();
+    noContext.Destroy();
+    in_context->MakeCurrent();
+    const bool kept = glIsTexture( noContextAttachment.handle ) == GL_TRUE && cache.Get( &noContextAttachment, 1 ) != 0 && cache.Stats().hits == 2;
+    cache.Destroy();
+    glDeleteTextures( 1, &noContextAttachment.handle );
+    return kept;
+}
+
+int main( int argc, char *argv[] )
+{
+    static const struct { const char* name; check_t check; } k_CHECKS[] =
+    {
+        { "YuvConverter", CheckYuvConverter },
+        { "RenderFarm", CheckRenderFarm },
+        { "VirtualTexture fallback", CheckVirtualTextureFallback },
+        { "FrameBufferCache", CheckFrameBufferCache },
+    };
+
+    egl::Context context;
+    egl::Context::createInfo_t createInfo;
+    createInfo.pbuffer = true;
+    createInfo.core = true;
+    createInfo.verMaj = 4;
+    createInfo.verMin = 5;
+    createInfo.platform = EGL_PLATFORM_SURFACELESS_MESA;
+
+    gl::debugConfig_t debug;
+    debug.mode = gl::DEBUG_SYNCHRONOUS;
+
+    if ( !context.Create( &createInfo ) || !context.MakeCurrent() || !context.Init( &debug ) )
+    {
+        std::cerr << "failed to create a surfaceless context\n";
+        return -1;
+    }
+
+    int failed = 0;
+    for ( const auto& check : k_CHECKS )
+    {
+        bool passed = false;
+        try
+        {
+            passed = check.check( &context );
+        }
+        catch( const std::exception& e )
+        {
+            std::cerr << e.what() << '\n';
+        }
+
+        std::cout << ( passed ? "[ OK ] " : "[FAIL] " ) << check.name << '\n';
+        if ( !passed )
+            failed++;
+    }
+
+    return failed;
+}
@@ -6,6 +6,7 @@
 #include <exception>
 
 #include <crglCore.hpp>
+#include <crglDispatch.hpp>
 
 typedef struct vec2
 {
@@ -107,6 +108,11 @@ bool crTestContext::Create( const void* in_windowHandle )
     
     Init();
 
+    gl::startupStats_t startup = StartupStats();
+    std::cout << "context startup: " << startup.totalTime / 1000 << "us ( functions " << startup.loadTime / 1000 
+        << "us, extensions " << startup.extensionTime / 1000 << "us, queries " << startup.queryTime / 1000 << "us ), "
+        << startup.functionsMissing << " missing functions, " << startup.extensions << " extensions" << std::endl;
+
     return true;
 }
 
@@ -121,13 +127,21 @@ void crTestContext::Destroy( void )
 
 bool crTestContext::MakeCurrent( void )
 {
-    return SDL_GL_MakeCurrent( m_renderWindown, nullptr );
+    if ( !SDL_GL_MakeCurrent( m_renderWindown, m_renderContext ) )
+        return false;
+
+    SetCurrent( this );
+    return true;
 }
 
 bool crTestContext::Release( void )
 {
     // make it true
-    return SDL_GL_MakeCurrent( m_renderWindown, nullptr );
+    if ( !SDL_GL_MakeCurrent( m_renderWindown, nullptr ) )
+        return false;
+
+    SetCurrent( nullptr );
+    return true;
 }
 
 bool crTestContext::SwapBuffers( void )
@@ -256,8 +270,16 @@ void crApp::RenderFrame(void)
     glViewport(0, 0, 640, 420 ); 
 
     // Clear our custom frame buffer colot to dark orange
-    glClearColor( 0.5f, 0.2f, 0.1, 1.0f );
-    glClear( GL_COLOR_BUFFER_BIT );
+    gl::FrameBuffer::clearColor_t orange;
+    orange.color[0] = 0.5f;
+    orange.color[1] = 0.2f;
+    orange.color[2] = 0.1f;
+    orange.color[3] = 1.0f;
+
+    gl::FrameBuffer::clearInfo_t clear;
+    clear.colors = &orange;
+    clear.colorCount = 1;
+    m_framebuffer->Clear( &clear );
 
     // bind texture and samples
     texture[0] = m_image->Handle();
@@ -266,7 +288,7 @@ void crApp::RenderFrame(void)
 
     // draw to the frame buffer 
     //glDrawElements( GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, (void*)0 );
-    glDrawElementsBaseVertex( GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, (void*)0, 4 ); // we use a fliped UV vertex now
+    m_ctx->DrawElements( GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, 0, 1, 4 ); // we use a fliped UV vertex now
 
     //_________________________________ DRAW TO SCREEN _________________________________ 
 
@@ -277,18 +299,26 @@ void crApp::RenderFrame(void)
     glViewport(0, 0, 800, 600 ); 
 
     // clear defalt frame buffer color dark gray
-    glClearColor( 0.2f, 0.2f, 0.2, 1.0f );
-    glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+    gl::FrameBuffer::clearColor_t gray;
+    gray.color[0] = 0.2f;
+    gray.color[1] = 0.2f;
+    gray.color[2] = 0.2f;
+    gray.color[3] = 1.0f;
+
+    clear.colors = &gray;
+    clear.depth = true;
+    gl::FrameBuffer::Clear( 0, &clear );
 
     texture[0] = m_framebufferAttach->Handle();
     samples[0] = m_sampler->Handler(); // use the same sampler
     m_ctx->BindTextures( texture, samples, 0, 1 );
 
     // draw 
-    glDrawElements( GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, (void*)0 );
+    m_ctx->DrawElements( GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, 0 );
 
     // show to screen 
     m_ctx->SwapBuffers();
+    m_ctx->EndFrame();
 }
 
 void crApp::InitOpenGL( void )